@@ -20,7 +20,10 @@ def find_midi_file(filename):
         
     return None
 
-def automate_midi(filename_mid_input, time_t):
+# Outputs of earlier conversions, keyed by the MIDI file, options and used instruments
+CACHE_DIR = "midi_cache"
+
+def automate_midi(filename_mid_input, time_t, use_cache=True):
     found_midi_path = find_midi_file(filename_mid_input)
     if not found_midi_path:
         print(f"Error: MIDI file '{filename_mid_input}' not found in current directory or 'music_midi' folder.")
@@ -101,8 +104,9 @@ def automate_midi(filename_mid_input, time_t):
         # 3. Execute the following commands in order
         # Command 1: midi_converter.exe
         time_param = f"-time {time_t}" if time_t else ""
+        cache_param = f"-cache {CACHE_DIR}" if use_cache else ""
         # Assuming midi_converter.exe and midi_config.ini are in the current directory
-        cmd1 = f"midi_converter.exe {filename_mid} {filename_base}.gbas -d {time_param} -config midi_config.ini"
+        cmd1 = f"midi_converter.exe {filename_mid} {filename_base}.gbas -d {time_param} -config midi_config.ini {cache_param}"
         print(f"Executing: {cmd1}")
         try:
             # Suppress DEBUG output by redirecting to NUL (Windows) or /dev/null (Unix-like)
@@ -230,6 +234,7 @@ if __name__ == "__main__":
     parser = argparse.ArgumentParser(description="Automate MIDI conversion and compilation.")
     parser.add_argument("-mid", dest="filename_mid_input", required=True, help="MIDI file name (e.g., filename.mid). Will search in current directory and 'music_midi' folder.")
     parser.add_argument("-time", dest="time_t", required=False, help="Time parameter for midi_converter.exe (optional)")
+    parser.add_argument("-nocache", dest="use_cache", action="store_false", help=f"Always reconvert instead of reusing outputs in '{CACHE_DIR}'")
     args = parser.parse_args()
 
-    automate_midi(args.filename_mid_input, args.time_t)
\ No newline at end of file
+    automate_midi(args.filename_mid_input, args.time_t, args.use_cache)
\ No newline at end of file
@@ -0,0 +1,155 @@
+import re
+import os
+import sys
+import json
+import time
+import argparse
+import tempfile
+import subprocess
+
+import gbas_to_c
+
+# Fixed corpus: the MIDI files shipped next to the converter
+DEFAULT_CORPUS = os.path.join(os.path.dirname(os.path.abspath(__file__)), "mid")
+STAGES = ["read", "link", "allocate", "schedule", "expand", "emit", "gbas_to_c"]
+
+def run_converter(converter, midi_path, gbas_path, stats_path, options):
+    """Run midi_converter once, returning (wall seconds, peak RSS in KiB or None)."""
+    cmd = [converter, midi_path, gbas_path] + options + ["-stats", stats_path]
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, cwd=os.path.dirname(gbas_path))
+    if hasattr(os, "wait4"):
+        _, status, usage = os.wait4(proc.pid, 0)
+        proc.returncode = os.waitstatus_to_exitcode(status)
+        # ru_maxrss is in KiB on Linux and in bytes on macOS
+        rss = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+    else:
+        proc.wait()
+        rss = None
+    wall = time.perf_counter() - start
+    if proc.returncode != 0:
+        raise RuntimeError(f"{' '.join(cmd)} exited with {proc.returncode}")
+    return wall, rss
+
+def bench_song(converter, midi_path, work_dir, options, repeat):
+    name = os.path.splitext(os.path.basename(midi_path))[0]
+    gbas_path = os.path.join(work_dir, f"{name}.gbas")
+    stats_path = os.path.join(work_dir, f"{name}.json")
+
+    # Keep the fastest run of each stage, the largest RSS
+    best = None
+    for _ in range(repeat):
+        wall, rss = run_converter(converter, midi_path, gbas_path, stats_path, options)
+        with open(stats_path, "r") as f:
+            stats = json.load(f)
+        with open(gbas_path, "r", encoding="utf-8") as f:
+            gbas_content = f.read()
+        start = time.perf_counter()
+        c_code = gbas_to_c.parse_gbas(gbas_content, name, f"{name}.gbas")
+        stats["stages"]["gbas_to_c"] = time.perf_counter() - start
+        if best is None:
+            best = dict(stats, wall=wall, rss_kib=rss)
+        else:
+            best["wall"] = min(best["wall"], wall)
+            for stage, seconds in stats["stages"].items():
+                best["stages"][stage] = min(best["stages"][stage], seconds)
+            if rss is not None:
+                best["rss_kib"] = max(best["rss_kib"] or 0, rss)
+
+    m = re.search(r"memsize (\d+) in (\d+) segments", c_code)
+    best["bytes"] = int(m.group(1)) if m else None
+    best["segments"] = int(m.group(2)) if m else None
+    convert = sum(best["stages"][s] for s in STAGES if s != "gbas_to_c")
+    best["events_per_sec"] = best["events"] / convert if convert > 0 else None
+    return name, best
+
+def totals(songs):
+    total = {"events": 0, "bytes": 0, "segments": 0, "wall": 0.0, "rss_kib": 0,
+             "stages": {s: 0.0 for s in STAGES}}
+    for song in songs.values():
+        total["events"] += song["events"]
+        total["bytes"] += song["bytes"] or 0
+        total["segments"] += song["segments"] or 0
+        total["wall"] += song["wall"]
+        total["rss_kib"] = max(total["rss_kib"], song["rss_kib"] or 0)
+        for s in STAGES:
+            total["stages"][s] += song["stages"].get(s, 0.0)
+    convert = sum(total["stages"][s] for s in STAGES if s != "gbas_to_c")
+    total["events_per_sec"] = total["events"] / convert if convert > 0 else None
+    return total
+
+def percent(new, old):
+    if not old:
+        return "     -"
+    return f"{(new - old) * 100.0 / old:+6.1f}%"
+
+def report(results, baseline=None):
+    print(f"{'song':<28}{'events':>8}{'wall ms':>10}{'ev/s':>10}{'RSS KiB':>9}{'bytes':>8}{'segs':>6}")
+    rows = list(results["songs"].items()) + [("TOTAL", results["total"])]
+    for name, r in rows:
+        eps = f"{r['events_per_sec'] / 1000:.0f}k" if r["events_per_sec"] else "-"
+        print(f"{name:<28}{r['events']:>8}{r['wall'] * 1000:>10.1f}{eps:>10}{r['rss_kib'] or 0:>9}"
+              f"{r['bytes'] or 0:>8}{r['segments'] or 0:>6}")
+        if baseline is None:
+            continue
+        old = baseline["total"] if name == "TOTAL" else baseline["songs"].get(name)
+        if old is None:
+            print(f"{'':<28}(not in baseline)")
+            continue
+        stages = " ".join(f"{s} {percent(r['stages'].get(s, 0), old['stages'].get(s, 0)).strip()}"
+                          for s in STAGES if old["stages"].get(s))
+        print(f"{'':<28}wall {percent(r['wall'], old['wall']).strip()}, "
+              f"bytes {(r['bytes'] or 0) - (old['bytes'] or 0):+d}, "
+              f"segments {(r['segments'] or 0) - (old['segments'] or 0):+d}; {stages}")
+
+def main():
+    parser = argparse.ArgumentParser(description='Benchmark midi_converter and gbas_to_c.py over a MIDI corpus')
+    parser.add_argument('midis', nargs='*', metavar='file.mid',
+                        help=f'MIDI files to convert (default: all of {DEFAULT_CORPUS})')
+    parser.add_argument('-c', '--converter', default=os.path.join(os.path.dirname(os.path.abspath(__file__)), 'midi_converter.exe'),
+                        help='converter executable (default: midi_converter.exe next to this script)')
+    parser.add_argument('-x', '--options', default='-d -config midi_config.ini',
+                        help='converter options (default: "-d -config midi_config.ini")')
+    parser.add_argument('-r', '--repeat', type=int, default=3, help='runs per song, the fastest counts (default: 3)')
+    parser.add_argument('-o', '--output', default='benchmark.json', help='results file (default: benchmark.json)')
+    parser.add_argument('-b', '--baseline', metavar='FILE', help='results file to compare against')
+    args = parser.parse_args()
+
+    midis = args.midis or sorted(os.path.join(DEFAULT_CORPUS, f) for f in os.listdir(DEFAULT_CORPUS)
+                                 if f.lower().endswith(".mid"))
+    # The converter runs in a scratch directory, so make file options absolute
+    options = [os.path.abspath(o) if os.path.isfile(o) else o for o in args.options.split()]
+    converter = os.path.abspath(args.converter)
+
+    baseline = None
+    if args.baseline:
+        try:
+            with open(args.baseline, "r") as f:
+                baseline = json.load(f)
+        except Exception as e:
+            print(f"Error reading baseline '{args.baseline}': {e}")
+            sys.exit(1)
+
+    songs = {}
+    with tempfile.TemporaryDirectory() as work_dir:
+        for midi in midis:
+            try:
+                name, result = bench_song(converter, os.path.abspath(midi), work_dir, options, max(1, args.repeat))
+            except Exception as e:
+                print(f"Error benchmarking '{midi}': {e}")
+                sys.exit(1)
+            songs[name] = result
+
+    results = {"converter": args.converter, "options": args.options, "songs": songs, "total": totals(songs)}
+    report(results, baseline)
+
+    try:
+        with open(args.output, "w") as f:
+            json.dump(results, f, indent=1, sort_keys=True)
+    except Exception as e:
+        print(f"Error writing to file '{args.output}': {e}")
+        sys.exit(1)
+    print(f"Results written to {args.output}")
+
+if __name__ == "__main__":
+    main()
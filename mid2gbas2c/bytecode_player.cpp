@@ -0,0 +1,1017 @@
+#include "bytecode_player.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+// ---------------------------------------------------------------------------
+// C 源码加载：gbas_to_c.py 生成的 nohop 字节数组和指针表
+
+namespace {
+
+struct ArrayDef {
+    std::string name;
+    bool is_pointer;              // const byte *name[]
+    bool is_static;
+    std::vector<std::string> items;
+    uint16_t address;
+    size_t size;
+};
+
+struct MacroDef {
+    std::vector<std::string> params;
+    std::string body;
+};
+
+// 去掉 /* */ 和 // 注释，保留换行以便按行处理 #define
+std::string stripComments(const std::string& src) {
+    std::string out;
+    for (size_t i = 0; i < src.size(); ++i) {
+        if (src[i] == '/' && i + 1 < src.size() && src[i + 1] == '*') {
+            size_t end = src.find("*/", i + 2);
+            for (size_t j = i; j < src.size() && (end == std::string::npos || j < end + 2); ++j) {
+                if (src[j] == '\n') out += '\n';
+            }
+            if (end == std::string::npos) break;
+            i = end + 1;
+        } else if (src[i] == '/' && i + 1 < src.size() && src[i + 1] == '/') {
+            while (i < src.size() && src[i] != '\n') ++i;
+            out += '\n';
+        } else {
+            out += src[i];
+        }
+    }
+    return out;
+}
+
+std::string trim(const std::string& s) {
+    size_t b = s.find_first_not_of(" \t\r\n");
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return (b == std::string::npos) ? "" : s.substr(b, e - b + 1);
+}
+
+// 按顶层逗号分割（忽略括号内的逗号）
+std::vector<std::string> splitTopLevel(const std::string& s) {
+    std::vector<std::string> parts;
+    int depth = 0;
+    std::string cur;
+    for (char c : s) {
+        if (c == '(') depth++;
+        if (c == ')') depth--;
+        if (c == ',' && depth == 0) {
+            parts.push_back(trim(cur));
+            cur.clear();
+        } else {
+            cur += c;
+        }
+    }
+    if (!trim(cur).empty()) parts.push_back(trim(cur));
+    return parts;
+}
+
+// 整数表达式求值：数字、括号、+ - * / << >> & |
+class ExprEval {
+public:
+    explicit ExprEval(const std::string& s) : src(s), pos(0) {}
+    bool eval(long& value) {
+        value = parseOr();
+        skip();
+        return ok && pos == src.size();
+    }
+private:
+    const std::string& src;
+    size_t pos;
+    bool ok = true;
+    void skip() { while (pos < src.size() && std::isspace((unsigned char)src[pos])) ++pos; }
+    bool take(const char* op) {
+        skip();
+        size_t n = std::char_traits<char>::length(op);
+        if (src.compare(pos, n, op) == 0) { pos += n; return true; }
+        return false;
+    }
+    long parseOr() { long v = parseAnd(); while (take("|")) v |= parseAnd(); return v; }
+    long parseAnd() { long v = parseShift(); while (take("&")) v &= parseShift(); return v; }
+    long parseShift() {
+        long v = parseAdd();
+        for (;;) {
+            if (take("<<")) v <<= parseAdd();
+            else if (take(">>")) v >>= parseAdd();
+            else return v;
+        }
+    }
+    long parseAdd() {
+        long v = parseMul();
+        for (;;) {
+            if (take("+")) v += parseMul();
+            else if (take("-")) v -= parseMul();
+            else return v;
+        }
+    }
+    long parseMul() {
+        long v = parseUnary();
+        for (;;) {
+            if (take("*")) v *= parseUnary();
+            else if (take("/")) { long d = parseUnary(); v = d ? v / d : (ok = false, 0); }
+            else return v;
+        }
+    }
+    long parseUnary() {
+        if (take("-")) return -parseUnary();
+        if (take("(")) { long v = parseOr(); if (!take(")")) ok = false; return v; }
+        skip();
+        size_t start = pos;
+        while (pos < src.size() && std::isalnum((unsigned char)src[pos])) ++pos;
+        if (start == pos) { ok = false; return 0; }
+        try {
+            size_t used = 0;
+            long v = std::stol(src.substr(start, pos - start), &used, 0);
+            if (used != pos - start) ok = false;
+            return v;
+        } catch (const std::exception&) {
+            ok = false;
+            return 0;
+        }
+    }
+};
+
+// 展开一个数组元素中的宏调用（如 W(1,60,77,1)），得到逗号分隔的表达式
+bool expandItem(const std::string& item, const std::map<std::string, MacroDef>& macros,
+                std::vector<long>& out, std::string& error) {
+    size_t paren = item.find('(');
+    std::string head = trim(item.substr(0, paren));
+    auto it = (paren != std::string::npos) ? macros.find(head) : macros.end();
+    if (it == macros.end()) {
+        long v;
+        if (!ExprEval(item).eval(v)) {
+            error = "cannot evaluate '" + item + "'";
+            return false;
+        }
+        out.push_back(v);
+        return true;
+    }
+    size_t close = item.rfind(')');
+    std::vector<std::string> args = splitTopLevel(item.substr(paren + 1, close - paren - 1));
+    const MacroDef& m = it->second;
+    if (args.size() != m.params.size()) {
+        error = "wrong argument count in '" + item + "'";
+        return false;
+    }
+    // 按标识符替换参数
+    std::string body;
+    for (size_t i = 0; i < m.body.size();) {
+        if (std::isalpha((unsigned char)m.body[i]) || m.body[i] == '_') {
+            size_t j = i;
+            while (j < m.body.size() && (std::isalnum((unsigned char)m.body[j]) || m.body[j] == '_')) ++j;
+            std::string id = m.body.substr(i, j - i);
+            bool replaced = false;
+            for (size_t k = 0; k < m.params.size(); ++k) {
+                if (m.params[k] == id) {
+                    body += "(" + args[k] + ")";
+                    replaced = true;
+                    break;
+                }
+            }
+            if (!replaced) body += id;
+            i = j;
+        } else {
+            body += m.body[i++];
+        }
+    }
+    for (const std::string& part : splitTopLevel(body)) {
+        if (!expandItem(part, macros, out, error)) return false;
+    }
+    return true;
+}
+
+// 解析指针表元素：0、name、name+n、(const byte*)n、(const byte*)(name+n)
+bool evalPointer(std::string item, const std::map<std::string, const ArrayDef*>& arrays,
+                 uint16_t& value, std::string& error) {
+    item = trim(item);
+    for (const char* cast : {"(const byte**)", "(const byte*)", "(const byte *)", "(byte*)"}) {
+        if (item.compare(0, std::char_traits<char>::length(cast), cast) == 0) {
+            item = trim(item.substr(std::char_traits<char>::length(cast)));
+        }
+    }
+    if (!item.empty() && item.front() == '(' && item.back() == ')') {
+        item = trim(item.substr(1, item.size() - 2));
+    }
+    size_t plus = item.find('+');
+    std::string base = trim(item.substr(0, plus));
+    long offset = 0;
+    if (plus != std::string::npos && !ExprEval(item.substr(plus + 1)).eval(offset)) {
+        error = "cannot evaluate '" + item + "'";
+        return false;
+    }
+    auto it = arrays.find(base);
+    if (it != arrays.end()) {
+        value = static_cast<uint16_t>(it->second->address + offset * (it->second->is_pointer ? 2 : 1));
+        return true;
+    }
+    long v;
+    if (!ExprEval(item).eval(v)) {
+        error = "unknown symbol in '" + item + "'";
+        return false;
+    }
+    value = static_cast<uint16_t>(v);
+    return true;
+}
+
+bool readFile(const std::string& filename, std::string& data, std::string& error) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        error = "could not open " + filename;
+        return false;
+    }
+    std::ostringstream ss;
+    ss << file.rdbuf();
+    data = ss.str();
+    return true;
+}
+
+} // namespace
+
+bool loadSongC(const std::string& filename, const std::string& song, SongImage& image, std::string& error) {
+    return loadSongC(std::vector<std::string>{filename}, song, image, error);
+}
+
+bool loadSongC(const std::vector<std::string>& filenames, const std::string& song, SongImage& image, std::string& error) {
+    std::string src;
+    for (const std::string& name : filenames) {
+        std::string data;
+        if (!readFile(name, data, error)) return false;
+        src += stripComments(data) + "\n";
+    }
+    const std::string& filename = filenames.front();
+
+    // 宏定义：#define NAME(a,b) body
+    std::map<std::string, MacroDef> macros;
+    std::istringstream lines(src);
+    std::string line;
+    std::string code;
+    while (std::getline(lines, line)) {
+        std::string t = trim(line);
+        if (t.compare(0, 7, "#define") == 0) {
+            std::string rest = trim(t.substr(7));
+            size_t paren = rest.find('(');
+            size_t space = rest.find_first_of(" \t");
+            if (paren != std::string::npos && (space == std::string::npos || paren < space)) {
+                size_t close = rest.find(')', paren);
+                MacroDef m;
+                for (const std::string& p : splitTopLevel(rest.substr(paren + 1, close - paren - 1))) {
+                    m.params.push_back(p);
+                }
+                m.body = trim(rest.substr(close + 1));
+                macros[rest.substr(0, paren)] = m;
+            }
+            continue;
+        }
+        if (!t.empty() && t[0] == '#') continue;
+        code += line + "\n";
+    }
+
+    // 数组定义：[nohop] [static] const byte [*]name[] = { ... };
+    std::vector<ArrayDef> defs;
+    size_t pos = 0;
+    while ((pos = code.find("byte", pos)) != std::string::npos) {
+        bool word = (pos == 0 || !(std::isalnum((unsigned char)code[pos - 1]) || code[pos - 1] == '_')) &&
+                    (pos + 4 >= code.size() || !(std::isalnum((unsigned char)code[pos + 4]) || code[pos + 4] == '_'));
+        if (!word) {
+            pos += 4;
+            continue;
+        }
+        size_t stmt = code.find_last_of(";}", pos);
+        std::string prefix = code.substr(stmt == std::string::npos ? 0 : stmt + 1, pos - (stmt == std::string::npos ? 0 : stmt + 1));
+        size_t i = pos + 4;
+        pos = i;
+        if (prefix.find("const") == std::string::npos) continue;
+        while (i < code.size() && std::isspace((unsigned char)code[i])) ++i;
+        ArrayDef def;
+        def.is_pointer = (i < code.size() && code[i] == '*');
+        if (def.is_pointer) ++i;
+        while (i < code.size() && std::isspace((unsigned char)code[i])) ++i;
+        size_t name_start = i;
+        while (i < code.size() && (std::isalnum((unsigned char)code[i]) || code[i] == '_')) ++i;
+        def.name = code.substr(name_start, i - name_start);
+        size_t eq = code.find('=', i);
+        size_t brace = code.find('{', i);
+        size_t semi = code.find(';', i);
+        if (def.name.empty() || eq == std::string::npos || brace == std::string::npos || semi < brace) continue;
+        if (trim(code.substr(i, eq - i)) != "[]") continue;
+        size_t close = code.find('}', brace);
+        if (close == std::string::npos) break;
+        def.is_static = (prefix.find("static") != std::string::npos);
+        def.items = splitTopLevel(code.substr(brace + 1, close - brace - 1));
+        def.address = 0;
+        def.size = 0;
+        defs.push_back(def);
+        pos = close;
+    }
+    if (defs.empty()) {
+        error = "no byte arrays in " + filename;
+        return false;
+    }
+
+    // 字节数组先展开以得到大小
+    std::map<std::string, std::vector<long>> bytes;
+    for (ArrayDef& def : defs) {
+        if (def.is_pointer) {
+            def.size = 2 * def.items.size();
+            continue;
+        }
+        std::vector<long>& data = bytes[def.name];
+        for (const std::string& item : def.items) {
+            if (!expandItem(item, macros, data, error)) {
+                error = def.name + ": " + error;
+                return false;
+            }
+        }
+        def.size = data.size();
+    }
+
+    // 从 0x8000 开始分配地址，nohop 数组不跨页
+    uint32_t addr = 0x8000;
+    std::map<std::string, const ArrayDef*> arrays;
+    for (ArrayDef& def : defs) {
+        if (def.is_pointer && (addr & 1)) addr++;
+        if (def.size <= 256 && (addr & 0xff) + def.size > 256) addr = (addr + 255) & ~0xffu;
+        if (addr + def.size > 0x10000) {
+            error = "song does not fit in 64K";
+            return false;
+        }
+        def.address = static_cast<uint16_t>(addr);
+        addr += def.size;
+        arrays[def.name] = &def;
+        image.symbols[def.name] = def.address;
+    }
+
+    const ArrayDef* table = nullptr;
+    for (const ArrayDef& def : defs) {
+        if (def.is_pointer) {
+            for (size_t k = 0; k < def.items.size(); ++k) {
+                uint16_t v;
+                if (!evalPointer(def.items[k], arrays, v, error)) {
+                    error = def.name + ": " + error;
+                    return false;
+                }
+                image.ram[def.address + 2 * k] = v & 0xff;
+                image.ram[def.address + 2 * k + 1] = v >> 8;
+            }
+            if (song.empty() ? (!def.is_static && !table) : def.name == song) table = &def;
+        } else {
+            const std::vector<long>& data = bytes[def.name];
+            for (size_t k = 0; k < data.size(); ++k) {
+                image.ram[def.address + k] = static_cast<uint8_t>(data[k]);
+            }
+        }
+    }
+    if (!table) {
+        error = song.empty() ? "no song table in " + filename : "no song table named " + song;
+        return false;
+    }
+    image.name = table->name;
+    image.table = table->address;
+    return true;
+}
+
+bool loadSongGt1(const std::string& filename, uint16_t table, SongImage& image, std::string& error) {
+    std::string data;
+    if (!readFile(filename, data, error)) return false;
+    size_t pos = 0;
+    bool first = true;
+    for (;;) {
+        if (pos + 3 > data.size()) {
+            error = "truncated gt1 file " + filename;
+            return false;
+        }
+        uint8_t hi = data[pos];
+        if (hi == 0 && !first) break;
+        uint16_t address = (hi << 8) | static_cast<uint8_t>(data[pos + 1]);
+        size_t n = static_cast<uint8_t>(data[pos + 2]);
+        if (n == 0) n = 256;
+        if (pos + 3 + n > data.size()) {
+            error = "truncated gt1 segment in " + filename;
+            return false;
+        }
+        for (size_t k = 0; k < n; ++k) {
+            image.ram[(address + k) & 0xffff] = data[pos + 3 + k];
+        }
+        pos += 3 + n;
+        first = false;
+    }
+    image.table = table;
+    return true;
+}
+
+bool loadSongRaw(const std::string& filename, uint16_t base, uint16_t table, SongImage& image, std::string& error) {
+    std::string data;
+    if (!readFile(filename, data, error)) return false;
+    if (base + data.size() > image.ram.size()) {
+        error = "dump does not fit in 64K";
+        return false;
+    }
+    std::copy(data.begin(), data.end(), image.ram.begin() + base);
+    image.table = table;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// notesTable：ROM 中按 32768*freq/7812.5 生成，低 7 位在 keyL，高位在 keyH
+
+uint16_t noteKey(int note) {
+    int j = note - 12;
+    if (j <= 0) return 0;
+    double freq = 440.0 * std::pow(2.0, (j - 57) / 12.0);
+    int key = static_cast<int>(std::lround(32768.0 * freq / 7812.5));
+    if (key > 0x7fff) return 0;
+    return static_cast<uint16_t>(((key >> 7) << 8) | (key & 0x7f));
+}
+
+// ---------------------------------------------------------------------------
+// 字节码解释器
+
+// ---------------------------------------------------------------------------
+// vCPU 周期估算：按 sound.s (cpu 7) 中实际走过的指令序列计数
+
+namespace {
+
+struct OpInfo {
+    const char* name;
+    int cycles;
+};
+
+const OpInfo op_info[OP_COUNT] = {
+    {"LD", 22}, {"LDI", 16}, {"LDW", 20}, {"LDWI", 20}, {"ST", 16}, {"STW", 20},
+    {"ADDW", 28}, {"SUBW", 28}, {"ADDI", 28}, {"SUBI", 28}, {"ANDI", 22}, {"ORI", 14},
+    {"XORI", 14}, {"ANDW", 28}, {"ORW", 28}, {"XORW", 28}, {"LSLW", 28}, {"INC", 20}, {"PEEK", 26},
+    {"POKE", 28}, {"DEEK", 28}, {"DOKE", 30}, {"ADDV", 30}, {"LUP", 26}, {"Bcc", 28},
+    {"Jcc", 26}, {"BRA", 14}, {"CALLI", 28}, {"RET", 16}, {"PUSH", 26}, {"POP", 26},
+    {"vIRQ", 120},
+};
+
+} // namespace
+
+const char* vcpuOpName(int op) {
+    return (op >= 0 && op < OP_COUNT) ? op_info[op].name : "?";
+}
+
+int vcpuOpCycles(int op) {
+    return (op >= 0 && op < OP_COUNT) ? op_info[op].cycles : 0;
+}
+
+namespace {
+
+// sound.s 中的一个 code_* 函数
+struct AsmFunction {
+    std::vector<std::string> labels;                      // label() 定义的标签
+    std::vector<std::string> refs;                        // 引用的标签
+    std::vector<std::pair<int, std::string>> ops;         // (行号, 指令)
+};
+
+// sound.s 中的指令名到周期表中的名字：_BEQ 等宏和长跳转按实际生成的指令计
+std::string costName(std::string op) {
+    if (op[0] == '_') op.erase(0, 1);
+    if (op == "BEQ" || op == "BNE" || op == "BLT" || op == "BGT" || op == "BLE" || op == "BGE") return "Bcc";
+    if (op == "JEQ" || op == "JNE" || op == "JLT" || op == "JGT" || op == "JLE" || op == "JGE") return "Jcc";
+    if (op == "CALLJ") return "CALLI";
+    return op;
+}
+
+} // namespace
+
+bool checkVcpuCosts(const std::string& filename, int& instructions, std::vector<std::string>& missing,
+                    std::string& error) {
+    std::ifstream in(filename);
+    if (!in.is_open()) {
+        error = "could not open file";
+        return false;
+    }
+    std::vector<AsmFunction> functions;
+    size_t def_indent = std::string::npos;
+    std::string line;
+    int line_no = 0;
+    while (std::getline(in, line)) {
+        line_no++;
+        size_t indent = line.find_first_not_of(" \t");
+        if (indent == std::string::npos) continue;
+        if (def_indent != std::string::npos && indent <= def_indent) def_indent = std::string::npos;
+        if (line.compare(indent, 9, "def code_") == 0) {
+            def_indent = indent;
+            functions.emplace_back();
+            continue;
+        }
+        if (def_indent == std::string::npos) continue;
+        AsmFunction& f = functions.back();
+        // 逐个取出 名字(...) 调用和引号中的标签，# 之后是注释
+        std::string name;
+        bool in_label = false;
+        for (size_t i = indent; i < line.size() && line[i] != '#'; i++) {
+            char c = line[i];
+            if (c == '\'' || c == '"') {
+                size_t end = line.find(c, i + 1);
+                if (end == std::string::npos) break;
+                std::string text = line.substr(i + 1, end - i - 1);
+                (in_label ? f.labels : f.refs).push_back(text);
+                i = end;
+            } else if (std::isalnum(static_cast<unsigned char>(c)) || c == '_') {
+                name += c;
+                continue;
+            } else if (c == '(' && !name.empty()) {
+                in_label = name == "label";
+                if (std::isupper(static_cast<unsigned char>(name[0])) || name[0] == '_') {
+                    f.ops.emplace_back(line_no, name);
+                }
+            } else if (c == ')') {
+                in_label = false;
+            }
+            name.clear();
+        }
+    }
+
+    // 从 vIRQ 入口出发，沿引用的标签找到所有会在中断中执行的函数
+    std::vector<bool> reached(functions.size(), false);
+    std::vector<std::string> pending = {"_vIrqAltHandler"};
+    while (!pending.empty()) {
+        std::string target = pending.back();
+        pending.pop_back();
+        for (size_t i = 0; i < functions.size(); i++) {
+            if (reached[i]) continue;
+            const std::vector<std::string>& labels = functions[i].labels;
+            if (std::find(labels.begin(), labels.end(), target) == labels.end()) continue;
+            reached[i] = true;
+            pending.insert(pending.end(), functions[i].refs.begin(), functions[i].refs.end());
+        }
+    }
+
+    instructions = 0;
+    missing.clear();
+    for (size_t i = 0; i < functions.size(); i++) {
+        if (!reached[i]) continue;
+        for (const auto& op : functions[i].ops) {
+            instructions++;
+            std::string cost = costName(op.second);
+            bool found = false;
+            for (int k = 0; k < OP_COUNT && !found; k++) found = cost == op_info[k].name;
+            if (!found) missing.push_back(std::to_string(op.first) + ": " + op.second);
+        }
+    }
+    if (!instructions) {
+        error = "no vIRQ code found from _vIrqAltHandler";
+        return false;
+    }
+    return true;
+}
+
+void BytecodePlayer::charge(std::initializer_list<VcpuOp> ops, int times) {
+    for (VcpuOp op : ops) {
+        op_counts[op] += times;
+        frame_cycles += static_cast<long>(op_info[op].cycles) * times;
+    }
+}
+
+BytecodePlayer::BytecodePlayer(SongImage& img)
+    : image(img), sound_table(256, 0), midi_p(0), midi_q(0), midi_r(0), midi_dict(0), midi_waves(0), midi_t(0), tempo(256), frac(0),
+      frame_count(0), command_count(0), loop_count(0), sound_timer(0), line(0), sample(0),
+      song_tick(0), frame_cycles(0), frame_song_tick(0), op_counts(OP_COUNT, 0), fx_on(false), fx_t(0), fx_kit(0) {
+    std::fill(fx, fx + 32, 0);
+    resetWaveforms();
+    // sound_reset(1)：所有通道 wavA=0, wavX=1，关闭
+    for (int c = 1; c <= 4; ++c) {
+        doke(c * 256 + 0xfa, 0x0100);
+        doke(c * 256 + 0xfc, 0);
+    }
+}
+
+void BytecodePlayer::resetWaveforms() {
+    // 0=噪音（锯齿波的固定洗牌）、1=三角波、2=方波、3=锯齿波
+    uint32_t lfsr = 0x1234;
+    std::vector<uint8_t> noise(64);
+    for (int i = 0; i < 64; ++i) noise[i] = static_cast<uint8_t>(i);
+    for (int i = 63; i > 0; --i) {
+        lfsr = lfsr * 1103515245u + 12345u;
+        std::swap(noise[i], noise[(lfsr >> 16) % (i + 1)]);
+    }
+    for (int i = 0; i < 64; ++i) {
+        sound_table[4 * i + 0] = noise[i];
+        sound_table[4 * i + 1] = static_cast<uint8_t>(i < 32 ? 2 * i : 2 * (63 - i) + 1);
+        sound_table[4 * i + 2] = static_cast<uint8_t>(i < 32 ? 0 : 63);
+        sound_table[4 * i + 3] = static_cast<uint8_t>(i);
+    }
+}
+
+uint16_t BytecodePlayer::deek(uint16_t addr) const {
+    return static_cast<uint16_t>(image.ram[addr] | (image.ram[static_cast<uint16_t>(addr + 1)] << 8));
+}
+
+void BytecodePlayer::doke(uint16_t addr, uint16_t value) {
+    image.ram[addr] = value & 0xff;
+    image.ram[static_cast<uint16_t>(addr + 1)] = value >> 8;
+}
+
+// INC 只增加低字节，所以段和指针表必须是 nohop
+static uint16_t incLow(uint16_t p) {
+    return static_cast<uint16_t>((p & 0xff00) | ((p + 1) & 0xff));
+}
+
+void BytecodePlayer::play() {
+    midi_p = 0;
+    midi_q = image.table;
+    midi_t = frame_count;
+    frac = 0;
+    for (int c = 1; c <= 4; ++c) doke(c * 256 + 0xfc, 0);
+    // _fx.reset
+    std::fill(fx, fx + 32, 0);
+    fx_on = false;
+}
+
+void BytecodePlayer::setDictionary(uint16_t table) {
+    midi_dict = table;
+}
+
+void BytecodePlayer::setDrums(uint16_t table) {
+    fx_kit = table;
+}
+
+void BytecodePlayer::setWaves(uint16_t table) {
+    midi_waves = table;
+}
+
+void BytecodePlayer::setTempo(uint16_t scale) {
+    tempo = (scale < 16) ? 16 : scale;
+}
+
+bool BytecodePlayer::playing() const {
+    return midi_q != 0;
+}
+
+void BytecodePlayer::tick() {
+    charge({OP_PUSH});
+    for (;;) {
+        // .getcmd
+        charge({OP_LDW, OP_PEEK, OP_BCC});
+        uint8_t cmd = peek(midi_p);
+        if (cmd == 0) {
+            charge({OP_LDW, OP_DEEK, OP_BCC});
+            uint16_t w = deek(midi_q);
+            if (w == 0) {
+                // .next 之后没有排队的歌曲：.fin
+                charge({OP_LDWI, OP_XORW, OP_BCC, OP_INC, OP_LD, OP_BCC, OP_LDI, OP_STW, OP_POP, OP_RET});
+                midi_q = 0;
+                return;
+            }
+            charge({OP_STW, OP_INC, OP_INC, OP_SUBI, OP_BCC});
+            midi_p = w;
+            midi_q = incLow(incLow(midi_q));
+            if (w == 1) {
+                // 循环跳转项：标记 1，新的字节码指针，新的指针表位置
+                charge({OP_LDW, OP_DEEK, OP_STW, OP_INC, OP_INC, OP_LDW, OP_DEEK, OP_STW, OP_BRA});
+                midi_p = deek(midi_q);
+                midi_q = deek(incLow(incLow(midi_q)));
+                loop_count++;
+            }
+            continue;
+        }
+        // .docmd
+        charge({OP_INC, OP_STW, OP_SUBI, OP_BCC});
+        midi_p = incLow(midi_p);
+        command_count++;
+        if (cmd < 0x80) {
+            charge({OP_LDWI, OP_XORW, OP_BCC});
+            if (tempo == 256) {
+                charge({OP_LD, OP_ADDV, OP_POP, OP_RET});
+                midi_t += cmd;
+            } else {
+                // .tempo：移位相加乘法，每个 cmd 位一次 .tp1 循环
+                charge({OP_LDWI, OP_XORW, OP_BCC, OP_LDI, OP_STW, OP_STW, OP_LD, OP_LSLW, OP_ORI, OP_ST});
+                charge({OP_LDW, OP_LSLW, OP_STW, OP_LDW, OP_LSLW, OP_STW, OP_LD, OP_ANDI, OP_BCC,
+                        OP_LD, OP_LSLW, OP_ST, OP_LD, OP_XORI, OP_BCC}, 7);
+                for (int bit = 0; bit < 7; ++bit) {
+                    if (cmd & (1 << bit)) charge({OP_LD, OP_ADDW, OP_STW, OP_LD, OP_ADDW, OP_STW});
+                }
+                charge({OP_LD, OP_ADDW, OP_STW, OP_ST, OP_LD, OP_ADDW, OP_ADDW, OP_STW, OP_POP, OP_RET});
+                uint32_t scaled = cmd * static_cast<uint32_t>(tempo) + frac;
+                frac = scaled & 0xff;
+                midi_t += (scaled >> 8) & 0xffff;
+            }
+            song_tick += cmd;
+            return;
+        }
+        // .xcmd：通道寄存器 0x1fa + 256*(cmd&3)，以及 midi_visual() 的通道状态 (.xvis)
+        charge({OP_LDW, OP_ANDI, OP_LSLW, OP_STW, OP_ADDW, OP_DEEK, OP_STW,
+                OP_LDWI, OP_XORW, OP_BCC, OP_LDW, OP_ADDW, OP_STW, OP_LDW, OP_SUBI, OP_BCC});
+        uint16_t chn = static_cast<uint16_t>(0x1fa + 256 * (cmd & 3));
+        if (fx_on) {
+            // .fx_cancel：通道命令结束该通道的效果，P(i)、R() 和效果命令除外
+            charge({OP_LD, OP_BCC, OP_CALLI, OP_LDW, OP_SUBI, OP_BCC});
+            if (cmd < 0xb4) {
+                charge({OP_LDW, OP_LSLW, OP_LSLW, OP_STW, OP_LDWI, OP_ADDW, OP_STW, OP_LDI, OP_POKE});
+                fx[8 * (cmd & 3)] = 0;
+            }
+            charge({OP_RET});
+        } else {
+            charge({OP_LD, OP_BCC});
+        }
+        if (cmd < 0x90) {
+            charge({OP_LDW, OP_ADDI, OP_STW, OP_LDI, OP_DOKE, OP_POKE, OP_BRA});
+            doke(chn + 2, 0);
+            continue;
+        }
+        // .ncmd：cmd-0xb4 >= 0 是短语调用 (0xb4)、短语返回 (0xb5)、波形 (0xb6)、琶音 (0xb8-0xbb)、鼓 (0xbc-0xbf)、
+        // 渐变 (0xc0-0xc7) 或歌曲结束
+        charge({OP_SUBI, OP_JCC});
+        int v = cmd - 0x90 - 0x24;
+        if (v >= 4 && v < 12) {
+            // .midi_fx：琶音记录 (1,r,r,0,n0..n3)，立即设置 n0；
+            // 鼓记录 (2,rate,rate,-,第二步的位置)，立即设置 wavX 和第一步
+            charge({OP_SUBI, OP_BCC, OP_SUBI, OP_BCC, OP_SUBI, OP_BCC, OP_SUBI, OP_BCC,
+                    OP_LDWI, OP_XORW, OP_BCC, OP_LD, OP_ANDI, OP_LSLW, OP_LSLW, OP_LSLW, OP_STW,
+                    OP_LDWI, OP_ADDW, OP_STW, OP_LD, OP_ANDI, OP_BCC});
+            uint8_t* rec = fx + 8 * (cmd & 3);
+            int note;
+            if (v < 8) {
+                charge({OP_LDI, OP_POKE, OP_INC, OP_LDW, OP_PEEK, OP_INC, OP_POKE, OP_INC,
+                        OP_DOKE, OP_INC, OP_INC, OP_LDW, OP_PEEK, OP_STW, OP_POKE, OP_LDW, OP_DEEK, OP_DOKE,
+                        OP_INC, OP_INC, OP_INC, OP_INC, OP_LDW, OP_DEEK, OP_DOKE, OP_INC, OP_INC, OP_BRA});
+                rec[0] = 1;
+                rec[1] = rec[2] = peek(midi_p);
+                rec[3] = 0;
+                midi_p = incLow(midi_p);
+                for (int k = 0; k < 4; ++k) {
+                    rec[4 + k] = peek(midi_p);
+                    midi_p = incLow(midi_p);
+                }
+                note = rec[4];
+            } else {
+                charge({OP_LDW, OP_PEEK, OP_INC, OP_LSLW, OP_ADDW, OP_DEEK, OP_STW,
+                        OP_LDI, OP_POKE, OP_INC, OP_LDW, OP_PEEK, OP_POKE, OP_INC, OP_POKE, OP_INC, OP_INC,
+                        OP_LDW, OP_ADDI, OP_DOKE, OP_LDW, OP_ADDI, OP_STW, OP_LDW, OP_ADDI, OP_PEEK, OP_POKE,
+                        OP_LDW, OP_ADDI, OP_PEEK, OP_STW, OP_POKE, OP_INC, OP_LDW, OP_ADDI, OP_PEEK, OP_POKE, OP_POKE});
+                uint16_t pattern = deek(static_cast<uint16_t>(fx_kit + 2 * peek(midi_p)));
+                midi_p = incLow(midi_p);
+                rec[0] = 2;
+                rec[1] = rec[2] = peek(pattern);
+                rec[4] = static_cast<uint8_t>((pattern + 4) & 0xff);
+                rec[5] = static_cast<uint8_t>((pattern + 4) >> 8);
+                poke(chn + 1, peek(static_cast<uint16_t>(pattern + 1)));
+                poke(chn, peek(static_cast<uint16_t>(pattern + 3)));
+                note = peek(static_cast<uint16_t>(pattern + 2));
+            }
+            charge({OP_LD, OP_BCC});
+            if (!fx_on) {
+                charge({OP_LDI, OP_ST, OP_LD, OP_ADDW, OP_ADDI, OP_STW});
+                fx_on = true;
+                fx_t = frame_count + 1;
+            }
+            charge({OP_CALLI, OP_LDW, OP_ADDI, OP_STW, OP_LDWI, OP_ADDW, OP_ADDW, OP_STW,
+                    OP_LUP, OP_ST, OP_LDW, OP_LUP, OP_ST, OP_LDW, OP_DOKE, OP_BRA});
+            doke(chn + 2, noteKey(note));
+            continue;
+        }
+        if (v >= 12 && v < 20) {
+            // .midi_ramp：渐变记录 (3 或 7,目标,帧数,-,当前值,每帧步长)，音量的当前值为 wavA.128，
+            // 音高的当前值为 keyH*128+keyL
+            charge({OP_SUBI, OP_BCC, OP_SUBI, OP_BCC, OP_SUBI, OP_BCC, OP_SUBI, OP_BCC, OP_SUBI, OP_BCC,
+                    OP_LDWI, OP_XORW, OP_BCC, OP_LD, OP_ANDI, OP_LSLW, OP_LSLW, OP_LSLW, OP_STW,
+                    OP_LDWI, OP_ADDW, OP_STW, OP_LD, OP_ANDI, OP_ORI, OP_POKE, OP_INC,
+                    OP_LDW, OP_DEEK, OP_DOKE, OP_ST, OP_LD, OP_ADDI, OP_ST, OP_INC, OP_INC,
+                    OP_LDW, OP_DEEK, OP_DOKE, OP_INC, OP_INC, OP_LD, OP_SUBI, OP_ST, OP_LD, OP_ANDI, OP_BCC});
+            uint8_t* rec = fx + 8 * (cmd & 3);
+            bool glide = cmd & 4;
+            rec[0] = glide ? 7 : 3;
+            for (int k : {1, 2, 6, 7}) {
+                rec[k] = peek(midi_p);
+                midi_p = incLow(midi_p);
+            }
+            uint16_t value;
+            if (glide) {
+                charge({OP_LD, OP_POKE, OP_LDW, OP_ADDI, OP_PEEK});
+                charge({OP_LSLW}, 7);
+                charge({OP_STW, OP_LDW, OP_ADDI, OP_PEEK, OP_ADDW});
+                value = static_cast<uint16_t>((peek(chn + 3) << 7) + peek(chn + 2));
+            } else {
+                charge({OP_INC, OP_LD, OP_POKE, OP_LDW, OP_PEEK, OP_ST, OP_LDI, OP_ST, OP_LDW, OP_BRA});
+                value = static_cast<uint16_t>((peek(chn) << 8) | 0x80);
+            }
+            rec[4] = static_cast<uint8_t>(value & 0xff);
+            rec[5] = static_cast<uint8_t>(value >> 8);
+            charge({OP_DOKE, OP_LD, OP_BCC});
+            if (!fx_on) {
+                charge({OP_LDI, OP_ST, OP_LD, OP_ADDW, OP_ADDI, OP_STW});
+                fx_on = true;
+                fx_t = frame_count + 1;
+            }
+            charge({OP_CALLI});
+            continue;
+        }
+        if (v == 2) {
+            // .midi_wave：把波形表第 i 项的 64 个采样写入 soundTable 的波形 w，每 4 字节一个
+            charge({OP_SUBI, OP_BCC, OP_SUBI, OP_BCC,
+                    OP_LDW, OP_PEEK, OP_ANDI, OP_ST, OP_LDI, OP_ST, OP_INC, OP_LDW, OP_PEEK, OP_INC,
+                    OP_LSLW, OP_ADDW, OP_DEEK, OP_STW});
+            int w = peek(midi_p) & 3;
+            midi_p = incLow(midi_p);
+            uint16_t samples = deek(static_cast<uint16_t>(midi_waves + 2 * peek(midi_p)));
+            midi_p = incLow(midi_p);
+            charge({OP_LDW, OP_PEEK, OP_POKE, OP_INC, OP_LD, OP_ADDI, OP_ST, OP_ANDI, OP_BCC}, 64);
+            for (int i = 0; i < 64; ++i) {
+                sound_table[4 * i + w] = peek(static_cast<uint16_t>((samples & 0xff00) | ((samples + i) & 0xff)));
+            }
+            charge({OP_CALLI});
+            continue;
+        }
+        if (v >= 3) {
+            charge({OP_SUBI, OP_BCC, OP_SUBI, OP_BCC, OP_SUBI, OP_BCC, OP_LDI, OP_STW, OP_POP, OP_RET});
+            if (v >= 4) charge({OP_SUBI, OP_BCC, OP_SUBI, OP_BCC});
+            midi_q = 0;
+            return;
+        }
+        if (v >= 0) {
+            // .midi_phrase
+            charge({OP_SUBI, OP_BCC, OP_ADDI, OP_BCC});
+            if (v == 0) {
+                charge({OP_LDW, OP_ADDI, OP_STW, OP_LDW, OP_PEEK, OP_LSLW, OP_ADDW, OP_DEEK, OP_STW, OP_CALLI});
+                midi_r = static_cast<uint16_t>(midi_p + 1);
+                midi_p = deek(static_cast<uint16_t>(midi_dict + 2 * peek(midi_p)));
+            } else {
+                charge({OP_LDW, OP_STW, OP_CALLI});
+                midi_p = midi_r;
+            }
+            continue;
+        }
+        // .midi_note：v+0x14 < 0 (N) 只读取音符，0-3 (M) 再读取音量，16-19 (W) 再读取波形
+        charge({OP_ADDI, OP_STW, OP_LDW, OP_PEEK, OP_INC, OP_STW, OP_POKE, OP_LDW, OP_BCC});
+        v += 0x14;
+        int note = peek(midi_p);
+        midi_p = incLow(midi_p);
+        if (v >= 0) {
+            charge({OP_LDW, OP_PEEK, OP_INC, OP_POKE, OP_INC, OP_POKE, OP_LDW, OP_SUBI, OP_BCC});
+            poke(chn, peek(midi_p));
+            midi_p = incLow(midi_p);
+            if (v >= 0x10) {
+                charge({OP_LDW, OP_ADDI, OP_STW, OP_LDW, OP_PEEK, OP_INC, OP_POKE});
+                poke(chn + 1, peek(midi_p));
+                midi_p = incLow(midi_p);
+            }
+        }
+        // .freq
+        charge({OP_LDW, OP_ADDI, OP_STW, OP_LDWI, OP_ADDW, OP_ADDW, OP_STW,
+                OP_LUP, OP_ST, OP_LDW, OP_LUP, OP_ST, OP_LDW, OP_DOKE, OP_BRA});
+        doke(chn + 2, noteKey(note));
+    }
+}
+
+void BytecodePlayer::fxTick() {
+    charge({OP_PUSH, OP_LDI, OP_ST, OP_LDWI, OP_STW, OP_LDWI, OP_STW});
+    fx_on = false;
+    for (int c = 0; c < 4; ++c) {
+        uint8_t* rec = fx + 8 * c;
+        charge({OP_LDW, OP_PEEK, OP_BCC});
+        if (rec[0]) {
+            fx_on = true;
+            charge({OP_ST, OP_SUBI, OP_BCC});
+            if (rec[0] >= 3) {
+                fxRamp(rec, static_cast<uint16_t>(0x1fa + 256 * c));
+                charge({OP_INC, OP_INC, OP_LD, OP_ADDI, OP_ST, OP_ANDI, OP_BCC});
+                continue;
+            }
+            // 从速率倒数，到 0 时进入下一步
+            charge({OP_LDW, OP_ADDI, OP_STW, OP_PEEK, OP_SUBI, OP_POKE, OP_BCC});
+            if (--rec[2] == 0) {
+                charge({OP_LDW, OP_ADDI, OP_PEEK, OP_POKE, OP_INC, OP_LD, OP_XORI, OP_BCC});
+                rec[2] = rec[1];
+                uint16_t chn = static_cast<uint16_t>(0x1fa + 256 * c);
+                int note;
+                if (rec[0] == 1) {
+                    // 琶音：第 4 个之后或遇到音符 0 回到第一个
+                    charge({OP_LDW, OP_PEEK, OP_ADDI, OP_ANDI, OP_STW, OP_LDW, OP_ADDI, OP_ADDW, OP_PEEK, OP_BCC});
+                    int idx = (rec[3] + 1) & 3;
+                    if (rec[4 + idx] == 0) {
+                        charge({OP_STW, OP_LDW, OP_ADDI, OP_PEEK});
+                        idx = 0;
+                    }
+                    rec[3] = static_cast<uint8_t>(idx);
+                    charge({OP_STW, OP_LD, OP_POKE});
+                    note = rec[4 + idx];
+                } else {
+                    // 鼓：下一步的 (音符, wavA)，音符 0 结束，通道保持原样
+                    charge({OP_INC, OP_LDW, OP_DEEK, OP_STW, OP_PEEK, OP_BCC});
+                    uint16_t step = static_cast<uint16_t>(rec[4] | (rec[5] << 8));
+                    if (peek(step) == 0) {
+                        charge({OP_POKE, OP_BRA});
+                        rec[0] = 0;
+                        charge({OP_INC, OP_INC, OP_LD, OP_ADDI, OP_ST, OP_ANDI, OP_BCC});
+                        continue;
+                    }
+                    charge({OP_LDW, OP_ADDI, OP_DOKE, OP_LDW, OP_DEEK, OP_STW, OP_LDW, OP_ADDI, OP_PEEK, OP_POKE,
+                            OP_LDW, OP_PEEK, OP_STW, OP_BRA});
+                    rec[4] = static_cast<uint8_t>((step + 2) & 0xff);
+                    rec[5] = static_cast<uint8_t>((step + 2) >> 8);
+                    poke(chn, peek(static_cast<uint16_t>(step + 1)));
+                    note = peek(step);
+                }
+                charge({OP_LDWI, OP_ADDW, OP_ADDW, OP_STW, OP_LUP, OP_ST, OP_LDW, OP_LUP, OP_ST,
+                        OP_LDW, OP_DEEK, OP_ADDI, OP_STW, OP_LDW, OP_DOKE});
+                doke(static_cast<uint16_t>(chn + 2), noteKey(note));
+            }
+        }
+        charge({OP_INC, OP_INC, OP_LD, OP_ADDI, OP_ST, OP_ANDI, OP_BCC});
+    }
+    charge({OP_LD, OP_ADDW, OP_ADDI, OP_STW, OP_POP, OP_RET});
+    fx_t = frame_count + 1;
+}
+
+void BytecodePlayer::fxRamp(uint8_t* rec, uint16_t chn) {
+    bool glide = rec[0] & 4;
+    charge({OP_LDW, OP_ADDI, OP_STW, OP_PEEK, OP_SUBI, OP_POKE, OP_BCC});
+    if (--rec[2] == 0) {
+        // 最后一帧：设置目标，结束渐变
+        charge({OP_POKE, OP_LDW, OP_ADDI, OP_PEEK, OP_STW, OP_LD, OP_ANDI, OP_BCC});
+        rec[0] = 0;
+        if (glide) {
+            charge({OP_LDWI, OP_ADDW, OP_ADDW, OP_STW, OP_LUP, OP_ST, OP_LDW, OP_LUP, OP_ST,
+                    OP_LDW, OP_DEEK, OP_ADDI, OP_STW, OP_LDW, OP_DOKE});
+            doke(static_cast<uint16_t>(chn + 2), noteKey(rec[1]));
+        } else {
+            charge({OP_LDW, OP_DEEK, OP_STW, OP_LD, OP_POKE, OP_BRA});
+            poke(chn, rec[1]);
+        }
+        return;
+    }
+    charge({OP_LDW, OP_ADDI, OP_DEEK, OP_STW, OP_LD, OP_ADDI, OP_ST, OP_LDW, OP_DEEK, OP_ADDW, OP_DOKE, OP_STW,
+            OP_LDW, OP_DEEK, OP_STW, OP_LD, OP_ANDI, OP_BCC});
+    uint16_t value = static_cast<uint16_t>((rec[4] | (rec[5] << 8)) + (rec[6] | (rec[7] << 8)));
+    rec[4] = static_cast<uint8_t>(value & 0xff);
+    rec[5] = static_cast<uint8_t>(value >> 8);
+    if (glide) {
+        charge({OP_INC, OP_INC, OP_LD, OP_ANDI, OP_POKE, OP_INC, OP_LDW, OP_LSLW, OP_STW, OP_LD, OP_POKE, OP_BRA});
+        poke(static_cast<uint16_t>(chn + 2), value & 0x7f);
+        poke(static_cast<uint16_t>(chn + 3), static_cast<uint8_t>((value << 1) >> 8));
+    } else {
+        charge({OP_LD, OP_POKE, OP_BRA});
+        poke(chn, static_cast<uint8_t>(value >> 8));
+    }
+}
+
+int BytecodePlayer::runFrame() {
+    long before = command_count;
+    frame_cycles = 0;
+    frame_song_tick = song_tick;
+    if (sound_timer > 0) sound_timer--;
+    bool fx_due = fx_on && frame_count - fx_t >= 0;
+    if (midi_q && (frame_count - midi_t >= 0 || fx_due)) {
+        // _vIrqAltHandler：进入、效果步进、每个到期的 tick、等待下一次中断
+        charge({OP_VIRQ, OP_LD, OP_ORW, OP_ORW, OP_BCC, OP_PUSH, OP_LDI, OP_ST, OP_LD, OP_BCC});
+        sound_timer = 255;
+        charge({OP_LDW, OP_BCC, OP_LD, OP_BCC});
+        if (fx_on) {
+            charge({OP_LD, OP_ADDW, OP_SUBW, OP_BCC});
+            if (fx_due) {
+                charge({OP_CALLI});
+                fxTick();
+                charge({OP_BRA});
+            }
+        }
+        for (;;) {
+            charge({OP_LD, OP_ADDW, OP_SUBW, OP_BCC});
+            if (frame_count - midi_t < 0) break;
+            charge({OP_CALLI});
+            tick();
+            // _vBlnAvoid
+            charge({OP_CALLI, OP_LD, OP_BCC, OP_RET, OP_LDW, OP_BCC});
+            if (!midi_q) break;
+        }
+        if (midi_q) {
+            charge({OP_BRA, OP_LDW, OP_BCC, OP_LDW, OP_BCC, OP_LDW, OP_STW, OP_LD, OP_BCC});
+            if (fx_on) {
+                charge({OP_LDW, OP_BCC, OP_LDW, OP_SUBW, OP_BCC});
+                if (fx_t < midi_t) charge({OP_LDW, OP_STW});
+            }
+            charge({OP_LD, OP_ADDW, OP_SUBW, OP_POP, OP_ST, OP_LDW, OP_ST, OP_XORW, OP_BCC,
+                    OP_POP, OP_LDWI, OP_LUP});
+        } else {
+            charge({OP_LDW, OP_BCC, OP_LDW, OP_BCC, OP_LDI, OP_ST, OP_POP, OP_RET});
+            sound_timer = 0;
+        }
+    }
+    frame_count++;
+    return static_cast<int>(command_count - before);
+}
+
+void BytecodePlayer::renderFrame(std::vector<uint8_t>& out) {
+    for (int n = 0; n < LINES_PER_FRAME; ++n) {
+        // 每条扫描线更新一个通道：15 位相位累加器 oscH:oscL(7 位)
+        uint16_t base = static_cast<uint16_t>(256 * ((line & 3) + 1));
+        uint8_t osc_l = static_cast<uint8_t>(peek(base + 0xfe) + peek(base + 0xfc));
+        uint8_t osc_h = static_cast<uint8_t>(peek(base + 0xff) + peek(base + 0xfd) + (osc_l >> 7));
+        poke(base + 0xfe, osc_l & 0x7f);
+        poke(base + 0xff, osc_h);
+        uint8_t v = static_cast<uint8_t>(peek(base + 0xfa) + sound_table[(osc_h & 0xfc) ^ peek(base + 0xfb)]);
+        sample = static_cast<uint8_t>(sample + ((v & 0x80) ? 0x3f : (v & 0x3f)));
+        if ((line & 3) == 3) {
+            out.push_back(sound_timer ? sample : 0);
+            sample = 0;
+        }
+        line = (line + 1) & 3;
+    }
+}
@@ -0,0 +1,144 @@
+#ifndef BYTECODE_PLAYER_H
+#define BYTECODE_PLAYER_H
+
+#include <string>
+#include <map>
+#include <vector>
+#include <cstdint>
+#include <initializer_list>
+
+// 歌曲内存映像：64K 的 Gigatron RAM，以及歌曲指针表的地址
+struct SongImage {
+    std::string name;                          // 歌曲名（指针表的名字）
+    std::vector<uint8_t> ram;                  // 64K RAM 映像
+    uint16_t table;                            // 歌曲指针表地址 (*_midi[])
+    std::map<std::string, uint16_t> symbols;   // 数组名到地址的映射（仅从 C 源码加载时）
+
+    SongImage() : ram(65536, 0), table(0) {}
+};
+
+// 从 gbas_to_c.py 生成的 C 源码加载歌曲，song 为空时使用非 static 的指针表。
+// 多个文件（例如歌曲和 gbas_to_c.py -d 生成的短语字典）按顺序一起加载
+bool loadSongC(const std::string& filename, const std::string& song, SongImage& image, std::string& error);
+bool loadSongC(const std::vector<std::string>& filenames, const std::string& song, SongImage& image, std::string& error);
+
+// 从 .gt1 文件或原始内存转储（加载到 base 地址）加载，table 为歌曲指针表地址
+bool loadSongGt1(const std::string& filename, uint16_t table, SongImage& image, std::string& error);
+bool loadSongRaw(const std::string& filename, uint16_t base, uint16_t table, SongImage& image, std::string& error);
+
+// ROM 中 notesTable 的键值（7.7 定点），note 为 MIDI 音符
+uint16_t noteKey(int note);
+
+// vCPU 指令，用于估算 vIRQ 处理程序的周期数
+enum VcpuOp {
+    OP_LD, OP_LDI, OP_LDW, OP_LDWI, OP_ST, OP_STW, OP_ADDW, OP_SUBW, OP_ADDI, OP_SUBI,
+    OP_ANDI, OP_ORI, OP_XORI, OP_ANDW, OP_ORW, OP_XORW, OP_LSLW, OP_INC, OP_PEEK, OP_POKE, OP_DEEK,
+    OP_DOKE, OP_ADDV, OP_LUP, OP_BCC, OP_JCC, OP_BRA, OP_CALLI, OP_RET, OP_PUSH, OP_POP, OP_VIRQ,
+    OP_COUNT
+};
+
+// 指令名和估计的周期数（dev7 ROM，包括解释器的分派开销；
+// OP_VIRQ 为 ROM 进入和退出中断的开销）
+const char* vcpuOpName(int op);
+int vcpuOpCycles(int op);
+
+// 对照 sound.s 检查周期表：vIRQ 代码（从 _vIrqAltHandler 经跳转、调用和数据标签
+// 可达的 code_* 函数）中每条 vCPU 指令都要有周期估计。没有估计的指令以
+// "行号: 指令" 放入 missing，instructions 为检查过的指令条数。读不到文件时返回 false
+bool checkVcpuCosts(const std::string& filename, int& instructions, std::vector<std::string>& missing,
+                    std::string& error);
+
+// sound.s 中 midi_play 字节码解释器和 Gigatron 4 通道波表声音的主机模型
+class BytecodePlayer {
+public:
+    // 每帧的扫描线数；每条扫描线更新一个通道，每 4 条扫描线输出一个采样
+    static const int LINES_PER_FRAME = 521;
+
+    explicit BytecodePlayer(SongImage& image);
+
+    // 对应 midi_play()：从第 0 帧开始播放
+    void play();
+
+    // 对应 midi_dictionary()：P(i) 命令使用的短语指针表
+    void setDictionary(uint16_t table);
+
+    // 对应 midi_drums()：DRUM(c,i) 命令使用的鼓组指针表
+    void setDrums(uint16_t table);
+
+    // 对应 midi_waves()：WAVE(w,i) 命令使用的波形指针表
+    void setWaves(uint16_t table);
+
+    // 对应 midi_set_tempo()：每个歌曲帧的帧数，8.8 定点
+    void setTempo(uint16_t scale);
+
+    // 对应 midi_playing()
+    bool playing() const;
+
+    // 执行一帧的 vIRQ：运行所有到期的命令，返回本帧执行的命令数
+    int runFrame();
+
+    // 合成一帧的声音，每个采样追加到 out（4 通道之和，0-255）
+    void renderFrame(std::vector<uint8_t>& out);
+
+    // 当前帧号、已执行的命令总数、循环跳转次数
+    long frame() const { return frame_count; }
+    long commands() const { return command_count; }
+    long loops() const { return loop_count; }
+
+    // 上一次 runFrame() 中 vIRQ 用掉的周期数（没有中断时为 0），
+    // 以及它执行的命令所在的歌曲帧（GBAS 中 eatSound_Timer 的 tick）
+    long frameCycles() const { return frame_cycles; }
+    long frameSongTick() const { return frame_song_tick; }
+
+    // 每种 vCPU 指令的执行次数
+    const std::vector<long>& opCounts() const { return op_counts; }
+
+    // 重置声音波形表（soundTable），与 sound_reset_waveforms() 相同
+    void resetWaveforms();
+
+private:
+    SongImage& image;
+    std::vector<uint8_t> sound_table;  // soundTable：4 个波形交错，每个 64 个采样
+    uint16_t midi_p;                   // _midi.p：当前字节码指针
+    uint16_t midi_q;                   // _midi.q：指针表中下一个段的位置
+    uint16_t midi_r;                   // _midi.r：短语结束后返回的位置
+    uint16_t midi_dict;                // _midi.dict：短语指针表
+    uint16_t midi_waves;               // _midi.waves：波形指针表
+    long midi_t;                       // _midi.t：下一次命令到期的帧
+    uint16_t tempo;                    // _midi.tempo
+    uint8_t frac;                      // _midi.frac
+    long frame_count;
+    long command_count;
+    long loop_count;
+    int sound_timer;                   // soundTimer，为 0 时静音
+    int line;                          // 当前扫描线 (0-3 选择通道)
+    uint8_t sample;                    // 4 个通道的累加采样
+    long song_tick;                    // 未经速度缩放的延时之和
+    long frame_cycles;
+    long frame_song_tick;
+    std::vector<long> op_counts;
+    uint8_t fx[32];                    // _fx.data：每个通道 8 字节的效果记录（类型、速率、计数，琶音的序号和 4 个音符，或鼓的下一步位置；
+                                       // 渐变为类型、目标、剩余帧数、-、当前值、步长）
+    bool fx_on;                        // _fx.on
+    long fx_t;                         // _fx.t：下一次效果步进的帧
+    uint16_t fx_kit;                   // _fx.kit：鼓组指针表
+
+    // 记录一段 vCPU 指令序列的周期
+    void charge(std::initializer_list<VcpuOp> ops, int times = 1);
+
+    uint8_t peek(uint16_t addr) const { return image.ram[addr]; }
+    uint16_t deek(uint16_t addr) const;
+    void poke(uint16_t addr, uint8_t value) { image.ram[addr] = value; }
+    void doke(uint16_t addr, uint16_t value);
+
+    // 与 sound.s 中 .midi_tick 相同：执行命令直到遇到延时或歌曲结束
+    void tick();
+
+    // 与 sound.s 中 .fx_tick 相同：每帧步进一次各通道的效果
+    void fxTick();
+
+    // 与 sound.s 中 .fxr 相同：渐变的一帧，chn 为通道寄存器
+    void fxRamp(uint8_t* rec, uint16_t chn);
+};
+
+#endif // BYTECODE_PLAYER_H
@@ -0,0 +1,378 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "bytecode_player.h"
+
+// WAV 采样率：Gigatron 每 4 条扫描线输出一个采样 (31250/4 = 7812.5 Hz)，
+// 每个采样写两次得到整数采样率 15625 Hz
+static const int WAV_RATE = 15625;
+
+static void put16(std::ofstream& f, uint16_t v) {
+    f.put(static_cast<char>(v & 0xff));
+    f.put(static_cast<char>(v >> 8));
+}
+
+static void put32(std::ofstream& f, uint32_t v) {
+    put16(f, v & 0xffff);
+    put16(f, v >> 16);
+}
+
+static bool writeWav(const std::string& filename, const std::vector<uint8_t>& samples, bool full) {
+    std::ofstream f(filename, std::ios::binary);
+    if (!f.is_open()) return false;
+    uint32_t n = static_cast<uint32_t>(samples.size() * 2);
+    f.write("RIFF", 4);
+    put32(f, 36 + n);
+    f.write("WAVEfmt ", 8);
+    put32(f, 16);
+    put16(f, 1);          // PCM
+    put16(f, 1);          // 单声道
+    put32(f, WAV_RATE);
+    put32(f, WAV_RATE);   // 字节率
+    put16(f, 1);
+    put16(f, 8);          // 8 位无符号
+    f.write("data", 4);
+    put32(f, n);
+    for (uint8_t s : samples) {
+        // 硬件只输出高 4 位
+        char c = static_cast<char>(full ? s : (s & 0xf0));
+        f.put(c);
+        f.put(c);
+    }
+    return f.good();
+}
+
+// vIRQ 用掉周期的一帧
+struct FrameCost {
+    long frame;
+    long song_tick;
+    long cycles;
+    int commands;
+};
+
+// 打印每帧周期的分布、最差的几帧和 vCPU 指令统计
+static void printProfile(const std::vector<FrameCost>& costs, const std::vector<long>& ops, long frames, int worst) {
+    if (costs.empty()) {
+        std::cout << "  no vIRQ frames" << std::endl;
+        return;
+    }
+    long total = 0;
+    long peak = 0;
+    for (const FrameCost& c : costs) {
+        total += c.cycles;
+        peak = std::max(peak, c.cycles);
+    }
+    std::cout << "  vIRQ frames: " << costs.size() << " of " << frames
+              << ", cycles mean " << total / static_cast<long>(costs.size())
+              << ", max " << peak << ", total " << total << std::endl;
+
+    // 分布：以 250 周期为一档
+    const long step = 250;
+    std::vector<long> buckets(peak / step + 1, 0);
+    for (const FrameCost& c : costs) buckets[c.cycles / step]++;
+    std::cout << "  cycles per vIRQ frame:" << std::endl;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        if (!buckets[i]) continue;
+        std::cout << "    " << std::setw(6) << i * step << "-" << std::setw(6) << (i + 1) * step - 1
+                  << ": " << std::setw(7) << buckets[i] << std::endl;
+    }
+
+    std::vector<FrameCost> sorted = costs;
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const FrameCost& a, const FrameCost& b) { return a.cycles > b.cycles; });
+    if (static_cast<int>(sorted.size()) > worst) sorted.resize(worst);
+    std::cout << "  worst frames (frame, song tick, commands, cycles):" << std::endl;
+    for (const FrameCost& c : sorted) {
+        std::cout << "    " << std::setw(7) << c.frame << std::setw(8) << c.song_tick
+                  << std::setw(5) << c.commands << std::setw(7) << c.cycles << std::endl;
+    }
+
+    long op_total = 0;
+    for (int op = 0; op < OP_COUNT; ++op) op_total += ops[op] * vcpuOpCycles(op);
+    std::cout << "  vCPU instructions (count, cycles, share):" << std::endl;
+    for (int op = 0; op < OP_COUNT; ++op) {
+        if (!ops[op]) continue;
+        long cycles = ops[op] * vcpuOpCycles(op);
+        std::cout << "    " << std::left << std::setw(6) << vcpuOpName(op) << std::right
+                  << std::setw(10) << ops[op] << std::setw(11) << cycles
+                  << std::setw(6) << (op_total ? cycles * 100 / op_total : 0) << "%" << std::endl;
+    }
+}
+
+// 两个歌曲映像中 4 个通道的寄存器 (wavA, wavX, keyL, keyH) 是否相同，不同时返回通道号 1-4。
+// tolerance > 0 时 wavA 可以相差 tolerance，频率可以相差一个半音（FADE/GLIDE 的近似）
+static int compareChannels(const SongImage& a, const SongImage& b, long tolerance) {
+    for (int c = 0; c < 4; ++c) {
+        uint16_t addr = static_cast<uint16_t>(0x1fa + 256 * c);
+        if (tolerance == 0) {
+            for (int i = 0; i < 4; ++i) {
+                if (a.ram[addr + i] != b.ram[addr + i]) return c + 1;
+            }
+            continue;
+        }
+        if (std::abs(a.ram[addr] - b.ram[addr]) > tolerance || a.ram[addr + 1] != b.ram[addr + 1]) return c + 1;
+        int key_a = a.ram[addr + 3] * 128 + a.ram[addr + 2];
+        int key_b = b.ram[addr + 3] * 128 + b.ram[addr + 2];
+        if ((key_a == 0) != (key_b == 0)) return c + 1;
+        if (key_a && std::fabs(12.0 * std::log2(static_cast<double>(key_a) / key_b)) > 1.0) return c + 1;
+    }
+    return 0;
+}
+
+static bool parseNumber(const std::string& text, long& value) {
+    try {
+        size_t used = 0;
+        value = std::stol(text, &used, 0);
+        return used == text.size();
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+static std::string baseName(const std::string& path) {
+    std::string name = path;
+    size_t slash = name.find_last_of("/\\");
+    if (slash != std::string::npos) name = name.substr(slash + 1);
+    for (const char* ext : {".gbas.c", ".c", ".gt1", ".bin"}) {
+        size_t n = std::char_traits<char>::length(ext);
+        if (name.size() > n && name.compare(name.size() - n, n, ext) == 0) {
+            return name.substr(0, name.size() - n);
+        }
+    }
+    return name;
+}
+
+static bool endsWith(const std::string& s, const std::string& tail) {
+    return s.size() >= tail.size() && s.compare(s.size() - tail.size(), tail.size(), tail) == 0;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> inputs;
+    std::string output_file;
+    std::string song;
+    std::string compare_file;
+    std::string dict_file;
+    std::string check_file;
+    long table = -1;
+    long base = 0;
+    long tempo = 256;
+    long max_loops = 1;
+    long max_seconds = 600;
+    bool full = false;
+    bool no_wav = false;
+    bool profile = false;
+    long budget = 0;
+    long worst = 10;
+    long tolerance = 0;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        long v;
+        if (arg == "-o" && i + 1 < argc) {
+            output_file = argv[++i];
+        } else if (arg == "-song" && i + 1 < argc) {
+            song = argv[++i];
+        } else if (arg == "-compare" && i + 1 < argc) {
+            compare_file = argv[++i];
+        } else if (arg == "-dict" && i + 1 < argc) {
+            dict_file = argv[++i];
+        } else if (arg == "-check" && i + 1 < argc) {
+            check_file = argv[++i];
+        } else if ((arg == "-table" || arg == "-base" || arg == "-tempo" || arg == "-loops" || arg == "-seconds" ||
+                    arg == "-budget" || arg == "-worst" || arg == "-tolerance") && i + 1 < argc) {
+            if (!parseNumber(argv[++i], v) || v < 0) {
+                std::cerr << "Error: Invalid " << arg << " argument '" << argv[i] << "'." << std::endl;
+                return 1;
+            }
+            if (arg == "-table") table = v;
+            else if (arg == "-base") base = v;
+            else if (arg == "-tempo") tempo = v;
+            else if (arg == "-loops") max_loops = v;
+            else if (arg == "-budget") budget = v;
+            else if (arg == "-worst") worst = v;
+            else if (arg == "-tolerance") tolerance = v;
+            else max_seconds = v;
+        } else if (arg == "-full") {
+            full = true;
+        } else if (arg == "-profile") {
+            profile = true;
+        } else if (arg == "-n") {
+            no_wav = true;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Error: Unknown option '" << arg << "'" << std::endl;
+            return 1;
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    // -check：周期表必须覆盖 sound.s 的 vIRQ 代码中的每条指令，否则 -profile 的估算会悄悄失真
+    if (!check_file.empty()) {
+        int instructions = 0;
+        std::vector<std::string> missing;
+        std::string error;
+        if (!checkVcpuCosts(check_file, instructions, missing, error)) {
+            std::cerr << "Error: " << check_file << ": " << error << std::endl;
+            return 1;
+        }
+        for (const std::string& m : missing) {
+            std::cerr << "Error: " << check_file << ":" << m << " has no cycle cost in bytecode_player.cpp" << std::endl;
+        }
+        if (!missing.empty()) return 1;
+        std::cout << check_file << ": " << instructions << " vIRQ instructions, all with cycle costs" << std::endl;
+        if (inputs.empty()) return 0;
+    }
+
+    if (inputs.empty()) {
+        std::cerr << "Usage: " << argv[0] << " <song.gbas.c|song.gt1|song.bin>... [options]" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Plays the midi_play bytecode like sound.s and renders the 4-channel output to WAV." << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Options:" << std::endl;
+        std::cerr << "  -o <file.wav>      Output file (single input only, default: <song>.wav)" << std::endl;
+        std::cerr << "  -n                 Do not write WAV files, only check and report" << std::endl;
+        std::cerr << "  -song <name>       Song table in a C file (default: the non-static pointer table)" << std::endl;
+        std::cerr << "  -dict <file.c>     Phrase dictionary the songs were converted with (gbas_to_c.py -d)" << std::endl;
+        std::cerr << "  -table <addr>      Song table address for .gt1 and .bin inputs" << std::endl;
+        std::cerr << "  -base <addr>       Load address of a .bin memory dump (default: 0)" << std::endl;
+        std::cerr << "  -tempo <scale>     Frames per song frame, 8.8 fixed point (default: 256)" << std::endl;
+        std::cerr << "  -loops <n>         Stop a looping song after n loop-backs (default: 1)" << std::endl;
+        std::cerr << "  -seconds <n>       Stop after n seconds (default: 600)" << std::endl;
+        std::cerr << "  -full              Write the 8-bit channel sum instead of the 4-bit output" << std::endl;
+        std::cerr << "  -profile           Report estimated vCPU cycles of the vIRQ handler per frame" << std::endl;
+        std::cerr << "  -worst <n>         Number of worst frames in the profile (default: 10)" << std::endl;
+        std::cerr << "  -budget <cycles>   Fail when a vIRQ frame needs more cycles than this" << std::endl;
+        std::cerr << "  -compare <file.c>  Fail unless the channel registers match this song's on every frame" << std::endl;
+        std::cerr << "  -tolerance <n>     Let -compare accept wavA off by n and keys off by a semitone (gbas_to_c.py -r)" << std::endl;
+        std::cerr << "  -check <sound.s>   Fail unless every instruction of the vIRQ code in sound.s has a cycle cost" << std::endl;
+        return 1;
+    }
+    if (!output_file.empty() && inputs.size() > 1) {
+        std::cerr << "Error: -o needs a single input file." << std::endl;
+        return 1;
+    }
+
+    int failures = 0;
+    for (const std::string& input : inputs) {
+        SongImage image;
+        std::string error;
+        bool loaded;
+        if (endsWith(input, ".gt1") || endsWith(input, ".bin")) {
+            if (table < 0) {
+                std::cerr << "Error: " << input << " needs -table <addr>." << std::endl;
+                return 1;
+            }
+            loaded = endsWith(input, ".gt1")
+                ? loadSongGt1(input, static_cast<uint16_t>(table), image, error)
+                : loadSongRaw(input, static_cast<uint16_t>(base), static_cast<uint16_t>(table), image, error);
+            image.name = baseName(input);
+        } else if (!dict_file.empty()) {
+            loaded = loadSongC(std::vector<std::string>{input, dict_file}, song, image, error);
+            if (loaded && !image.symbols.count(baseName(dict_file))) {
+                error = "no dictionary named " + baseName(dict_file) + " in " + dict_file;
+                loaded = false;
+            }
+        } else {
+            loaded = loadSongC(input, song, image, error);
+        }
+        if (!loaded) {
+            std::cerr << "Error: " << input << ": " << error << std::endl;
+            failures++;
+            continue;
+        }
+
+        // -compare：同时播放参考歌曲（例如 gbas_to_c.py -n 的输出），逐帧比较通道寄存器
+        SongImage reference;
+        if (!compare_file.empty() && !loadSongC(compare_file, song, reference, error)) {
+            std::cerr << "Error: " << compare_file << ": " << error << std::endl;
+            return 1;
+        }
+        BytecodePlayer reference_player(reference);
+        reference_player.setTempo(static_cast<uint16_t>(tempo));
+        long mismatch_frame = -1;
+        int mismatch_channel = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        BytecodePlayer player(image);
+        player.setTempo(static_cast<uint16_t>(tempo));
+        if (!dict_file.empty()) player.setDictionary(image.symbols[baseName(dict_file)]);
+        // 鼓组和波形表：-d 时由字典文件共用，否则跟随歌曲
+        std::string tables = dict_file.empty() ? image.name : baseName(dict_file);
+        if (image.symbols.count(tables + "_drums")) player.setDrums(image.symbols[tables + "_drums"]);
+        if (image.symbols.count(tables + "_waves")) player.setWaves(image.symbols[tables + "_waves"]);
+        player.play();
+        if (!compare_file.empty()) reference_player.play();
+        std::vector<uint8_t> samples;
+        std::vector<FrameCost> costs;
+        long max_frames = max_seconds * 60;
+        while (player.playing() && player.loops() < max_loops && player.frame() < max_frames) {
+            long frame = player.frame();
+            int commands = player.runFrame();
+            if (player.frameCycles()) {
+                costs.push_back({frame, player.frameSongTick(), player.frameCycles(), commands});
+            }
+            if (!no_wav) player.renderFrame(samples);
+            if (!compare_file.empty() && mismatch_frame < 0) {
+                reference_player.runFrame();
+                mismatch_channel = compareChannels(image, reference, tolerance);
+                if (mismatch_channel || player.playing() != reference_player.playing()) mismatch_frame = frame;
+            }
+        }
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        long frames = player.frame();
+        std::cout << image.name << ": " << frames << " frames (" << frames / 3600 << ":"
+                  << (frames / 60) % 60 / 10 << (frames / 60) % 10 << "), "
+                  << player.commands() << " commands, " << player.loops() << " loops";
+        if (player.playing() && player.loops() < max_loops) {
+            std::cout << ", cut at " << max_seconds << "s";
+        }
+        if (elapsed > 0) {
+            std::cout << ", " << static_cast<long>(frames / 60.0 / elapsed) << "x real time";
+        }
+        std::cout << std::endl;
+
+        if (profile) printProfile(costs, player.opCounts(), frames, static_cast<int>(worst));
+        if (budget > 0) {
+            long over = 0;
+            for (const FrameCost& c : costs) {
+                if (c.cycles <= budget) continue;
+                if (!over++) {
+                    std::cerr << "Error: " << image.name << ": frame " << c.frame << " (song tick " << c.song_tick
+                              << ") needs " << c.cycles << " cycles, budget is " << budget << std::endl;
+                }
+            }
+            if (over) {
+                std::cerr << "Error: " << image.name << ": " << over << " frames over the cycle budget" << std::endl;
+                failures++;
+            }
+        }
+
+        if (!compare_file.empty()) {
+            if (mismatch_frame >= 0) {
+                std::cerr << "Error: " << image.name << ": differs from " << compare_file << " at frame " << mismatch_frame;
+                if (mismatch_channel) std::cerr << " on channel " << mismatch_channel;
+                std::cerr << std::endl;
+                failures++;
+            } else {
+                std::cout << "  same channel registers as " << compare_file << " on all " << frames << " frames" << std::endl;
+            }
+        }
+
+        if (!no_wav) {
+            std::string wav = output_file.empty() ? baseName(input) + ".wav" : output_file;
+            if (!writeWav(wav, samples, full)) {
+                std::cerr << "Error: Could not write " << wav << std::endl;
+                failures++;
+            }
+        }
+    }
+    return failures ? 1 : 0;
+}
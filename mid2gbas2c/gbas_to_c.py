@@ -1,6 +1,9 @@
 import re
 import os
 import sys
+import math
+import heapq
+import argparse
 
 C_MACROS = """
 #define D(x) x                     /* wait x frames */
@@ -8,68 +11,103 @@ C_MACROS = """
 #define N(c,n) 143+(c),(n)         /* channel c on, note=n */
 #define M(c,n,v) 159+(c),(n),(v)   /* channel c on, note=n, wavA=v */
 #define W(c,n,v,w) 175+(c),(n),(v),(w)   /* channel c on, note=n, wavA=v ,wavX=w*/
+#define P(i) 180,(i)               /* play phrase i of the dictionary */
+#define R() 181                    /* return from a phrase */
+#define A(c,r,a,b,d,e) 183+(c),(r),(a),(b),(d),(e) /* channel c arpeggio a,b,d,e every r frames */
+#define DRUM(c,i) 187+(c),(i)      /* channel c plays pattern i of the drum kit */
+#define WAVE(w,i) 182,(w),(i)      /* load entry i of the wave table into waveform w */
+#define FADE(c,v,f,s) 191+(c),(v),(f),(s)&255,((s)>>8)&255 /* channel c wavA to v in f frames, step s/256 a frame */
+#define GLIDE(c,n,f,s) 195+(c),(n),(f),(s)&255,((s)>>8)&255 /* channel c key to note n in f frames, step s a frame */
 #define byte unsigned char
 #define nohop __attribute__((nohop))
 """
 
 MAX_ARRAY_SIZE = 250 # Max bytes per array, including the terminating 0
+FRAMES_PER_SECOND = 60 # eatSound_Timer ticks are video frames
 
-def get_command_byte_size(command_str):
-    if command_str.startswith("D("):
-        return 1
-    elif command_str.startswith("X("):
-        return 1
-    elif command_str.startswith("N("):
-        return 2
-    elif command_str.startswith("M("):
-        return 3
-    elif command_str.startswith("W("):
-        return 4
-    return 0 # Should not happen for valid commands
-
-def parse_gbas(gbas_content, base_filename, original_input_filename):
-    all_c_arrays = []
-    array_names = []
-    
-    music_data_started = False
-    last_tick_sum = 0
-    
-    current_array_index = 0
-    all_array_definitions = []
-    array_names_for_pointer = []
-    total_mem_size = 0
-    
+COMMAND_SIZES = {'X': 1, 'N': 2, 'M': 3, 'W': 4, 'P': 2, 'A': 6, 'DRUM': 2, 'WAVE': 3, 'FADE': 5, 'GLIDE': 5} # bytes, D(x) is 1
+MAX_PHRASES = 256 # P(i) takes a one-byte index
+MAX_PHRASE_COMMANDS = 24 # longest phrase considered, in commands
+MAX_DRUMS = 256 # DRUM(c,i) takes a one-byte index
+MAX_WAVES = 256 # WAVE(w,i) takes a one-byte index
+WAVE_SAMPLES = 64 # samples of a waveform in soundTable
+
+def note_key(note):
+    """Frequency key of a note as keyH*128+keyL, like notesTable, 0 if out of range."""
+    if note - 12 <= 0:
+        return 0
+    key = int(32768 * 440 * 2 ** ((note - 12 - 57) / 12) / 7812.5 + 0.5)
+    return key if key <= 0x7fff else 0
+
+def keyframe_record(time, seg, off, state, waves):
+    # (timeL,timeH,seg,off) then (note,wavA,wavX) per channel, then a
+    # (slot,index) pair for each slot holding a WAVE upload and 255,
+    # read by midi_seek
+    rec = [time & 255, (time >> 8) & 255, seg, off]
+    for note, vol_c, wave in state:
+        rec += [note, vol_c, wave]
+    for slot, index in enumerate(waves):
+        if index is not None:
+            rec += [slot, index]
+    return rec + [255]
+
+def parse_program(gbas_content, keyframe_seconds=0):
+    """Parse the music_data proc into a typed instruction list.
+
+    Commands are ('D', frames), ('X', ch), ('W', ch, note, vol_c, wave)
+    and ('WAVE', slot, samples) for a waveform upload.
+    Markers are ('LOOP',) where the loop body starts, ('GOTO',) for the
+    loop-back and ('KEY', time, state, waves) after the delay reaching a
+    keyframe, with the samples uploaded to each slot so far (None before
+    the first upload).
+    """
+    program = []
     music_data_started = False
     last_tick_sum = 0
-    
-    current_array_lines = [] # Stores lines for the current static const byte array
-    current_array_byte_size = 0 # Tracks byte size of commands in current_array_lines
-    current_line_commands = [] # Stores commands for the current output line
-    current_line_byte_size = 0 # Tracks byte size of commands in current_line_commands
 
-    MAX_COMMANDS_PER_LINE = 10 # User requested 10 commands per line
-    
+    # Keyframes: channel state (note,wavA,wavX) before the commands of a tick,
+    # placed after the delay that reaches the tick. Channels start off with
+    # the registers left by sound_reset(1).
+    channel_state = [[0, 0, 1] for _ in range(4)]
+    slot_waves = [None] * 4
+    keyframe_frames = keyframe_seconds * FRAMES_PER_SECOND
+    if keyframe_frames > 0:
+        program.append(('KEY', 0, [tuple(c) for c in channel_state], tuple(slot_waves)))
+        next_keyframe = keyframe_frames
+
     # Regular expressions for parsing
     eat_sound_timer_re = re.compile(r"^\s*call eatSound_Timer,(\d+)\s*$")
     beep_re = re.compile(r"^\s*call beep,(\d+),(\d+),(\d+),(\d+),(\d+)\s*$")
-    
+    loop_label_re = re.compile(r"^loop:\s*$")
+    tick_sum_re = re.compile(r"^\s*tick_sum=(\d+)\s*$")
+    goto_loop_re = re.compile(r"^\s*goto loop\s*$")
+    wave_re = re.compile(r"^\s*'wave ([0-3]),((?:\d+,){%d}\d+)\s*$" % (WAVE_SAMPLES - 1))
+
+    loop_seen = False
     for line in gbas_content.splitlines():
         if "proc music_data '先定时，再演奏，一次性演奏4个通道" in line:
             music_data_started = True
-            array_name = f"{base_filename}{current_array_index:03d}"
-            array_names_for_pointer.append(array_name)
-            current_array_lines.append(f"nohop static const byte {array_name}[] = {{")
             continue
-        
+
         if not music_data_started:
             continue
-            
+
         # Stop parsing at 'endproc' for music_data
         if "endproc" in line:
             break
 
-        command_str = None
-        command_byte_size = 0
+        if loop_label_re.match(line):
+            program.append(('LOOP',))
+            loop_seen = True
+            continue
+        match_tick_sum = tick_sum_re.match(line)
+        if match_tick_sum and loop_seen:
+            # the converter restored the channels, continue the body timing
+            last_tick_sum = int(match_tick_sum.group(1))
+            continue
+        if goto_loop_re.match(line) and loop_seen:
+            program.append(('GOTO',))
+            continue
 
         # Parse eatSound_Timer
         match_timer = eat_sound_timer_re.match(line)
@@ -77,9 +115,21 @@ def parse_gbas(gbas_content, base_filename, original_input_filename):
             current_tick_sum = int(match_timer.group(1))
             delay = current_tick_sum - last_tick_sum
             if delay > 0:
-                command_str = f"D({delay})"
-                command_byte_size = get_command_byte_size(command_str)
+                program.append(('D', delay))
             last_tick_sum = current_tick_sum
+            if keyframe_frames > 0 and current_tick_sum >= next_keyframe:
+                program.append(('KEY', current_tick_sum, [tuple(c) for c in channel_state], tuple(slot_waves)))
+                while next_keyframe <= current_tick_sum:
+                    next_keyframe += keyframe_frames
+            continue
+
+        # Waveform upload written by midi_converter for harmonics= and samples=
+        match_wave = wave_re.match(line)
+        if match_wave:
+            samples = tuple(min(63, int(x)) for x in match_wave.group(2).split(','))
+            program.append(('WAVE', int(match_wave.group(1)), samples))
+            slot_waves[int(match_wave.group(1))] = samples
+            continue
 
         # Parse beep
         match_beep = beep_re.match(line)
@@ -94,43 +144,740 @@ def parse_gbas(gbas_content, base_filename, original_input_filename):
             # GBAS volume is 0-63.
             # If GBAS volume is 0, it means note off.
             if vol_gbas == 0:
-                command_str = f"X({ch})"
-                command_byte_size = get_command_byte_size(command_str)
+                program.append(('X', ch))
+                channel_state[ch - 1][0] = 0
             else:
                 vol_c = 127 - vol_gbas
                 # Ensure volume is within 64-127 range
                 vol_c = max(64, min(127, vol_c))
-                command_str = f"W({ch},{note},{vol_c},{wave})"
-                command_byte_size = get_command_byte_size(command_str)
-        
-        if command_str:
-            # Check if adding this command to the current line or array would exceed limits
-            # +1 for the terminating 0
-            if (current_array_byte_size + current_line_byte_size + command_byte_size + 1 > MAX_ARRAY_SIZE) or \
-               (len(current_line_commands) >= MAX_COMMANDS_PER_LINE):
-                
-                # Flush current line buffer to current_array_lines
-                if current_line_commands:
-                    current_array_lines.append("  " + ",".join(current_line_commands) + ",")
-                    current_array_byte_size += current_line_byte_size
-                    current_line_commands = []
-                    current_line_byte_size = 0
-
-                # If array still too big, close current array and start new one
-                if current_array_byte_size + command_byte_size + 1 > MAX_ARRAY_SIZE:
-                    current_array_lines.append("  0") # Terminate current array
-                    current_array_lines.append("};")
-                    all_array_definitions.append("\n".join(current_array_lines))
-                    
-                    current_array_index += 1
-                    array_name = f"{base_filename}{current_array_index:03d}"
-                    array_names_for_pointer.append(array_name)
-                    current_array_lines = [f"nohop static const byte {array_name}[] = {{"]
-                    current_array_byte_size = 0
-            
-            current_line_commands.append(command_str)
-            current_line_byte_size += command_byte_size
-            
+                program.append(('W', ch, note, vol_c, wave))
+                channel_state[ch - 1] = [note, vol_c, wave]
+    return program
+
+def parse_drums(gbas_content):
+    """Drum patterns declared by midi_converter -drumkit.
+
+    A line 'drum id,rate,wave,note,vol,note,vol,... declares the steps a
+    drum hit plays, one (note,vol) every rate frames. Returns them as
+    (rate, wave, ((note, vol_c), ...)) with the volumes as wavA values.
+    """
+    drum_re = re.compile(r"^\s*'drum (\d+),(\d+),(\d+)((?:,\d+,\d+)+)\s*$")
+    patterns = []
+    for line in gbas_content.splitlines():
+        match = drum_re.match(line)
+        if not match:
+            continue
+        values = [int(x) for x in match.group(4)[1:].split(',')]
+        steps = tuple((values[i], max(64, min(127, 127 - values[i + 1]))) for i in range(0, len(values), 2))
+        rate = int(match.group(2))
+        if 0 < rate <= 255 and all(0 < note < 128 for note, _ in steps):
+            patterns.append((rate, int(match.group(3)), steps))
+    return patterns
+
+def optimize_program(program):
+    """Peephole pass over a parsed program.
+
+    Within a frame only the register state each channel ends with is
+    audible, so the commands of a frame are replaced by the shortest
+    command taking each channel there from its state at the frame start:
+    nothing if it is unchanged, N(c,n) if only the note changes, M(c,n,v)
+    if the wave is unchanged, otherwise W. This drops note-offs followed by
+    a note-on and note-offs of silent channels. Delays that end up adjacent
+    are merged. The state of a channel is unknown until its first W and at
+    the loop start, which is also reached from the end of the song.
+    """
+    out = []
+    regs = [None] * 4    # (note or 0, wavA, wavX) at the frame start, None = unknown
+    frame = []
+
+    def flush_frame():
+        end = {}
+        last_note = {}
+        for cmd in frame:
+            ch = cmd[1]
+            start = end.get(ch, regs[ch - 1])
+            if cmd[0] == 'X':
+                end[ch] = (0, start[1], start[2]) if start else (0, None, None)
+            else:
+                end[ch] = cmd[2:]
+                last_note[ch] = cmd[2]
+        for ch, new in end.items():
+            old = regs[ch - 1]
+            if new[0] == 0:
+                if old is None or old[1:] != new[1:]:
+                    # a W and an X in the same frame: keep the registers the W set
+                    if new[1] is not None:
+                        out.append(('W', ch, last_note[ch], new[1], new[2]))
+                    out.append(('X', ch))
+                elif old[0] != 0:
+                    out.append(('X', ch))
+            elif old != new:
+                if old is not None and old[1:] == new[1:]:
+                    out.append(('N', ch, new[0]))
+                elif old is not None and old[2] == new[2]:
+                    out.append(('M', ch, new[0], new[1]))
+                else:
+                    out.append(('W', ch) + new)
+            regs[ch - 1] = new
+        frame.clear()
+
+    for ins in program:
+        if ins[0] in ('X', 'W'):
+            frame.append(ins)
+            continue
+        flush_frame()
+        if ins[0] == 'D' and out and out[-1][0] == 'D':
+            out[-1] = ('D', out[-1][1] + ins[1])
+        else:
+            out.append(ins)
+        if ins[0] == 'LOOP':
+            regs = [None] * 4
+    flush_frame()
+    return out
+
+def arpeggiate_program(program):
+    """Replace arpeggios of an optimized program by A(c,r,n0,n1,n2,n3).
+
+    A channel that cycles through 2..4 notes with one N(c,n) every r frames
+    is stepped by the vIRQ instead: A sets n0 and takes the next note every
+    r frames until the next command of the channel. A run is replaced when
+    that command comes no later than the step after the last note of the
+    run, no marker lies in between, and the song gets shorter. A run that
+    starts with M or W keeps it and puts A after it.
+    """
+    times = []
+    markers = [] # markers before each instruction
+    t = 0
+    count = 0
+    for ins in program:
+        times.append(t)
+        markers.append(count)
+        if ins[0] == 'D':
+            t += ins[1]
+        elif ins[0] not in COMMAND_SIZES:
+            count += 1
+
+    channels = {}
+    for i, ins in enumerate(program):
+        if ins[0] in ('X', 'N', 'M', 'W', 'DRUM'):
+            channels.setdefault(ins[1], []).append(i)
+
+    removed = set()
+    arps = {} # instruction index -> A command replacing it or following it
+    for ch, cmds in channels.items():
+        p = 0
+        while p < len(cmds):
+            first = program[cmds[p]]
+            if first[0] in ('X', 'DRUM') or p + 1 >= len(cmds) or program[cmds[p + 1]][0] != 'N':
+                p += 1
+                continue
+            t0 = times[cmds[p]]
+            rate = times[cmds[p + 1]] - t0
+            notes = [first[2]]
+            q = p + 1
+            while (0 < rate <= 255 and q < len(cmds) and program[cmds[q]][0] == 'N' and
+                   times[cmds[q]] == t0 + len(notes) * rate):
+                notes.append(program[cmds[q]][2])
+                q += 1
+            best = None
+            for period in (2, 3, 4):
+                m = period
+                while m < len(notes) and notes[m] == notes[m % period]:
+                    m += 1
+                if m > len(notes):
+                    continue
+                # the command ending the arpeggio must come by its next step
+                if p + m < len(cmds) and times[cmds[p + m]] <= t0 + m * rate:
+                    end = p + m
+                else:
+                    m -= 1
+                    end = p + m
+                if end >= len(cmds) or m < 2 or markers[cmds[end]] != markers[cmds[p]]:
+                    continue
+                saving = 2 * (m - 1) + (2 if first[0] == 'N' else 0) - COMMAND_SIZES['A']
+                if saving > 0 and (best is None or saving > best[0]):
+                    best = (saving, m, period)
+            if best is None:
+                p += 1
+                continue
+            _, m, period = best
+            cycle = notes[:period] + [0] * (4 - period)
+            arps[cmds[p]] = ('A', ch, rate) + tuple(cycle)
+            removed.update(cmds[p + 1:p + m])
+            if first[0] == 'N':
+                removed.add(cmds[p])
+            p += m
+
+    out = []
+    for i, ins in enumerate(program):
+        if i not in removed:
+            if ins[0] == 'D' and out and out[-1][0] == 'D':
+                out[-1] = ('D', out[-1][1] + ins[1])
+            else:
+                out.append(ins)
+        if i in arps:
+            out.append(arps[i])
+    return out
+
+def drum_program(program, patterns, kit):
+    """Replace drum hits of an optimized program by DRUM(c,i).
+
+    A channel command that sets the first step of a declared pattern, and
+    the commands that set its next steps every rate frames, become one
+    DRUM(c,i) stepped by the vIRQ. Frames where a step does not change
+    the channel need no command. The pattern may stop early at a command
+    of the channel before its next step, or at that step when the command
+    also sets wavA. No marker may lie within the pattern. A hit cut at a
+    step by a note-off can use the steps before it, so the first steps of
+    each pattern are candidates too. Patterns join kit, shared by the
+    songs of a dictionary, when the hits using them save more than their
+    kit entry costs.
+    """
+    if not patterns:
+        return program
+    candidates = []
+    for rate, wave, steps in patterns:
+        for n in range(len(steps), 0, -1):
+            if (rate, wave, steps[:n]) not in candidates:
+                candidates.append((rate, wave, steps[:n]))
+    patterns = candidates
+    times = []
+    t = 0
+    for ins in program:
+        times.append(t)
+        if ins[0] == 'D':
+            t += ins[1]
+    end_time = t
+
+    # the commands of each channel grouped by frame, with the
+    # channel state (note or 0, wavA, wavX) after each frame
+    frames = {}
+    state = {}
+    for i, ins in enumerate(program):
+        if ins[0] == 'LOOP':
+            state = {}
+        if ins[0] not in ('X', 'N', 'M', 'W'):
+            continue
+        ch = ins[1]
+        old = state.get(ch)
+        if ins[0] == 'X':
+            new = (0,) + old[1:] if old else None
+        elif ins[0] == 'N':
+            new = (ins[2],) + old[1:] if old else None
+        elif ins[0] == 'M':
+            new = (ins[2], ins[3], old[2]) if old else None
+        else:
+            new = ins[2:]
+        state[ch] = new
+        groups = frames.setdefault(ch, [])
+        if groups and groups[-1][0] == times[i]:
+            groups[-1][1].append(i)
+            groups[-1][2] = new
+        else:
+            groups.append([times[i], [i], new])
+
+    def no_marker(first, last_time, last_index):
+        for i in range(first + 1, len(program)):
+            if i >= last_index or times[i] > last_time:
+                return True
+            if program[i][0] not in COMMAND_SIZES and program[i][0] != 'D':
+                return False
+        return True
+
+    def match(groups, g, pattern):
+        """Bytes saved and groups replaced when pattern starts at group g."""
+        rate, wave, steps = pattern
+        t0, cmds, s0 = groups[g]
+        if len(cmds) != 1 or s0 is None or s0 != (steps[0][0], steps[0][1], wave):
+            return None
+        current = s0
+        saved = COMMAND_SIZES[program[cmds[0]][0]] - COMMAND_SIZES['DRUM']
+        replaced = [g]
+        k = 1
+        h = g + 1
+        while k < len(steps):
+            step_time = t0 + k * rate
+            expected = (steps[k][0], steps[k][1], wave)
+            if h < len(groups) and groups[h][0] < step_time:
+                # a command before the step ends the pattern
+                last_time, last_index = groups[h][0], groups[h][1][0]
+                break
+            if h < len(groups) and groups[h][0] == step_time:
+                if groups[h][2] == expected:
+                    saved += sum(COMMAND_SIZES[program[i][0]] for i in groups[h][1])
+                    replaced.append(h)
+                    current = expected
+                    h += 1
+                    k += 1
+                    continue
+                # the command ends the pattern, after the step
+                if expected[1] != current[1] and not any(program[i][0] in ('M', 'W') for i in groups[h][1]):
+                    return None
+                last_time, last_index = step_time, groups[h][1][0]
+                break
+            if step_time > end_time:
+                last_time, last_index = end_time, len(program)
+                break
+            # a step without a command must not change the channel
+            if expected != current:
+                return None
+            k += 1
+        else:
+            last_time, last_index = t0 + (len(steps) - 1) * rate, len(program)
+        if not no_marker(cmds[0], last_time, last_index):
+            return None
+        return saved, replaced
+
+    # hits of each pattern, channel by channel, the longest pattern first
+    hits = {}
+    for ch, groups in frames.items():
+        g = 0
+        while g < len(groups):
+            best = None
+            for index, pattern in enumerate(patterns):
+                found = match(groups, g, pattern)
+                if found and found[0] > 0 and (best is None or found[0] > best[1]):
+                    best = (index, found[0], found[1])
+            if best is None:
+                g += 1
+                continue
+            hits.setdefault(best[0], []).append((ch, [groups[r][1][0] for r in best[2]] +
+                                                 [i for r in best[2] for i in groups[r][1][1:]]))
+            g = best[2][-1] + 1
+
+    removed = set()
+    drums = {}
+    for index, pattern_hits in sorted(hits.items()):
+        pattern = patterns[index]
+        in_kit = pattern in kit
+        entry_size = 2 * len(pattern[2]) + 5 # rate, wave, steps, 0 and the pointer
+        saved = sum(sum(COMMAND_SIZES[program[i][0]] for i in cmds) - COMMAND_SIZES['DRUM'] for _, cmds in pattern_hits)
+        if not in_kit and (saved <= entry_size or len(kit) >= MAX_DRUMS):
+            continue
+        if not in_kit:
+            kit.append(pattern)
+        for ch, cmds in pattern_hits:
+            drums[cmds[0]] = ('DRUM', ch, kit.index(pattern))
+            removed.update(cmds[1:])
+
+    out = []
+    for i, ins in enumerate(program):
+        if i in removed:
+            continue
+        ins = drums.get(i, ins)
+        if ins[0] == 'D' and out and out[-1][0] == 'D':
+            out[-1] = ('D', out[-1][1] + ins[1])
+        else:
+            out.append(ins)
+    return out
+
+def ramp_program(program, tolerance):
+    """Replace volume and pitch runs of an optimized program by FADE and GLIDE.
+
+    The M(c,n,v) commands that change only wavA of a channel and come no
+    more than 255 frames after its last sounding command become one
+    FADE(c,v,f,s): the vIRQ adds s/256 to wavA every frame and sets v at
+    frame f. A run of N(c,n) becomes GLIDE(c,n,f,s) the same way, adding
+    s to the frequency key. The step is computed here, the vIRQ has no
+    divide. Runs are linear only approximately, so one is taken when each
+    frame stays within tolerance of the wavA it replaces, or within half a
+    semitone of the note, no marker lies in between, and the song gets
+    shorter. The last command of a run can start the next one.
+    """
+    times = []
+    markers = [] # markers before each instruction
+    t = 0
+    count = 0
+    for ins in program:
+        times.append(t)
+        markers.append(count)
+        if ins[0] == 'D':
+            t += ins[1]
+        elif ins[0] not in COMMAND_SIZES:
+            count += 1
+
+    # the commands of each channel, with its (note, wavA) after each
+    channels = {}
+    state = {}
+    after = {}
+    for i, ins in enumerate(program):
+        if ins[0] == 'LOOP':
+            state = {}
+        if ins[0] not in ('X', 'N', 'M', 'W', 'A', 'DRUM', 'FADE', 'GLIDE'):
+            continue
+        ch = ins[1]
+        old = state.get(ch)
+        if ins[0] == 'X':
+            new = (0, old[1]) if old else None
+        elif ins[0] == 'N':
+            new = (ins[2], old[1]) if old else None
+        elif ins[0] in ('M', 'W'):
+            new = (ins[2], ins[3])
+        else:
+            new = None
+        state[ch] = new
+        after[i] = new
+        channels.setdefault(ch, []).append(i)
+
+    def fit(first, run, kind):
+        """(frames, step) of a ramp from command first through run, or None."""
+        t0 = times[first]
+        frames = times[run[-1]] - t0
+        if frames > 255:
+            return None
+        if kind == 'M':
+            start, end = after[first][1], after[run[-1]][1]
+            step = round((end - start) * 256 / frames)
+            value = lambda j: (start * 256 + 128 + j * step) >> 8
+            close = lambda j, v: abs(value(j) - v[1]) <= tolerance
+        else:
+            start, end = note_key(after[first][0]), note_key(after[run[-1]][0])
+            step = round((end - start) / frames)
+            value = lambda j: start + j * step
+            close = lambda j, v: 0 < value(j) <= 0x7fff and abs(12 * math.log2(value(j) / note_key(v[0]))) <= 0.5
+        if not -0x8000 <= step <= 0x7fff:
+            return None
+        current = after[first]
+        r = 0
+        for j in range(1, frames):
+            while r < len(run) and times[run[r]] <= t0 + j:
+                current = after[run[r]]
+                r += 1
+            if not close(j, current):
+                return None
+        return frames, step
+
+    removed = set()
+    ramps = {} # instruction index -> ramp following it
+    for ch, cmds in channels.items():
+        p = 0
+        while p < len(cmds):
+            first = cmds[p]
+            s0 = after[first]
+            if s0 is None or s0[0] == 0 or note_key(s0[0]) == 0:
+                p += 1
+                continue
+            best = None
+            for kind in ('M', 'N'):
+                run = []
+                q = p + 1
+                while q < len(cmds):
+                    ins = program[cmds[q]]
+                    if (ins[0] != kind or times[cmds[q]] - times[first] > 255 or
+                            markers[cmds[q]] != markers[first] or times[cmds[q]] == times[first]):
+                        break
+                    if kind == 'M' and ins[2] != s0[0]:
+                        break
+                    if kind == 'N' and note_key(ins[2]) == 0:
+                        break
+                    run.append(cmds[q])
+                    q += 1
+                # the longest run that fits and saves bytes
+                while run:
+                    saving = sum(COMMAND_SIZES[program[i][0]] for i in run) - COMMAND_SIZES['FADE']
+                    if saving <= 0:
+                        break
+                    found = fit(first, run, kind)
+                    if found:
+                        if best is None or saving > best[0]:
+                            best = (saving, kind, list(run), found)
+                        break
+                    run.pop()
+            if best is None:
+                p += 1
+                continue
+            _, kind, run, (frames, step) = best
+            last = program[run[-1]]
+            if kind == 'M':
+                ramps[first] = ('FADE', ch, last[3], frames, step)
+            else:
+                ramps[first] = ('GLIDE', ch, last[2], frames, step)
+            removed.update(run)
+            p = cmds.index(run[-1])
+
+    out = []
+    for i, ins in enumerate(program):
+        if i not in removed:
+            if ins[0] == 'D' and out and out[-1][0] == 'D':
+                out[-1] = ('D', out[-1][1] + ins[1])
+            else:
+                out.append(ins)
+        if i in ramps:
+            out.append(ramps[i])
+    return out
+
+def format_program(program):
+    """Spell out a program as C macro calls, splitting delays into D(1)..D(127)."""
+    for ins in program:
+        if ins[0] == 'D':
+            delay = ins[1]
+            while delay > 0:
+                yield f"D({min(delay, 127)})", 1
+                delay -= min(delay, 127)
+        elif ins[0] in COMMAND_SIZES:
+            yield f"{ins[0]}({','.join(str(v) for v in ins[1:])})", COMMAND_SIZES[ins[0]]
+        else:
+            yield ins, 0
+
+def build_dictionary(songs, max_phrases=MAX_PHRASES):
+    """Replace command runs shared by several songs (or repeated in one)
+    by P(i) calls of a common dictionary.
+
+    songs holds the formatted items of each song, as returned by
+    format_program(). Phrases never span a marker, so keyframes and the
+    loop target stay in the song streams. A phrase of L bytes used k times
+    saves k*(L-2) bytes of streams and costs L+1 bytes plus its pointer.
+    Returns the phrases as lists of commands and the rewritten songs.
+    """
+    # Each distinct command becomes one character, so runs are substrings
+    codes = {}
+    sizes = []
+    def code(command):
+        if command not in codes:
+            codes[command] = chr(len(sizes) + 1)
+            sizes.append(command)
+        return codes[command]
+    runs = []
+    for items in songs:
+        current = []
+        song_runs = []
+        for command_str, size in items:
+            if size:
+                current.append(code((command_str, size)))
+            else:
+                song_runs.append(("".join(current), command_str))
+                current = []
+        song_runs.append(("".join(current), None))
+        runs.append(song_runs)
+
+    def byte_size(text):
+        return sum(sizes[ord(c) - 1][1] for c in text)
+
+    # Candidates: every repeated run of 2..MAX_PHRASE_COMMANDS commands,
+    # tried in order of their estimated saving
+    counts = {}
+    for song_runs in runs:
+        for text, _ in song_runs:
+            for n in range(2, MAX_PHRASE_COMMANDS + 1):
+                for i in range(len(text) - n + 1):
+                    sub = text[i:i + n]
+                    counts[sub] = counts.get(sub, 0) + 1
+    candidates = []
+    for sub, k in counts.items():
+        if k < 2:
+            continue
+        size = byte_size(sub)
+        if size <= MAX_ARRAY_SIZE - 1 and k * (size - 2) - size - 3 > 0:
+            candidates.append((-(k * (size - 2) - size - 3), sub, size))
+    heapq.heapify(candidates)
+
+    # Lazy greedy: savings only shrink as phrases are taken, so a candidate
+    # whose recounted saving still beats the next estimate is the best one
+    phrases = []
+    while candidates and len(phrases) < max_phrases:
+        _, sub, size = heapq.heappop(candidates)
+        k = sum(text.count(sub) for song_runs in runs for text, _ in song_runs)
+        saving = k * (size - 2) - size - 3
+        if saving <= 0:
+            continue
+        if candidates and saving < -candidates[0][0]:
+            heapq.heappush(candidates, (-saving, sub, size))
+            continue
+        # Calls use code points above those of the commands
+        call = chr(0x10000 + len(phrases))
+        runs = [[(text.replace(sub, call), marker) for text, marker in song_runs] for song_runs in runs]
+        phrases.append([sizes[ord(c) - 1][0] for c in sub])
+
+    rewritten = []
+    for song_runs in runs:
+        items = []
+        for text, marker in song_runs:
+            for c in text:
+                if ord(c) >= 0x10000:
+                    items.append((f"P({ord(c) - 0x10000})", COMMAND_SIZES['P']))
+                else:
+                    items.append(sizes[ord(c) - 1])
+            if marker is not None:
+                items.append((marker, 0))
+        rewritten.append(items)
+    return phrases, rewritten
+
+def dictionary_to_c(phrases, dict_name, input_filenames, kit=None, waves=None):
+    """C arrays of a phrase dictionary, each phrase ending with R(),
+    and of the drum kit and wave table shared by its songs."""
+    definitions = []
+    total_mem_size = 2 * len(phrases)
+    for i, commands in enumerate(phrases):
+        lines = [f"nohop static const byte {dict_name}{i:03d}[] = {{"]
+        for j in range(0, len(commands), 10):
+            lines.append("  " + ",".join(commands[j:j + 10]) + ",")
+        lines.append("  R()")
+        lines.append("};")
+        definitions.append("\n".join(lines))
+        total_mem_size += sum(COMMAND_SIZES.get(c[0], 1) for c in commands) + 1
+    # Up to 256 pointers, more than one page; the decoder only reads whole words
+    table = [f"const byte *{dict_name}[] = {{"]
+    table += [f"  {dict_name}{i:03d}," for i in range(len(phrases))]
+    table.append("};")
+    kit_definitions = []
+    kit_comment = ""
+    if kit:
+        kit_definitions, kit_size = kit_to_c(kit, f"{dict_name}_drums")
+        total_mem_size += kit_size
+        kit_comment = f"\n *    and {len(kit)} drum patterns, set them with midi_drums({dict_name}_drums)"
+    if waves:
+        wave_definitions, wave_size = waves_to_c(waves, f"{dict_name}_waves")
+        kit_definitions += wave_definitions
+        total_mem_size += wave_size
+        kit_comment += f"\n *    and {len(waves)} waveforms, set them with midi_waves({dict_name}_waves)"
+    header_comment = f"""
+/* extern const byte* {dict_name}[];
+ * -- generated by gbas_to_c.py, phrase dictionary of {' '.join(input_filenames)}
+ *    memsize {total_mem_size} in {len(phrases)} phrases, set it with midi_dictionary({dict_name}){kit_comment}
+ */
+"""
+    return (header_comment + C_MACROS + "\n" + "\n\n".join(definitions) + "\n\n" + "\n".join(table) + "\n" +
+            "".join("\n" + d + "\n" for d in kit_definitions))
+
+def number_waves(program, waves):
+    """Replace the samples of WAVE commands and keyframes by their index in waves."""
+    def number(samples):
+        if samples not in waves:
+            if len(waves) >= MAX_WAVES:
+                raise ValueError(f"more than {MAX_WAVES} waveforms")
+            waves.append(samples)
+        return waves.index(samples)
+    out = []
+    for ins in program:
+        if ins[0] == 'WAVE':
+            ins = ('WAVE', ins[1], number(ins[2]))
+        elif ins[0] == 'KEY':
+            ins = ins[:3] + (tuple(None if w is None else number(w) for w in ins[3]),)
+        out.append(ins)
+    return out
+
+def song_items(gbas_content, keyframe_seconds=0, optimize=True, kit=None, waves=None, ramps=None):
+    """Formatted commands of a song. Drum patterns and waveforms it uses
+    are added to kit and waves, which songs sharing a dictionary also
+    share. Volume and pitch runs become ramps within the wavA tolerance
+    ramps, if given."""
+    program = parse_program(gbas_content, keyframe_seconds)
+    if optimize:
+        program = optimize_program(program)
+        if kit is not None:
+            program = drum_program(program, parse_drums(gbas_content), kit)
+        program = arpeggiate_program(program)
+        if ramps is not None:
+            program = ramp_program(program, ramps)
+    program = number_waves(program, [] if waves is None else waves)
+    return list(format_program(program))
+
+def parse_gbas(gbas_content, base_filename, original_input_filename, keyframe_seconds=0, optimize=True, ramps=None):
+    kit = []
+    waves = []
+    return song_to_c(song_items(gbas_content, keyframe_seconds, optimize, kit, waves, ramps), base_filename, original_input_filename, kit, waves)
+
+def kit_to_c(kit, kit_name):
+    """C arrays of a drum kit: (rate, wave) and the (note, wavA) steps
+    of each pattern, ending with a 0 note. Returns the definitions and
+    their size in bytes."""
+    definitions = []
+    for i, (rate, wave, steps) in enumerate(kit):
+        values = [rate, wave] + [v for step in steps for v in step] + [0]
+        definitions.append(f"nohop static const byte {kit_name[:-1]}{i:03d}[] = {{ " +
+                           ",".join(str(v) for v in values) + " };")
+    table = [f"const byte *{kit_name}[] = {{"]
+    table += [f"  {kit_name[:-1]}{i:03d}," for i in range(len(kit))]
+    table.append("};")
+    definitions.append("\n".join(table))
+    return definitions, sum(2 * len(steps) + 5 for _, _, steps in kit)
+
+def waves_to_c(waves, table_name):
+    """C arrays of a wave table, 64 samples per waveform. Returns the
+    definitions and their size in bytes."""
+    definitions = []
+    for i, samples in enumerate(waves):
+        definitions.append(f"nohop static const byte {table_name[:-1]}{i:03d}[] = {{ " +
+                           ",".join(str(v) for v in samples) + " };")
+    table = [f"const byte *{table_name}[] = {{"]
+    table += [f"  {table_name[:-1]}{i:03d}," for i in range(len(waves))]
+    table.append("};")
+    definitions.append("\n".join(table))
+    return definitions, (WAVE_SAMPLES + 2) * len(waves)
+
+def song_to_c(items, base_filename, original_input_filename, kit=None, waves=None):
+    current_array_index = 0
+    all_array_definitions = []
+    array_names_for_pointer = [f"{base_filename}000"]
+    total_mem_size = 0
+
+    current_array_lines = [f"nohop static const byte {base_filename}000[] = {{"] # Stores lines for the current static const byte array
+    current_array_byte_size = 0 # Tracks byte size of commands in current_array_lines
+    current_line_commands = [] # Stores commands for the current output line
+    current_line_byte_size = 0 # Tracks byte size of commands in current_line_commands
+
+    MAX_COMMANDS_PER_LINE = 10 # User requested 10 commands per line
+
+    keyframes = []
+    pending_keyframe = None
+
+    # Loop body: the first command after the 'loop:' label, which the
+    # table reaches again through its loop-back entry after 'goto loop'.
+    pending_loop = False
+    loop_target = None
+    loop_enabled = False
+
+    for command_str, command_byte_size in items:
+        if command_byte_size == 0:
+            marker = command_str
+            if marker[0] == 'LOOP':
+                pending_loop = True
+            elif marker[0] == 'GOTO':
+                loop_enabled = loop_target is not None
+            elif marker[0] == 'KEY':
+                pending_keyframe = marker[1:]
+            continue
+
+        # Check if adding this command to the current line or array would exceed limits
+        # +1 for the terminating 0
+        if (current_array_byte_size + current_line_byte_size + command_byte_size + 1 > MAX_ARRAY_SIZE) or \
+           (len(current_line_commands) >= MAX_COMMANDS_PER_LINE):
+
+            # Flush current line buffer to current_array_lines
+            if current_line_commands:
+                current_array_lines.append("  " + ",".join(current_line_commands) + ",")
+                current_array_byte_size += current_line_byte_size
+                current_line_commands = []
+                current_line_byte_size = 0
+
+            # If array still too big, close current array and start new one
+            if current_array_byte_size + command_byte_size + 1 > MAX_ARRAY_SIZE:
+                current_array_lines.append("  0") # Terminate current array
+                current_array_lines.append("};")
+                all_array_definitions.append("\n".join(current_array_lines))
+                total_mem_size += current_array_byte_size + 1
+
+                current_array_index += 1
+                array_name = f"{base_filename}{current_array_index:03d}"
+                array_names_for_pointer.append(array_name)
+                current_array_lines = [f"nohop static const byte {array_name}[] = {{"]
+                current_array_byte_size = 0
+
+        if pending_loop:
+            loop_target = (current_array_index, current_array_byte_size + current_line_byte_size)
+            pending_loop = False
+
+        # A keyframe points at the first command decoded after it
+        if pending_keyframe:
+            key_time, key_state, key_waves = pending_keyframe
+            keyframes.append(keyframe_record(key_time, current_array_index,
+                                             current_array_byte_size + current_line_byte_size,
+                                             key_state, key_waves))
+            pending_keyframe = None
+
+        current_line_commands.append(command_str)
+        current_line_byte_size += command_byte_size
+
     # Flush any remaining commands in the current line buffer
     if current_line_commands:
         current_array_lines.append("  " + ",".join(current_line_commands) + ",")
@@ -144,65 +891,131 @@ def parse_gbas(gbas_content, base_filename, original_input_filename):
         all_array_definitions.append("\n".join(current_array_lines))
         total_mem_size += current_array_byte_size
 
-    # Generate the main pointer array
+    # Generate the keyframe records and their pointer list
+    keyframe_definitions = []
+    if len(keyframes) > 127:
+        raise ValueError(f"{len(keyframes)} keyframes do not fit in one page, use a longer interval")
+    if keyframes:
+        keys_name = f"{base_filename}_keys"
+        for i, rec in enumerate(keyframes):
+            keyframe_definitions.append(f"nohop static const byte {keys_name}{i:03d}[] = {{ " +
+                                        ",".join(str(b) for b in rec) + " };")
+            total_mem_size += len(rec)
+        keyframe_definitions.append(f"nohop static const byte *{keys_name}[] = {{\n" +
+                                    "".join(f"  {keys_name}{i:03d},\n" for i in range(len(keyframes))) +
+                                    "  0\n};")
+        total_mem_size += 2 * len(keyframes) + 2
+
+    # Generate the main pointer array, the word after the
+    # terminator locates the keyframes for midi_seek()
     main_pointer_array = [f"nohop const byte *{base_filename}[] = {{"]
     for name in array_names_for_pointer:
         main_pointer_array.append(f"  {name},")
-    main_pointer_array.append("  0")
+    if loop_enabled:
+        # loop-back entry: marker 1, then the new stream and table pointers
+        seg, off = loop_target
+        main_pointer_array.append("  (const byte*)1,")
+        main_pointer_array.append(f"  {array_names_for_pointer[seg]}+{off},")
+        main_pointer_array.append(f"  (const byte*)({base_filename}+{seg + 1}),")
+        total_mem_size += 6
+    main_pointer_array.append("  0,")
+    main_pointer_array.append(f"  (const byte*){base_filename}_keys" if keyframes else "  0")
     main_pointer_array.append("};")
 
+    # The drum kit and wave table follow the song table, which stays the first
+    # non-static pointer table of the file
+    kit_definitions = []
+    kit_comment = ""
+    if kit:
+        kit_definitions, kit_size = kit_to_c(kit, f"{base_filename}_drums")
+        total_mem_size += kit_size
+        kit_comment = f"\n *    set its {len(kit)} drum patterns with midi_drums({base_filename}_drums)"
+    if waves:
+        wave_definitions, wave_size = waves_to_c(waves, f"{base_filename}_waves")
+        kit_definitions += wave_definitions
+        total_mem_size += wave_size
+        kit_comment += f"\n *    set its {len(waves)} waveforms with midi_waves({base_filename}_waves)"
+
     # Generate the header comment
     num_segments = len(array_names_for_pointer)
     header_comment = f"""
 /* extern const byte* {base_filename}[];
  * -- generated by gbas_to_c.py from file {original_input_filename}
- *    memsize {total_mem_size} in {num_segments} segments
+ *    memsize {total_mem_size} in {num_segments} segments{kit_comment}
  */
 """
 
-    return header_comment + C_MACROS + "\n" + "\n\n".join(all_array_definitions) + "\n\n" + "\n".join(main_pointer_array) + "\n"
+    return (header_comment + C_MACROS + "\n" + "\n\n".join(all_array_definitions + keyframe_definitions) + "\n\n" +
+            "\n".join(main_pointer_array) + "\n" + "".join("\n" + d + "\n" for d in kit_definitions))
 
 def main():
-    # Check if input file is provided
-    if len(sys.argv) != 2:
-        print("Usage: python gbas_to_c.py <input_file.gbas>")
-        sys.exit(1)
+    parser = argparse.ArgumentParser(description='Convert GBAS music files into glcc C arrays')
+    parser.add_argument('inputs', nargs='+', metavar='input_file.gbas')
+    parser.add_argument('-k', '--keyframes', type=int, default=0, metavar='SECONDS',
+                        help='emit a keyframe for midi_seek() every SECONDS seconds')
+    parser.add_argument('-n', '--no-optimize', action='store_true',
+                        help='write the commands as parsed, e.g. as a reference for gbas_render -compare')
+    parser.add_argument('-r', '--ramps', type=int, metavar='TOL',
+                        help='replace volume and pitch runs by FADE and GLIDE ramps, off by at most TOL in wavA (lossy)')
+    parser.add_argument('-o', '--output', metavar='FILE', help='output file of a single input (default: <input>.gbas.c)')
+    parser.add_argument('-d', '--dictionary', metavar='NAME',
+                        help='share repeated phrases of all inputs in dictionary NAME, written to NAME.gbas.c')
+    args = parser.parse_args()
 
-    input_filename = sys.argv[1]
-    
-    # Check if input file exists
-    if not os.path.exists(input_filename):
-        print(f"Error: Input file '{input_filename}' not found.")
+    if args.output and len(args.inputs) > 1:
+        print("Error: -o needs a single input file.")
         sys.exit(1)
 
-    # Read the gbas file
-    try:
-        with open(input_filename, "r", encoding="utf-8") as f:
-            gbas_content = f.read()
-    except Exception as e:
-        print(f"Error reading file '{input_filename}': {e}")
-        sys.exit(1)
+    songs = []
+    # Songs of a dictionary share its drum kit and wave table, so they can be queued
+    shared_kit = [] if args.dictionary else None
+    shared_waves = [] if args.dictionary else None
+    for input_filename in args.inputs:
+        # Check if input file exists
+        if not os.path.exists(input_filename):
+            print(f"Error: Input file '{input_filename}' not found.")
+            sys.exit(1)
+
+        # Read the gbas file
+        try:
+            with open(input_filename, "r", encoding="utf-8") as f:
+                gbas_content = f.read()
+        except Exception as e:
+            print(f"Error reading file '{input_filename}': {e}")
+            sys.exit(1)
 
-    # Extract base filename for C array naming
-    base_filename = os.path.splitext(os.path.basename(input_filename))[0]
+        # Extract base filename for C array naming
+        base_filename = os.path.splitext(os.path.basename(input_filename))[0]
+        kit = shared_kit if args.dictionary else []
+        waves = shared_waves if args.dictionary else []
+        songs.append((input_filename, base_filename,
+                      song_items(gbas_content, args.keyframes, not args.no_optimize, kit, waves, args.ramps), kit, waves))
+
+    outputs = []
+    if args.dictionary:
+        phrases, rewritten = build_dictionary([items for _, _, items, _, _ in songs])
+        songs = [(f, b, items, None, None) for (f, b, _, _, _), items in zip(songs, rewritten)]
+        # NAME may carry a directory; the C arrays are named after its base
+        dict_name = os.path.basename(args.dictionary)
+        outputs.append((f"{args.dictionary}.gbas.c", dictionary_to_c(phrases, dict_name, args.inputs, shared_kit, shared_waves)))
 
     # Convert to C format
     try:
-        c_code = parse_gbas(gbas_content, base_filename, input_filename)
+        for input_filename, base_filename, items, kit, waves in songs:
+            outputs.append((args.output or f"{base_filename}.gbas.c", song_to_c(items, base_filename, input_filename, kit, waves)))
     except Exception as e:
         print(f"Error during conversion: {e}")
         sys.exit(1)
 
-    # Write to a new C file
-    output_filename = f"{base_filename}.gbas.c"
-    try:
-        with open(output_filename, "w") as f:
-            f.write(c_code)
-    except Exception as e:
-        print(f"Error writing to file '{output_filename}': {e}")
-        sys.exit(1)
-
-    print(f"Conversion complete. Output written to {output_filename}")
+    # Write the new C files
+    for output_filename, c_code in outputs:
+        try:
+            with open(output_filename, "w") as f:
+                f.write(c_code)
+        except Exception as e:
+            print(f"Error writing to file '{output_filename}': {e}")
+            sys.exit(1)
+        print(f"Conversion complete. Output written to {output_filename}")
 
 if __name__ == "__main__":
     main()
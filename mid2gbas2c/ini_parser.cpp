@@ -73,6 +73,11 @@ bool IniParser::hasDrum(int drum_id) const {
     return drums.find(drum_id) != drums.end();
 }
 
+std::string IniParser::getSectionText(const std::string& section) const {
+    auto it = section_text.find(section);
+    return it != section_text.end() ? it->second : std::string();
+}
+
 void IniParser::parseLine(const std::string& line, std::string& current_section) {
     // 检查是否是节标题
     if (line[0] == '[' && line.back() == ']') {
@@ -88,6 +93,7 @@ void IniParser::parseLine(const std::string& line, std::string& current_section)
     
     std::string key = trim(line.substr(0, equal_pos));
     std::string value = trim(line.substr(equal_pos + 1));
+    section_text[current_section] += key + "=" + value + "\n";
     
     // 处理General节
     if (current_section == "General") {
@@ -157,6 +163,15 @@ void IniParser::parseInstrumentConfig(const std::string& line, const std::string
         // 解析宏指令
         std::vector<MacroCommand> macros = parseMacros(key + ":" + value);
         config.macros.insert(config.macros.end(), macros.begin(), macros.end());
+    } else if (key == "harmonics" || key == "samples") {
+        // 自定义波形，空格分隔的整数
+        std::vector<int>& values = (key == "harmonics") ? config.harmonics : config.samples;
+        values.clear();
+        for (const std::string& token : split(value, ' ')) {
+            if (!trim(token).empty()) {
+                values.push_back(std::stoi(trim(token)));
+            }
+        }
     }
 }
 
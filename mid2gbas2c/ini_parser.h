@@ -29,6 +29,8 @@ struct InstrumentConfig {
     std::string name;        // 乐器名称
     int accuracy;            // 精度（tick时间，1/秒）
     std::vector<MacroCommand> macros; // 宏指令列表
+    std::vector<int> harmonics; // 自定义波形：各次谐波的幅度
+    std::vector<int> samples;   // 自定义波形：64 个采样 (0-63)，优先于 harmonics
 };
 
 // INI解析器类
@@ -55,10 +57,14 @@ public:
     // 检查鼓声是否存在
     bool hasDrum(int drum_id) const;
     
+    // 获取一个节的所有键值对（去掉注释和空行），用于计算转换缓存的键
+    std::string getSectionText(const std::string& section) const;
+    
 private:
     int default_accuracy;
     std::map<int, InstrumentConfig> instruments; // 乐器配置，键为乐器ID
     std::map<int, InstrumentConfig> drums;       // 鼓声配置，键为鼓声ID
+    std::map<std::string, std::string> section_text; // 每个节的键值对原文
     
     // 解析一行
     void parseLine(const std::string& line, std::string& current_section);
@@ -3,13 +3,127 @@
 #include <string>
 #include <algorithm>
 #include <cmath> // For std::round
+#include <cctype> // For std::tolower
 #include <map>
+#include <unordered_map>
+#include <chrono> // For the -stats stage timings
+#include <set>
+#include <array>
+#include <sstream>
+#include <cstdint>
+#include <cstdio> // For std::snprintf
+#include <filesystem> // For the -cache directory
 #include <fstream> // Include fstream for file operations
 
 #include "midifile-master/include/MidiFile.h"
 #include "midifile-master/include/MidiEvent.h"
 #include "midifile-master/include/MidiMessage.h"
 #include "ini_parser.h"
+#include "voice_allocator.h"
+
+// 从 start 到现在经过的秒数
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 64 位 FNV-1a 散列，用于转换缓存的键
+uint64_t fnv1a(uint64_t hash, const std::string& data) {
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    // 分隔符，避免相邻字段拼接后产生相同的键
+    hash ^= 0xff;
+    hash *= 0x100000001b3ULL;
+    return hash;
+}
+
+// 一帧中 4 个通道的状态：每个通道 (音符, 音量, 波形)，音量 0 表示关闭
+typedef std::array<int, 12> FrameState;
+
+// 按 gbas_to_c.py 的规则估计 music_data 过程生成的字节数：W 4 字节，X 1 字节，
+// 每 127 帧延时 1 字节，每段最多 250 字节（含结尾的 0），每段 2 字节指针，指针表结尾 4 字节。
+// 不计 gbas_to_c.py 的窥孔优化，所以是上限
+long estimate_song_bytes(const std::string& music_data) {
+    std::istringstream in(music_data);
+    std::string line;
+    long content = 0;
+    long tick_sum = 0;
+    std::set<std::string> waves;
+    while (std::getline(in, line)) {
+        size_t pos = line.find_first_not_of(" \t");
+        if (pos == std::string::npos) continue;
+        line = line.substr(pos);
+        if (line.compare(0, 9, "tick_sum=") == 0) {
+            tick_sum = std::stol(line.substr(9));
+        } else if (line.compare(0, 20, "call eatSound_Timer,") == 0) {
+            long tick = std::stol(line.substr(20));
+            if (tick > tick_sum) content += (tick - tick_sum + 126) / 127;
+            tick_sum = tick;
+        } else if (line.compare(0, 10, "call beep,") == 0) {
+            int ch, note, vol;
+            content += (std::sscanf(line.c_str() + 10, "%d,%d,%d", &ch, &note, &vol) == 3 && vol == 0) ? 1 : 4;
+        } else if (line.compare(0, 6, "'wave ") == 0) {
+            // WAVE(w,i) 3 字节，每个不同的波形再加 64 个采样和 2 字节指针
+            content += 3;
+            if (waves.insert(line.substr(8)).second) content += 66;
+        } else if (line.compare(0, 4, "goto") == 0) {
+            break;
+        }
+    }
+    long segments = std::max(1L, (content + 248) / 249);
+    return content + segments + 2 * segments + 4;
+}
+
+// 重放 music_data 过程，得到从第 0 帧到结尾每一帧的通道状态
+std::vector<FrameState> replay_music_data(const std::string& music_data) {
+    std::vector<FrameState> frames;
+    FrameState state{};
+    std::istringstream in(music_data);
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t pos = line.find_first_not_of(" \t");
+        if (pos == std::string::npos) continue;
+        line = line.substr(pos);
+        if (line.compare(0, 20, "call eatSound_Timer,") == 0) {
+            long tick = std::stol(line.substr(20));
+            while (static_cast<long>(frames.size()) < tick) frames.push_back(state);
+        } else if (line.compare(0, 10, "call beep,") == 0) {
+            int ch, note, vol, wave;
+            if (std::sscanf(line.c_str() + 10, "%d,%d,%d,%d", &ch, &note, &vol, &wave) == 4 && ch >= 1 && ch <= 4) {
+                state[3 * (ch - 1)] = note;
+                state[3 * (ch - 1) + 1] = vol;
+                state[3 * (ch - 1) + 2] = wave;
+            }
+        } else if (line.compare(0, 4, "goto") == 0) {
+            break;
+        }
+    }
+    frames.push_back(state);
+    return frames;
+}
+
+// 两条通道状态时间线之间每帧的平均感知误差：音量差，两边都在发声时
+// 音符不同加上较大的音量，只有波形不同加上较小音量的一半
+double timeline_error(const std::vector<FrameState>& reference, const std::vector<FrameState>& test) {
+    size_t frames = std::max(reference.size(), test.size());
+    if (frames == 0) return 0;
+    const FrameState silent{};
+    double error = 0;
+    for (size_t f = 0; f < frames; ++f) {
+        const FrameState& a = f < reference.size() ? reference[f] : silent;
+        const FrameState& b = f < test.size() ? test[f] : silent;
+        for (int c = 0; c < 4; ++c) {
+            int v1 = a[3 * c + 1], v2 = b[3 * c + 1];
+            error += std::abs(v1 - v2);
+            if (v1 > 0 && v2 > 0) {
+                if (a[3 * c] != b[3 * c]) error += std::max(v1, v2);
+                else if (a[3 * c + 2] != b[3 * c + 2]) error += std::min(v1, v2) / 2.0;
+            }
+        }
+    }
+    return error / frames;
+}
 
 // 转换 MIDI 音符索引到 Gigatron 引擎支持的范围 (12-105)
 int convert_midi_note(int midi_note) {
@@ -278,6 +392,41 @@ std::vector<int> get_instrument_release_pitch_bend_sequence(int program, IniPars
     return result;
 }
 
+// 获取乐器配置的自定义波形：samples= 的 64 个采样，或者按 harmonics= 各次谐波的幅度合成，
+// 范围 0-63，与 sound_sine_waveform 相同在每个采样的中点取值。没有配置时为空
+std::vector<int> get_instrument_wavetable(int program, IniParser* config_parser = nullptr) {
+    std::vector<int> result;
+    if (!config_parser || !config_parser->hasInstrument(program)) {
+        return result;
+    }
+    const InstrumentConfig& config = config_parser->getInstrumentConfig(program);
+    if (config.samples.size() == 64) {
+        for (int sample : config.samples) {
+            result.push_back(std::max(0, std::min(63, sample)));
+        }
+        return result;
+    }
+    if (config.harmonics.empty()) {
+        return result;
+    }
+    const double pi = std::acos(-1.0);
+    std::vector<double> wave(64, 0.0);
+    double peak = 0;
+    for (int i = 0; i < 64; ++i) {
+        for (size_t k = 0; k < config.harmonics.size(); ++k) {
+            wave[i] += config.harmonics[k] * std::sin(2 * pi * (k + 1) * (i + 0.5) / 64);
+        }
+        peak = std::max(peak, std::abs(wave[i]));
+    }
+    if (peak == 0) {
+        return result;
+    }
+    for (int i = 0; i < 64; ++i) {
+        result.push_back(std::max(0, std::min(63, static_cast<int>(std::lround(31.5 + 31.5 * wave[i] / peak)))));
+    }
+    return result;
+}
+
 // 获取鼓声配置的精度
 int get_drum_accuracy(int drum_id, IniParser* config_parser = nullptr) {
     if (config_parser && config_parser->hasDrum(drum_id)) {
@@ -311,6 +460,25 @@ int get_drum_waveform(int drum_id, IniParser* config_parser = nullptr) {
     return 0;
 }
 
+// 获取鼓声配置的一个宏序列（vol、pitch_bend 等），没有配置时为空
+std::vector<int> get_drum_sequence(int drum_id, const std::string& type, IniParser* config_parser = nullptr) {
+    std::vector<int> result;
+    if (config_parser && config_parser->hasDrum(drum_id)) {
+        const InstrumentConfig& config = config_parser->getDrumConfig(drum_id);
+        for (const auto& macro : config.macros) {
+            if (macro.type == type) {
+                for (const auto& element : macro.on_elements) {
+                    if (element.type == "value") {
+                        result.push_back(element.value);
+                    }
+                }
+                break;
+            }
+        }
+    }
+    return result;
+}
+
 // 自定义 MidiEvent 结构体，用于存储解析后的事件信息
 struct CustomMidiEvent {
     int channel;        // Gigatron 通道 (1-4)
@@ -331,6 +499,7 @@ struct CustomMidiEvent {
     bool is_release_event; // 是否为释放事件
     int modulation;     // MIDI 调制轮值 (CC 1)
     int wave_value;     // 宏事件中的波形值
+    std::vector<int> arpeggio; // -arpeggio：并入这个 Note On 的和弦音，相对它的音高（半音）
 };
 
 // 音符状态跟踪结构体
@@ -345,6 +514,7 @@ struct NoteState {
     int modulation;     // 当前调制轮值
     long start_tick;    // 音符开始的 tick
     bool active;        // 音符是否处于活动状态
+    int midi_channel;   // 原始 MIDI 通道
 };
 
 // 单音轨复音FIFO队列项
@@ -360,6 +530,15 @@ public:
     virtual std::vector<CustomMidiEvent> parse(const std::string& filename, double max_duration_seconds, bool dynamic_allocation = false, bool no_velocity_change = false, IniParser* config_parser = nullptr) = 0;
     virtual long get_ppqn() = 0; // 每四分音符的脉冲数
     virtual long get_tempo() = 0; // 每四分音符的微秒数
+    virtual long get_loop_start() = 0; // 循环起点标记的 MIDI tick，-1 表示没有
+    virtual long get_loop_end() = 0; // 循环终点标记的 MIDI tick，-1 表示没有
+    virtual double get_read_seconds() = 0; // 读取 MIDI 文件用的时间
+    virtual double get_link_seconds() = 0; // 时间分析和音符配对用的时间
+    virtual void set_link_horizon(double seconds) = 0; // -time 预览时在截止点之后多读的秒数
+    virtual void set_optimal_voices(bool enabled) = 0; // -optimal 离线为整首曲子分配声部
+    virtual void set_arpeggio(bool enabled) = 0; // -arpeggio 把放不下的和弦音并入同时开始的音符
+    virtual const std::set<int>& get_optimal_programs() = 0; // -optimal 分配声部时看到的乐器，包括音符全被丢弃的
+    virtual const std::set<int>& get_optimal_drum_notes() = 0; // -optimal 分配声部时看到的鼓声音符
     virtual ~MidiFileParser() = default;
 };
 
@@ -368,18 +547,55 @@ public:
     std::vector<CustomMidiEvent> parse(const std::string& filename, double max_duration_seconds, bool dynamic_allocation = false, bool no_velocity_change = false, IniParser* /*config_parser*/ = nullptr) override {
         std::vector<CustomMidiEvent> events;
         smf::MidiFile midifile;
-        midifile.read(filename);
+        // 多音轨文件的各音轨在多个线程中并行解码
+        midifile.setReadThreads(0);
+        auto stage_start = std::chrono::steady_clock::now();
+        long read_limit = -1;
+        if (max_duration_seconds > 0) {
+            // -time 预览只读到截止点之后 _link_horizon 秒，每个音轨在此之后的第一个事件处停止。
+            // 下面的截止 tick 按最近一个 tempo 计算，读到的 tempo 越快需要读得越远：
+            // 先读 0 tick 得到 PPQN，按已读到的最快 tempo 加大读取范围，直到不再变化
+            read_limit = 0;
+            for (;;) {
+                midifile.setReadTickLimit(read_limit);
+                midifile.read(filename);
+                if (!midifile.status()) {
+                    break;
+                }
+                double fastest = 500000;
+                for (int track = 0; track < midifile.getNumTracks(); ++track) {
+                    for (int i = 0; i < midifile[track].size(); ++i) {
+                        if (midifile[track][i].isTempo()) {
+                            fastest = std::min(fastest, static_cast<double>(std::max(1, midifile[track][i].getTempoMicroseconds())));
+                        }
+                    }
+                }
+                double ticks = (max_duration_seconds + _link_horizon) * midifile.getTicksPerQuarterNote() * 1000000.0 / fastest;
+                long needed = static_cast<long>(std::min(ticks, 2147483647.0)) + 1;
+                if (needed <= read_limit) {
+                    break;
+                }
+                read_limit = needed;
+            }
+        } else {
+            midifile.read(filename);
+        }
+        _read_seconds = seconds_since(stage_start);
 
         if (!midifile.status()) {
             std::cerr << "Error: Could not read MIDI file " << filename << std::endl;
             return events;
         }
 
+        stage_start = std::chrono::steady_clock::now();
         midifile.doTimeAnalysis();
         midifile.linkNotePairs();
+        _link_seconds = seconds_since(stage_start);
 
         _ppqn = midifile.getTicksPerQuarterNote();
         _tempo = 500000; // 默认 tempo 120 BPM (500000 microseconds per quarter note)
+        _loop_start_tick = -1;
+        _loop_end_tick = -1;
 
         long max_midi_tick = -1;
         if (max_duration_seconds > 0) {
@@ -410,6 +626,14 @@ public:
         // 清空音符状态跟踪
         _active_notes.clear();
 
+        _note_voices.clear();
+        _note_arpeggios.clear();
+        _optimal_programs.clear();
+        _optimal_drum_notes.clear();
+        if (_optimal_voices) {
+            assign_optimal_voices(midifile, max_duration_seconds, read_limit);
+        }
+
         for (int track = 0; track < midifile.getNumTracks(); ++track) {
             for (int i = 0; i < midifile[track].size(); ++i) {
                 smf::MidiEvent& event = midifile[track][i];
@@ -421,6 +645,17 @@ public:
                 }
                 _debug_log << std::endl;
 
+                // 循环标记：Marker (0x06) 或 Cue Point (0x07) 元事件，文本为 loopStart / loopEnd
+                if (message.isMarkerText() || (message.isMeta() && message.getMetaType() == 0x07)) {
+                    std::string text = message.getMetaContent();
+                    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+                    if (text == "loopstart") {
+                        _loop_start_tick = event.tick;
+                    } else if (text == "loopend") {
+                        _loop_end_tick = event.tick;
+                    }
+                }
+
                 if (message.isTempo()) {
                     _tempo = message.getTempoMicroseconds();
                     // 更新 max_midi_tick因为 tempo 可能改变
@@ -439,7 +674,15 @@ public:
                     int gigatron_channel;
                     int note = message.getKeyNumber();
 
-                    if (_midi_channel_to_gigatron_channel_map.count(midi_channel)) {
+                    if (_optimal_voices) {
+                        // 离线分配模式：使用预先为这个音符选好的通道
+                        auto voice = _note_voices.find(&event);
+                        if (voice == _note_voices.end() || voice->second == 0) {
+                            _debug_log << "[OPTIMAL] Dropping note " << note << " on MIDI Channel " << midi_channel << " at tick " << event.tick << std::endl;
+                            continue;
+                        }
+                        gigatron_channel = voice->second;
+                    } else if (_midi_channel_to_gigatron_channel_map.count(midi_channel)) {
                         // MIDI channel is already mapped
                         gigatron_channel = _midi_channel_to_gigatron_channel_map[midi_channel];
                         _gigatron_channel_last_note_on_tick[gigatron_channel] = event.tick;
@@ -618,6 +861,7 @@ public:
                     note_state.modulation = _channel_modulations[midi_channel]; // 设置当前调制轮值
                     note_state.start_tick = event.tick;
                     note_state.active = true;
+                    note_state.midi_channel = midi_channel;
                     _active_notes[note_key] = note_state;
 
                     CustomMidiEvent new_event;
@@ -628,6 +872,10 @@ public:
                     new_event.program = _channel_programs[midi_channel]; // Use current program for this MIDI channel
                     new_event.timestamp = event.tick;
                     new_event.duration = event.getTickDuration();
+                    if (read_limit != -1 && !event.isLinked() && midifile[track].last().tick > read_limit) {
+                        // 音符在预览读取的范围内没有结束，当作持续到读取范围的末尾
+                        new_event.duration = read_limit - event.tick;
+                    }
                     new_event.is_note_off = false; // Note On 事件
                     new_event.pitch_bend = _channel_pitch_bends[midi_channel]; // Use current pitch bend for this MIDI channel
                     new_event.is_velocity_change = false;
@@ -639,13 +887,49 @@ public:
                     new_event.is_release_event = false; // 默认不是释放事件
                     new_event.modulation = _channel_modulations[midi_channel]; // 设置当前调制轮值
                     new_event.wave_value = -1; // 初始化波形值
+                    auto arpeggio = _note_arpeggios.find(&event);
+                    if (arpeggio != _note_arpeggios.end()) {
+                        new_event.arpeggio = arpeggio->second;
+                    }
                     events.push_back(new_event);
 
                 } else if (message.isNoteOff()) {
                     int midi_channel = message.getChannel();
                     int note = message.getKeyNumber();
                     
-                    if (dynamic_allocation && _midi_channel_polyphony_queue.count(midi_channel)) {
+                    // 离线分配模式下 Note Off 跟随与它配对的 Note On 的通道，被丢弃的音符没有 Note Off
+                    int optimal_channel = 0;
+                    if (_optimal_voices && event.isLinked()) {
+                        auto voice = _note_voices.find(event.getLinkedEvent());
+                        if (voice != _note_voices.end()) {
+                            optimal_channel = voice->second;
+                        }
+                    }
+
+                    if (_optimal_voices) {
+                        if (optimal_channel != 0) {
+                            std::string note_key = std::to_string(optimal_channel) + "_" + std::to_string(note);
+                            _active_notes.erase(note_key);
+
+                            CustomMidiEvent new_event;
+                            new_event.channel = optimal_channel;
+                            new_event.original_midi_channel = midi_channel; // 添加原始 MIDI 通道
+                            new_event.note = note;
+                            new_event.velocity = 0; // Note Off 事件的音量为 0
+                            new_event.program = _channel_programs[midi_channel]; // Use current program for this MIDI channel
+                            new_event.timestamp = event.tick;
+                            new_event.duration = 0; // Note Off 事件没有持续时间
+                            new_event.is_note_off = true; // Note Off 事件
+                            new_event.pitch_bend = _channel_pitch_bends[midi_channel]; // Use current pitch bend for this MIDI channel
+                            new_event.is_velocity_change = false;
+                            new_event.is_pitch_bend_change = false;
+                            new_event.is_macro_event = false; // 默认不是宏事件
+                            new_event.is_release_event = false; // 默认不是释放事件
+                            new_event.modulation = _channel_modulations[midi_channel]; // 设置当前调制轮值
+                            new_event.wave_value = -1; // 初始化波形值
+                            events.push_back(new_event);
+                        }
+                    } else if (dynamic_allocation && _midi_channel_polyphony_queue.count(midi_channel)) {
                         // 在动态分配模式下，从复音队列中查找并移除对应的音符
                         auto& queue = _midi_channel_polyphony_queue[midi_channel];
                         int gigatron_channel = -1;
@@ -724,16 +1008,17 @@ public:
                     _channel_pitch_bends[message.getChannel()] = actual_semitone_bend; // 存储以半音为单位的弯音值
                     
                     // 如果弯音值发生变化，为所有活动音符生成弯音变化事件
-                    if (std::abs(old_bend - actual_semitone_bend) > 0.001 && _midi_channel_to_gigatron_channel_map.count(message.getChannel())) {
-                        int gigatron_channel = _midi_channel_to_gigatron_channel_map[message.getChannel()];
+                    if (std::abs(old_bend - actual_semitone_bend) > 0.001 && (_optimal_voices || _midi_channel_to_gigatron_channel_map.count(message.getChannel()))) {
+                        int gigatron_channel = _optimal_voices ? 0 : _midi_channel_to_gigatron_channel_map[message.getChannel()];
                         
-                        // 为该通道的所有活动音符生成弯音变化事件
+                        // 为该通道的所有活动音符生成弯音变化事件（离线分配模式下按原始 MIDI 通道查找，音符可能分布在多个 Gigatron 通道上）
                         for (auto& note_pair : _active_notes) {
                             std::string note_key = note_pair.first;
                             NoteState& note_state = note_pair.second;
-                            if (note_state.channel == gigatron_channel && note_state.active) {
+                            bool on_channel = _optimal_voices ? note_state.midi_channel == message.getChannel() : note_state.channel == gigatron_channel;
+                            if (on_channel && note_state.active) {
                                 CustomMidiEvent bend_event;
-                                bend_event.channel = gigatron_channel;
+                                bend_event.channel = note_state.channel;
                                 bend_event.original_midi_channel = message.getChannel(); // 添加原始 MIDI 通道
                                 bend_event.note = note_state.note;
                                 bend_event.velocity = note_state.velocity;
@@ -808,16 +1093,17 @@ public:
                     
                     // 如果该MIDI通道已映射到Gigatron通道，为所有活动音符生成音量/表情/调制变化事件
                     // 但如果设置了no_velocity_change，则不生成音量变化事件
-                    if (_midi_channel_to_gigatron_channel_map.count(midi_channel) && !no_velocity_change) {
-                        int gigatron_channel = _midi_channel_to_gigatron_channel_map[midi_channel];
+                    if ((_optimal_voices || _midi_channel_to_gigatron_channel_map.count(midi_channel)) && !no_velocity_change) {
+                        int gigatron_channel = _optimal_voices ? 0 : _midi_channel_to_gigatron_channel_map[midi_channel];
                         
                         // 为该通道的所有活动音符生成事件
                         for (auto& note_pair : _active_notes) {
                             std::string note_key = note_pair.first;
                             NoteState& note_state = note_pair.second;
-                            if (note_state.channel == gigatron_channel && note_state.active) {
+                            bool on_channel = _optimal_voices ? note_state.midi_channel == midi_channel : note_state.channel == gigatron_channel;
+                            if (on_channel && note_state.active) {
                                 CustomMidiEvent controller_change_event;
-                                controller_change_event.channel = gigatron_channel;
+                                controller_change_event.channel = note_state.channel;
                                 controller_change_event.original_midi_channel = midi_channel; // 添加原始 MIDI 通道
                                 controller_change_event.note = note_state.note;
                                 controller_change_event.velocity = note_state.velocity;
@@ -854,10 +1140,198 @@ public:
 
     long get_ppqn() override { return _ppqn; }
     long get_tempo() override { return _tempo; }
+    long get_loop_start() override { return _loop_start_tick; }
+    long get_loop_end() override { return _loop_end_tick; }
+    double get_read_seconds() override { return _read_seconds; }
+    double get_link_seconds() override { return _link_seconds; }
+    void set_link_horizon(double seconds) override { _link_horizon = seconds; }
+    void set_optimal_voices(bool enabled) override { _optimal_voices = enabled; }
+    void set_arpeggio(bool enabled) override { _arpeggio = enabled; }
+    const std::set<int>& get_optimal_programs() override { return _optimal_programs; }
+    const std::set<int>& get_optimal_drum_notes() override { return _optimal_drum_notes; }
 
 private:
+    // -optimal：解析之前为整首曲子的每个 Note On 选好 Gigatron 通道，结果存入 _note_voices。
+    // 音符占用通道的区间包括配置文件中的释放尾音，重要性是响度乘以发声秒数，
+    // 每个时刻的最高音和最低音（旋律和低音）加倍
+    void assign_optimal_voices(smf::MidiFile& midifile, double max_duration_seconds, long read_limit) {
+        std::vector<VoiceNote> notes;
+        std::vector<const smf::MidiEvent*> note_events;
+        std::vector<int> pitches;
+        std::vector<long> body_ends;
+        std::vector<bool> drums;
+        int programs[16];
+        int volumes[16];
+        int expressions[16];
+        for (int ch = 0; ch < 16; ++ch) {
+            programs[ch] = 0;
+            volumes[ch] = 127;
+            expressions[ch] = 127;
+        }
+        double default_seconds_per_tick = 0.5 / std::max(1, midifile.getTicksPerQuarterNote());
+
+        for (int track = 0; track < midifile.getNumTracks(); ++track) {
+            for (int i = 0; i < midifile[track].size(); ++i) {
+                const smf::MidiEvent& event = midifile[track][i];
+                if (max_duration_seconds > 0 && event.seconds > max_duration_seconds) {
+                    break;
+                }
+                int midi_channel = event.getChannel();
+                if (event.isPatchChange()) {
+                    programs[midi_channel] = event.getP1();
+                } else if (event.isController()) {
+                    if (event.getP1() == 7) {
+                        volumes[midi_channel] = event.getP2();
+                    } else if (event.getP1() == 11) {
+                        expressions[midi_channel] = event.getP2();
+                    }
+                }
+                if (!event.isNoteOn()) {
+                    continue;
+                }
+
+                int note = event.getKeyNumber();
+                long duration = event.getTickDuration();
+                if (read_limit != -1 && !event.isLinked() && midifile[track].last().tick > read_limit) {
+                    duration = read_limit - event.tick;
+                }
+                long end = event.tick + std::max(1L, duration);
+                double end_seconds = midifile.getTimeInSeconds(static_cast<int>(end));
+                double seconds_per_tick = end_seconds > event.seconds ? (end_seconds - event.seconds) / (end - event.tick) : default_seconds_per_tick;
+
+                // 释放尾音的长度与转换时生成释放宏的方式相同：释放音量序列的长度乘以宏的间隔
+                bool is_drum = (midi_channel == 9 && note >= 27 && note <= 87);
+                if (is_drum) {
+                    _optimal_drum_notes.insert(note);
+                } else {
+                    _optimal_programs.insert(programs[midi_channel]);
+                }
+                long release_ticks = 0;
+                if (_config_parser) {
+                    int accuracy = is_drum ? get_drum_accuracy(note, _config_parser) : get_instrument_accuracy(programs[midi_channel], _config_parser);
+                    long tick_increment = std::max(1L, static_cast<long>(std::round(60.0 / std::max(1, accuracy))));
+                    size_t release_steps = is_drum ? 1 : get_instrument_release_volume_sequence(programs[midi_channel], _config_parser).size();
+                    double release_seconds = release_steps * tick_increment / 60.0;
+                    release_ticks = static_cast<long>(std::ceil(release_seconds / seconds_per_tick));
+                }
+
+                double loudness = event.getVelocity() / 127.0 * volumes[midi_channel] / 127.0 * expressions[midi_channel] / 127.0;
+                double sounding = (end - event.tick + release_ticks) * seconds_per_tick;
+
+                VoiceNote voice_note;
+                voice_note.start = event.tick;
+                voice_note.end = end + release_ticks;
+                voice_note.weight = std::max(1e-6, loudness * sounding);
+                voice_note.midi_channel = midi_channel;
+                notes.push_back(voice_note);
+                note_events.push_back(&event);
+                pitches.push_back(note);
+                body_ends.push_back(end);
+                drums.push_back(is_drum);
+            }
+        }
+
+        // 找出开始时是最高音或最低音的旋律音符：按开始时间扫描，同一 tick 开始的音符一起加入后再比较
+        std::vector<size_t> order;
+        for (size_t i = 0; i < notes.size(); ++i) {
+            if (!drums[i]) {
+                order.push_back(i);
+            }
+        }
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return notes[a].start < notes[b].start;
+        });
+        std::multiset<int> sounding_pitches;
+        std::multimap<long, int> pending_ends; // 音符主体的结束 tick -> 音高
+        for (size_t first = 0; first < order.size();) {
+            long tick = notes[order[first]].start;
+            while (!pending_ends.empty() && pending_ends.begin()->first <= tick) {
+                sounding_pitches.erase(sounding_pitches.find(pending_ends.begin()->second));
+                pending_ends.erase(pending_ends.begin());
+            }
+            size_t last = first;
+            while (last < order.size() && notes[order[last]].start == tick) {
+                sounding_pitches.insert(pitches[order[last]]);
+                pending_ends.insert({body_ends[order[last]], pitches[order[last]]});
+                ++last;
+            }
+            for (size_t k = first; k < last; ++k) {
+                int pitch = pitches[order[k]];
+                if (pitch == *sounding_pitches.begin() || pitch == *sounding_pitches.rbegin()) {
+                    notes[order[k]].weight *= 2.0;
+                }
+            }
+            first = last;
+        }
+
+        std::vector<int> voices = assign_voices(notes, 4);
+        size_t kept = 0;
+        for (size_t i = 0; i < notes.size(); ++i) {
+            _note_voices[note_events[i]] = voices[i];
+            if (voices[i] != 0) {
+                ++kept;
+            }
+        }
+        _debug_log << "[OPTIMAL] Kept " << kept << " of " << notes.size() << " notes" << (notes.size() > kOptimalVoiceLimit ? " (greedy)" : "") << std::endl;
+
+        if (!_arpeggio) {
+            return;
+        }
+        // -arpeggio：丢弃的和弦音并入同一 MIDI 通道、同时开始的保留音符，每个音符最多并入 3 个，
+        // 优先并入结束时间最接近的音符。drums 不参与
+        size_t folded = 0;
+        std::map<size_t, std::vector<int>> intervals; // 保留的音符 -> 并入的音程
+        std::map<std::pair<long, int>, std::vector<size_t>> onsets; // (开始 tick, MIDI 通道) -> 保留的音符
+        for (size_t i = 0; i < notes.size(); ++i) {
+            if (voices[i] != 0 && !drums[i]) {
+                onsets[{notes[i].start, notes[i].midi_channel}].push_back(i);
+            }
+        }
+        for (size_t i = 0; i < notes.size(); ++i) {
+            if (voices[i] != 0 || drums[i]) {
+                continue;
+            }
+            auto kept_notes = onsets.find({notes[i].start, notes[i].midi_channel});
+            if (kept_notes == onsets.end()) {
+                continue;
+            }
+            size_t best = notes.size();
+            for (size_t k : kept_notes->second) {
+                const std::vector<int>& folds = intervals[k];
+                int interval = pitches[i] - pitches[k];
+                if (folds.size() >= 3 || interval == 0 || std::find(folds.begin(), folds.end(), interval) != folds.end()) {
+                    continue;
+                }
+                if (best == notes.size() || std::abs(body_ends[k] - body_ends[i]) < std::abs(body_ends[best] - body_ends[i])) {
+                    best = k;
+                }
+            }
+            if (best != notes.size()) {
+                intervals[best].push_back(pitches[i] - pitches[best]);
+                ++folded;
+            }
+        }
+        for (const auto& [k, folds] : intervals) {
+            if (!folds.empty()) {
+                _note_arpeggios[note_events[k]] = folds;
+            }
+        }
+        _debug_log << "[ARPEGGIO] Folded " << folded << " dropped notes into arpeggios" << std::endl;
+    }
+
     long _ppqn = 0;
     long _tempo = 500000; // 默认 tempo 120 BPM
+    long _loop_start_tick = -1; // loopStart 标记的 MIDI tick
+    long _loop_end_tick = -1; // loopEnd 标记的 MIDI tick
+    double _read_seconds = 0;
+    double _link_seconds = 0;
+    double _link_horizon = 10.0; // -link_horizon
+    bool _optimal_voices = false; // -optimal
+    bool _arpeggio = false; // -arpeggio
+    std::unordered_map<const smf::MidiEvent*, std::vector<int>> _note_arpeggios; // -arpeggio：并入每个 Note On 的和弦音
+    std::unordered_map<const smf::MidiEvent*, int> _note_voices; // -optimal：每个 Note On 分到的 Gigatron 通道，0 表示丢弃
+    std::set<int> _optimal_programs; // -optimal：释放长度影响了声部分配的乐器
+    std::set<int> _optimal_drum_notes; // -optimal：精度影响了声部分配的鼓声音符
     std::ofstream _debug_log; // 添加 debug_log 成员变量
     std::map<int, int> _midi_channel_to_gigatron_channel_map; // MIDI通道到Gigatron通道的映射
     std::map<int, long> _gigatron_channel_last_note_on_tick; // 存储Gigatron通道上次Note On的tick
@@ -912,8 +1386,12 @@ public:
 };
 int main(int argc, char* argv[]) {
     double max_duration_seconds = -1.0; // 默认不限制时长
+    double link_horizon_seconds = 10.0; // -time 预览时在截止点之后多读的秒数
     double pitch_bend_multiplier = 1.0; // 默认弯音轮放大倍数为 1.0
     bool dynamic_allocation = false; // 默认不使用动态分配
+    bool optimal_voices = false; // -optimal，离线为整首曲子分配声部，优先于 -d
+    int arpeggio_rate = 0; // -arpeggio，放不下的和弦音并入琶音，每个音符的帧数，0表示不使用；包含 -optimal
+    bool drum_kit = false; // -drumkit，鼓声按配置文件的音量和弯音序列演奏，并声明成 gbas_to_c.py 的鼓组
     int gigatron_ticks_per_second = 60; // 默认 Gigatron tick 精度为 60 (1/60 秒)
     int min_volume_boost = 0; // 默认最低音量抬升为 0
     int timer_compensation_target = 60; // 默认定时器补偿目标为 60
@@ -922,6 +1400,17 @@ int main(int argc, char* argv[]) {
     double speed_multiplier = 1.0; // 默认速度倍数为 1.0 (正常速度)
     int default_volume_levels = 64; // 默认音量等级为64（不精简）
     int cmd_volume_levels = -1; // 命令行指定的音量等级，-1表示未指定
+    long loop_start_midi_tick = -1; // 命令行指定的循环起点 (MIDI tick)，-1表示使用MIDI标记
+    long loop_end_midi_tick = -1; // 命令行指定的循环终点 (MIDI tick)，-1表示使用MIDI标记或曲尾
+    int frame_budget = 0; // 每帧最多输出的 beep 命令数，0表示不限制
+    std::string stats_file = ""; // 各阶段用时和输出统计的 JSON 文件，空表示不输出
+    std::string cache_dir = ""; // 转换缓存目录，空表示不使用缓存
+    int quantize_levels = 64; // 所有输出音量（包括宏）的等级数，64表示不量化
+    int envelope_rate = 0; // 宏步骤每秒最多几步，多余的步骤跳过，0表示不限制
+    int drop_steps = 0; // 与上一步音量相差小于此值且波形和弯音不变的宏步骤被丢弃
+    int envelope_jitter = 0; // 宏步骤可以移动到前后这么多帧内已有的帧
+    int onset_jitter = 0; // 相差不超过这么多帧的音符事件合并到同一帧，应比 envelope_jitter 小
+    long byte_budget = 0; // 自动选择上面的质量参数，使数据不超过此字节数，0表示不限制
     
     // 通道波形强制指定参数
     int channel_waveforms[5] = {-1, -1, -1, -1, -1}; // 索引1-4对应通道1-4，-1表示使用默认波形
@@ -963,9 +1452,13 @@ int main(int argc, char* argv[]) {
         std::cerr << std::endl;
         std::cerr << "Options:" << std::endl;
         std::cerr << "  -d                          Enable dynamic channel allocation (default: static allocation)" << std::endl;
+        std::cerr << "  -optimal                    Assign notes to channels offline, keeping the most important notes (overrides -d)" << std::endl;
+        std::cerr << "  -arpeggio <frames>          Play chord notes that do not fit as an arpeggio, one note every frames (implies -optimal)" << std::endl;
+        std::cerr << "  -drumkit                    With -config, play drums with their [Drum_N] sequences and declare them for DRUM" << std::endl;
         std::cerr << "  -nv                         Disable velocity changes during note on (volume fixed at note on)" << std::endl;
         std::cerr << "  -np                         Disable pitch bend and modulation (quantize to semitones only, pitch=0)" << std::endl;
         std::cerr << "  -time <seconds>             Maximum duration in seconds (default: unlimited)" << std::endl;
+        std::cerr << "  -link_horizon <seconds>     With -time, read this far past the end for note durations (default: 10)" << std::endl;
         std::cerr << "  -pitch_multiple <value>     Pitch bend multiplier (default: 1.0)" << std::endl;
         std::cerr << "  -accuracy <levels>          Volume accuracy levels 1-64 (default: 64)" << std::endl;
         std::cerr << "  -vl <levels>               Volume accuracy levels 1-64 (alias for -accuracy)" << std::endl;
@@ -977,6 +1470,16 @@ int main(int argc, char* argv[]) {
         std::cerr << "  -ch3wave <wave>             Channel 3 waveform (0=noise, 1=triangle, 2=square, 3=sawtooth, -1=auto)" << std::endl;
         std::cerr << "  -ch4wave <wave>             Channel 4 waveform (0=noise, 1=triangle, 2=square, 3=sawtooth, -1=auto)" << std::endl;
         std::cerr << "  -config <file>              Use INI configuration file for instrument settings" << std::endl;
+        std::cerr << "  -loop <start> <end>         Loop from MIDI tick start to end (default: loopStart/loopEnd markers)" << std::endl;
+        std::cerr << "  -frame_budget <n>           Max beep commands per frame, envelope steps are deferred (default: 0 = unlimited)" << std::endl;
+        std::cerr << "  -stats <file>               Write stage timings and output counts as JSON (for benchmark.py)" << std::endl;
+        std::cerr << "  -cache <dir>                Reuse the output of an earlier run with the same MIDI, options and used instruments" << std::endl;
+        std::cerr << "  -quantize <levels>          Quantize all output volumes, macros included, to 2-64 levels (default: 64)" << std::endl;
+        std::cerr << "  -envelope_rate <steps>      Keep at most this many macro steps per second (default: 0 = all)" << std::endl;
+        std::cerr << "  -drop_steps <vol>           Drop macro steps that change the volume by less than vol (default: 0)" << std::endl;
+        std::cerr << "  -envelope_jitter <frames>   Move macro steps up to this many frames onto frames already in use (default: 0)" << std::endl;
+        std::cerr << "  -budget <bytes>             Choose the four settings above to fit the song data into bytes" << std::endl;
+        std::cerr << "  -onset_jitter <frames>      Merge note events up to this many frames apart into one frame (default: 0, not chosen by -budget)" << std::endl;
         std::cerr << std::endl;
         std::cerr << "Examples:" << std::endl;
         std::cerr << "  " << argv[0] << " input.mid output.gbas" << std::endl;
@@ -1001,6 +1504,22 @@ int main(int argc, char* argv[]) {
         
         if (arg == "-d") {
             dynamic_allocation = true;
+        } else if (arg == "-optimal") {
+            optimal_voices = true;
+        } else if (arg == "-drumkit") {
+            drum_kit = true;
+        } else if (arg == "-arpeggio" && i + 1 < argc) {
+            try {
+                arpeggio_rate = std::stoi(argv[++i]);
+                if (arpeggio_rate < 1 || arpeggio_rate > 255) {
+                    std::cerr << "Error: arpeggio must be 1-255 frames." << std::endl;
+                    return 1;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "Error: Invalid arpeggio argument. Must be an integer." << std::endl;
+                return 1;
+            }
+            optimal_voices = true;
         } else if (arg == "-nv") {
             no_velocity_change = true;
         } else if (arg == "-np") {
@@ -1016,6 +1535,17 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Error: Invalid time argument. Must be a number." << std::endl;
                 return 1;
             }
+        } else if (arg == "-link_horizon" && i + 1 < argc) {
+            try {
+                link_horizon_seconds = std::stod(argv[++i]);
+                if (link_horizon_seconds < 0) {
+                    std::cerr << "Error: link_horizon must not be negative." << std::endl;
+                    return 1;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "Error: Invalid link_horizon argument. Must be a number." << std::endl;
+                return 1;
+            }
         } else if (arg == "-pitch_multiple" && i + 1 < argc) {
             try {
                 pitch_bend_multiplier = std::stod(argv[++i]);
@@ -1128,12 +1658,72 @@ int main(int argc, char* argv[]) {
             }
         } else if (arg == "-config" && i + 1 < argc) {
             config_file = argv[++i];
+        } else if (arg == "-loop" && i + 2 < argc) {
+            try {
+                loop_start_midi_tick = std::stol(argv[++i]);
+                loop_end_midi_tick = std::stol(argv[++i]);
+                if (loop_start_midi_tick < 0 || (loop_end_midi_tick != -1 && loop_end_midi_tick <= loop_start_midi_tick)) {
+                    std::cerr << "Error: loop start must be positive and before loop end (-1 = end of song)." << std::endl;
+                    return 1;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "Error: Invalid loop argument. Must be two integers." << std::endl;
+                return 1;
+            }
+        } else if (arg == "-stats" && i + 1 < argc) {
+            stats_file = argv[++i];
+        } else if (arg == "-cache" && i + 1 < argc) {
+            cache_dir = argv[++i];
+        } else if ((arg == "-quantize" || arg == "-envelope_rate" || arg == "-drop_steps" ||
+                    arg == "-envelope_jitter" || arg == "-onset_jitter") && i + 1 < argc) {
+            try {
+                int value = std::stoi(argv[++i]);
+                if (value < 0 || (arg == "-quantize" && (value < 2 || value > 64))) {
+                    std::cerr << "Error: " << arg.substr(1) << " out of range." << std::endl;
+                    return 1;
+                }
+                if (arg == "-quantize") quantize_levels = value;
+                else if (arg == "-envelope_rate") envelope_rate = value;
+                else if (arg == "-drop_steps") drop_steps = value;
+                else if (arg == "-envelope_jitter") envelope_jitter = value;
+                else onset_jitter = value;
+            } catch (const std::exception& e) {
+                std::cerr << "Error: Invalid " << arg.substr(1) << " argument. Must be an integer." << std::endl;
+                return 1;
+            }
+        } else if (arg == "-budget" && i + 1 < argc) {
+            try {
+                byte_budget = std::stol(argv[++i]);
+                if (byte_budget <= 0) {
+                    std::cerr << "Error: budget must be a positive number of bytes." << std::endl;
+                    return 1;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "Error: Invalid budget argument. Must be an integer." << std::endl;
+                return 1;
+            }
+        } else if (arg == "-frame_budget" && i + 1 < argc) {
+            try {
+                frame_budget = std::stoi(argv[++i]);
+                if (frame_budget < 0) {
+                    std::cerr << "Error: frame_budget must be a non-negative integer." << std::endl;
+                    return 1;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "Error: Invalid frame_budget argument. Must be an integer." << std::endl;
+                return 1;
+            }
         } else {
             std::cerr << "Error: Unknown option '" << arg << "'" << std::endl;
             return 1;
         }
     }
 
+    if (drum_kit && config_file.empty()) {
+        std::cerr << "Error: -drumkit needs the [Drum_N] sections of -config." << std::endl;
+        return 1;
+    }
+
     // 如果指定了配置文件，则解析配置文件
     if (!config_file.empty()) {
         config_parser = new IniParser();
@@ -1155,7 +1745,76 @@ int main(int argc, char* argv[]) {
     }
 
     MidiFileParserImpl parser(config_parser);
-    std::vector<CustomMidiEvent> midi_events = parser.parse(midi_filepath, max_duration_seconds, dynamic_allocation, no_velocity_change, config_parser);
+    parser.set_link_horizon(link_horizon_seconds);
+    parser.set_optimal_voices(optimal_voices);
+    parser.set_arpeggio(arpeggio_rate > 0);
+    auto stage_start = std::chrono::steady_clock::now();
+    std::vector<CustomMidiEvent> midi_events = parser.parse(midi_filepath, max_duration_seconds, dynamic_allocation && !optimal_voices, no_velocity_change, config_parser);
+
+    double allocate_seconds = seconds_since(stage_start) - parser.get_read_seconds() - parser.get_link_seconds();
+
+    // 转换缓存：键由转换器版本、MIDI 文件内容和文件名、影响输出的命令行参数，
+    // 以及配置文件中 General 节和本曲实际用到的乐器和鼓声节组成，
+    // 修改一个乐器只会让用到它的歌曲重新转换。-optimal 按所有音符的释放长度分配声部，
+    // 音符全被丢弃的乐器也会改变结果，所以它们也算用到
+    std::string cache_path = "";
+    if (!cache_dir.empty()) {
+        uint64_t key = fnv1a(0xcbf29ce484222325ULL, __DATE__ " " __TIME__);
+        std::ifstream midi_in(midi_filepath, std::ios::binary);
+        std::string midi_bytes((std::istreambuf_iterator<char>(midi_in)), std::istreambuf_iterator<char>());
+        key = fnv1a(key, midi_bytes);
+        key = fnv1a(key, midifile_name);
+        for (int i = 3; i < argc; i++) {
+            std::string arg = argv[i];
+            if ((arg == "-cache" || arg == "-stats" || arg == "-config") && i + 1 < argc) {
+                i++;
+                continue;
+            }
+            key = fnv1a(key, arg);
+        }
+        if (config_parser) {
+            std::set<int> programs;
+            std::set<int> drum_notes;
+            for (const auto& event : midi_events) {
+                programs.insert(event.program);
+                if (event.original_midi_channel == 9 && event.note >= 27 && event.note <= 87) {
+                    drum_notes.insert(event.note);
+                }
+            }
+            if (optimal_voices) {
+                programs.insert(parser.get_optimal_programs().begin(), parser.get_optimal_programs().end());
+                drum_notes.insert(parser.get_optimal_drum_notes().begin(), parser.get_optimal_drum_notes().end());
+            }
+            key = fnv1a(key, "General\n" + config_parser->getSectionText("General"));
+            for (int program : programs) {
+                std::string section = "Instrument_" + std::to_string(program);
+                key = fnv1a(key, section + "\n" + config_parser->getSectionText(section));
+            }
+            for (int note : drum_notes) {
+                std::string section = "Drum_" + std::to_string(note);
+                key = fnv1a(key, section + "\n" + config_parser->getSectionText(section));
+            }
+        }
+        char key_text[17];
+        std::snprintf(key_text, sizeof(key_text), "%016llx", static_cast<unsigned long long>(key));
+        cache_path = (std::filesystem::path(cache_dir) / (std::string(key_text) + ".gbas")).string();
+
+        std::error_code ec;
+        if (std::filesystem::exists(cache_path, ec)) {
+            output_file.close();
+            std::filesystem::copy_file(cache_path, output_filepath, std::filesystem::copy_options::overwrite_existing, ec);
+            if (ec) {
+                std::cerr << "Error: Could not copy " << cache_path << " to " << output_filepath << ": " << ec.message() << std::endl;
+                delete config_parser;
+                return 1;
+            }
+            std::cerr << "Cache hit: " << cache_path << std::endl;
+            delete config_parser;
+            return 0;
+        }
+    }
+
+    stage_start = std::chrono::steady_clock::now();
 
     long ppqn = parser.get_ppqn();
     long tempo_us = parser.get_tempo(); // 微秒/四分音符
@@ -1661,8 +2320,24 @@ if (max_duration_seconds > 0) {
     max_gigatron_tick = static_cast<long>(max_duration_seconds * 60.0 / speed_multiplier); // 1秒 = 60 Gigatron ticks
 }
 
+    // 循环区间 (Gigatron tick)：命令行 -loop 优先，其次是 MIDI 中的 loopStart/loopEnd 标记
+    long loop_start_tick = -1;
+    long loop_end_tick = -1;
+    {
+        long start_midi_tick = (loop_start_midi_tick != -1) ? loop_start_midi_tick : parser.get_loop_start();
+        long end_midi_tick = (loop_start_midi_tick != -1) ? loop_end_midi_tick : parser.get_loop_end();
+        if (start_midi_tick >= 0) {
+            loop_start_tick = std::max(1L, static_cast<long>(start_midi_tick * gigatron_ticks_per_midi_tick));
+            if (end_midi_tick > start_midi_tick) {
+                loop_end_tick = static_cast<long>(end_midi_tick * gigatron_ticks_per_midi_tick);
+            }
+        }
+    }
+    long output_ticks = 0; // 输出的帧数（包括宏事件）
+    long beep_count = 0;
+
     // 将 MIDI 事件按时间戳分组，以便同时播放多个通道
-    std::map<long, std::vector<CustomMidiEvent>> events_by_tick;
+    std::map<long, std::vector<CustomMidiEvent>> scheduled_events;
     
     for (const auto& event : midi_events) {
         long gigatron_start_tick = static_cast<long>(event.timestamp * gigatron_ticks_per_midi_tick);
@@ -1671,347 +2346,845 @@ if (max_duration_seconds > 0) {
         CustomMidiEvent modified_event = event;
         // The channel in modified_event is already the mapped Gigatron channel from MidiFileParserImpl::parse
         
-        events_by_tick[gigatron_start_tick].push_back(modified_event);
+        scheduled_events[gigatron_start_tick].push_back(modified_event);
     }
-    
-    output_file << "proc music_data '先定时，再演奏，一次性演奏4个通道" << std::endl;
-    output_file << "start:" << std::endl;
-    // 获取第一个eatSound_Timer的时间数值减去1
-    // 首先获取第一个事件的时间戳
-    if (!events_by_tick.empty()) {
-        long first_tick = events_by_tick.begin()->first;
-        output_file << "\ttick_sum=" << (first_tick - 1) << std::endl;
-    } else {
-        output_file << "\ttick_sum=0" << std::endl;
+
+    // -onset_jitter：每个 tick 单独取整，同一和弦的音符常常相差一帧。把相差不超过
+    // onset_jitter 帧的事件并入较早的帧，省掉中间的延时和一次 vIRQ 唤醒。
+    // 不跨越循环的起点和终点；某个通道在较早的帧有音符起始时，不并入它的其他事件，
+    // 否则这个音符的长度会变成 0
+    if (onset_jitter > 0) {
+        auto loop_side = [&](long tick) {
+            return (loop_start_tick != -1 && tick >= loop_start_tick ? 1 : 0) +
+                   (loop_end_tick != -1 && tick >= loop_end_tick ? 1 : 0);
+        };
+        long merged_ticks = 0;
+        auto anchor = scheduled_events.begin();
+        while (anchor != scheduled_events.end()) {
+            auto it = std::next(anchor);
+            while (it != scheduled_events.end() && it->first - anchor->first <= onset_jitter &&
+                   loop_side(it->first) == loop_side(anchor->first)) {
+                bool blocked = false;
+                for (const auto& event : it->second) {
+                    for (const auto& earlier : anchor->second) {
+                        if (earlier.channel == event.channel && !earlier.is_note_off && earlier.velocity > 0) {
+                            blocked = true;
+                        }
+                    }
+                }
+                if (blocked) break;
+                anchor->second.insert(anchor->second.end(), it->second.begin(), it->second.end());
+                it = scheduled_events.erase(it);
+                merged_ticks++;
+            }
+            anchor = it;
+        }
+        std::cerr << "Onset jitter: merged " << merged_ticks << " frames into earlier ones." << std::endl;
     }
+
+    double schedule_seconds = seconds_since(stage_start);
+    double expand_seconds = 0;
+    bool budget_search = false; // 搜索 -budget 参数时不输出宏事件的调试信息
+    bool budget_failed = false;
     
-    std::map<long, std::vector<CustomMidiEvent>> macro_events; // 存储宏事件
-    
-    // 如果使用了配置文件，为每个Note On事件生成宏序列事件
-    if (config_parser) {
+    // 生成 music_data 过程：宏展开和逐帧输出。每次调用都从相同的事件开始，
+    // -budget 用不同的质量参数多次生成，比较大小和误差
+    auto write_music_data = [&](std::ostream& out) {
+        std::map<long, std::vector<CustomMidiEvent>> events_by_tick = scheduled_events;
+        long loop_first_tick = -1; // 循环体第一个事件的 tick，-1 表示不循环
+        long last_tick = 0; // 最后输出的 tick
+        std::map<int, ChannelState> loop_channel_states; // 进入循环体时各通道的状态
+        active_note_final_off_ticks.clear();
+        for (int i = 1; i <= 4; ++i) {
+            last_output_note[i] = -1;
+            last_output_vol[i] = -1;
+            last_output_wave[i] = -1;
+            last_output_pitch_bend[i] = -9999;
+            channel_is_on[i] = false;
+        }
+        beep_count = 0;
+        stage_start = std::chrono::steady_clock::now();
+
+        out << "proc music_data '先定时，再演奏，一次性演奏4个通道" << std::endl;
+        // -drumkit：声明用到的鼓声每 rate 帧一步的 (音符, 音量)，到音量 0 为止。
+        // gbas_to_c.py 把符合声明的命令换成 DRUM，由 vIRQ 步进
+        if (drum_kit) {
+            std::set<int> drum_notes;
+            for (const auto& pair : events_by_tick) {
+                for (const auto& event : pair.second) {
+                    if (event.original_midi_channel == 9 && event.note >= 27 && event.note <= 87 && !event.is_note_off) {
+                        drum_notes.insert(event.note);
+                    }
+                }
+            }
+            for (int note : drum_notes) {
+                std::vector<int> vol_sequence = get_drum_sequence(note, "vol", config_parser);
+                std::vector<int> pitch_bend_sequence = get_drum_sequence(note, "pitch_bend", config_parser);
+                int accuracy = cmd_volume_levels != -1 ? cmd_volume_levels : get_drum_accuracy(note, config_parser);
+                long rate = std::max(1L, static_cast<long>(std::round(60.0 / accuracy)));
+                std::ostringstream steps;
+                for (size_t i = 0; i < vol_sequence.size(); ++i) {
+                    int vol = std::max(0, std::min(63, vol_sequence[i]));
+                    if (quantize_levels < 64 && vol > 0) {
+                        vol = simplify_volume(vol, quantize_levels);
+                    }
+                    if (vol == 0) {
+                        break;
+                    }
+                    int bend = i < pitch_bend_sequence.size() ? pitch_bend_sequence[i] : 0;
+                    steps << "," << convert_midi_note(note + static_cast<int>(std::round(bend / 100.0))) << "," << vol;
+                }
+                if (rate <= 255 && !steps.str().empty()) {
+                    out << "'drum " << note << "," << rate << "," << get_drum_waveform(note, config_parser) << steps.str() << std::endl;
+                }
+            }
+        }
+        // 自定义波形：音符开始时，它的波形槽要装着这个乐器的采样。每个槽第一次用到的
+        // 波形在歌曲开始时装入，之后换成别的波形时在音符开始的帧装入
+        std::map<int, std::vector<int>> wavetables; // 乐器 -> 采样，空表示没有自定义波形
+        std::map<int, const std::vector<int>*> slot_waves; // 每个波形槽装着的采样
+        std::map<int, const std::vector<int>*> loop_slot_waves; // 进入循环体时各波形槽装着的采样
+        auto onset_wavetable = [&](const CustomMidiEvent& event) -> const std::vector<int>* {
+            if (event.is_note_off || event.velocity <= 0 || event.is_macro_event || event.is_pitch_bend_change ||
+                event.is_volume_change || event.is_velocity_change || channel_waveforms[event.channel] != -1 ||
+                (event.original_midi_channel == 9 && event.note >= 27 && event.note <= 87)) {
+                return nullptr;
+            }
+            auto it = wavetables.find(event.program);
+            if (it == wavetables.end()) {
+                it = wavetables.emplace(event.program, get_instrument_wavetable(event.program, config_parser)).first;
+            }
+            return it->second.empty() ? nullptr : &it->second;
+        };
+        auto emit_wave = [&](int slot, const std::vector<int>* samples) {
+            out << "'wave " << slot;
+            for (int sample : *samples) out << "," << sample;
+            out << std::endl;
+            slot_waves[slot] = samples;
+        };
+        out << "start:" << std::endl;
+        // 获取第一个eatSound_Timer的时间数值减去1
+        // 首先获取第一个事件的时间戳
+        if (!events_by_tick.empty()) {
+            long first_tick = events_by_tick.begin()->first;
+            out << "\ttick_sum=" << (first_tick - 1) << std::endl;
+        } else {
+            out << "\ttick_sum=0" << std::endl;
+        }
         for (const auto& pair : events_by_tick) {
-            long tick = pair.first;
             for (const auto& event : pair.second) {
-                // 只处理Note On事件（非Note Off且速度大于0）
-                if (!event.is_note_off && event.velocity > 0) {
-                    // 获取乐器配置
-                    int program = event.program;
-                    // 使用 original_midi_channel 来判断是否是鼓声通道 (MIDI Channel 9, 即索引 9)
-                    bool is_drum = (event.original_midi_channel == 9 && event.note >= 27 && event.note <= 87);
+                const std::vector<int>* samples = onset_wavetable(event);
+                int slot = convert_midi_waveform(event.program, config_parser) & 3;
+                if (samples && !slot_waves.count(slot)) emit_wave(slot, samples);
+            }
+        }
+
+        std::map<long, std::vector<CustomMidiEvent>> macro_events; // 存储宏事件
+
+        // -envelope_jitter：已经有事件的帧，宏步骤尽量并入这些帧。
+        // 不能越过同一通道的其他事件，也不能并入同一通道已经有事件的帧
+        std::set<long> used_ticks;
+        std::map<int, std::set<long>> channel_ticks;
+        for (const auto& pair : events_by_tick) {
+            used_ticks.insert(pair.first);
+            for (const auto& event : pair.second) channel_ticks[event.channel].insert(pair.first);
+        }
+        // 在 [lo, hi) 内找离 t 最近、相差不超过 envelope_jitter 的已用帧，没有则占用 t
+        auto snap_macro_tick = [&](int channel, long t, long lo, long hi) {
+            std::set<long>& own = channel_ticks[channel];
+            if (envelope_jitter > 0 && !own.count(t)) {
+                auto next = own.upper_bound(t);
+                if (next != own.end()) hi = std::min(hi, *next);
+                if (next != own.begin()) lo = std::max(lo, *std::prev(next) + 1);
+                long best = -1;
+                for (auto it = used_ticks.lower_bound(std::max(lo, t - envelope_jitter));
+                     it != used_ticks.end() && *it <= t + envelope_jitter && *it < hi; ++it) {
+                    if (best == -1 || std::abs(*it - t) < std::abs(best - t)) best = *it;
+                }
+                if (best != -1) t = best;
+            }
+            used_ticks.insert(t);
+            own.insert(t);
+            return t;
+        };
+        // -drop_steps：相对上一个保留的步骤，变化太小的步骤不输出
+        auto drop_macro_step = [&](const CustomMidiEvent& step, const CustomMidiEvent* kept) {
+            return kept && drop_steps > 0 &&
+                   std::abs(step.volume - kept->volume) < drop_steps &&
+                   step.wave_value == kept->wave_value && step.pitch_bend == kept->pitch_bend;
+        };
+    
+        // 如果使用了配置文件，为每个Note On事件生成宏序列事件
+        if (config_parser) {
+            for (const auto& pair : events_by_tick) {
+                long tick = pair.first;
+                for (const auto& event : pair.second) {
+                    // 只处理Note On事件（非Note Off且速度大于0）
+                    if (!event.is_note_off && event.velocity > 0) {
+                        // 获取乐器配置
+                        int program = event.program;
+                        // 使用 original_midi_channel 来判断是否是鼓声通道 (MIDI Channel 9, 即索引 9)
+                        bool is_drum = (event.original_midi_channel == 9 && event.note >= 27 && event.note <= 87);
+                        // -drumkit：有音量序列的鼓声像乐器一样展开，Note Off 时停止
+                        std::vector<int> drum_vol_sequence;
+                        if (is_drum && drum_kit) {
+                            drum_vol_sequence = get_drum_sequence(event.note, "vol", config_parser);
+                        }
                     
-                    // 获取精度
-                    int instrument_config_accuracy = default_volume_levels; // 存储配置文件中的精度
-                    if (config_parser) {
-                        instrument_config_accuracy = is_drum ? get_drum_accuracy(event.note, config_parser) : get_instrument_accuracy(program, config_parser);
-                    }
+                        // 获取精度
+                        int instrument_config_accuracy = default_volume_levels; // 存储配置文件中的精度
+                        if (config_parser) {
+                            instrument_config_accuracy = is_drum ? get_drum_accuracy(event.note, config_parser) : get_instrument_accuracy(program, config_parser);
+                        }
 
-                    int current_effective_accuracy = instrument_config_accuracy; // 默认使用配置文件中的精度
-                    // 如果命令行指定了精度，则使用命令行指定的精度，优先级高于配置文件
-                    if (cmd_volume_levels != -1) {
-                        current_effective_accuracy = cmd_volume_levels;
-                    }
+                        int current_effective_accuracy = instrument_config_accuracy; // 默认使用配置文件中的精度
+                        // 如果命令行指定了精度，则使用命令行指定的精度，优先级高于配置文件
+                        if (cmd_volume_levels != -1) {
+                            current_effective_accuracy = cmd_volume_levels;
+                        }
                     
-                    // 计算音符持续时间（以Gigatron tick为单位）
-                    long duration_ticks = static_cast<long>(event.duration * gigatron_ticks_per_midi_tick);
+                        // 计算音符持续时间（以Gigatron tick为单位）
+                        long duration_ticks = static_cast<long>(event.duration * gigatron_ticks_per_midi_tick);
                     
-                    // 如果有持续时间，生成宏序列事件
-                    if (duration_ticks > 0) {
-                        // 获取宏序列
-                        std::vector<int> vol_sequence = is_drum ?
-                            std::vector<int>{63} : get_instrument_volume_sequence(program, config_parser);
-                        std::vector<int> wave_sequence = is_drum ?
-                            std::vector<int>{get_drum_waveform(event.note, config_parser)} : get_instrument_waveform_sequence(program, config_parser);
-                        std::vector<int> pitch_bend_sequence = is_drum ?
-                            std::vector<int>{0} : get_instrument_pitch_bend_sequence(program, config_parser);
-                        int note_offset = is_drum ? 0 : get_instrument_note_offset(program, config_parser);
+                        // 如果有持续时间，生成宏序列事件
+                        if (duration_ticks > 0) {
+                            // 获取宏序列
+                            std::vector<int> vol_sequence = is_drum ?
+                                (drum_vol_sequence.empty() ? std::vector<int>{63} : drum_vol_sequence) : get_instrument_volume_sequence(program, config_parser);
+                            std::vector<int> wave_sequence = is_drum ?
+                                std::vector<int>{get_drum_waveform(event.note, config_parser)} : get_instrument_waveform_sequence(program, config_parser);
+                            std::vector<int> pitch_bend_sequence = is_drum ?
+                                (drum_vol_sequence.empty() ? std::vector<int>{0} : get_drum_sequence(event.note, "pitch_bend", config_parser)) :
+                                get_instrument_pitch_bend_sequence(program, config_parser);
+                            int note_offset = is_drum ? 0 : get_instrument_note_offset(program, config_parser);
                         
-                        // 获取释放序列
-                        std::vector<int> release_vol_sequence = is_drum ?
-                            std::vector<int>{0} : get_instrument_release_volume_sequence(program, config_parser);
-                        std::vector<int> release_wave_sequence = is_drum ?
-                            std::vector<int>{0} : get_instrument_release_waveform_sequence(program, config_parser);
-                        std::vector<int> release_pitch_bend_sequence = is_drum ?
-                            std::vector<int>{0} : get_instrument_release_pitch_bend_sequence(program, config_parser);
+                            // 获取释放序列
+                            std::vector<int> release_vol_sequence = is_drum ?
+                                std::vector<int>{0} : get_instrument_release_volume_sequence(program, config_parser);
+                            std::vector<int> release_wave_sequence = is_drum ?
+                                std::vector<int>{0} : get_instrument_release_waveform_sequence(program, config_parser);
+                            std::vector<int> release_pitch_bend_sequence = is_drum ?
+                                std::vector<int>{0} : get_instrument_release_pitch_bend_sequence(program, config_parser);
+                            // 有自定义波形的乐器一直使用它的波形槽（wave= 的第一个值），不再逐步切换波形
+                            if (!is_drum && !get_instrument_wavetable(program, config_parser).empty()) {
+                                wave_sequence = {convert_midi_waveform(program, config_parser)};
+                                release_wave_sequence = wave_sequence;
+                            }
                         
-                        // 计算每个宏事件的时间间隔，基于 60 Gigatron ticks/second 和有效精度
-                        long tick_increment = static_cast<long>(std::round(60.0 / current_effective_accuracy));
-                        if (tick_increment == 0) tick_increment = 1; // 避免除以零或间隔为零
-
-                        long note_on_gigatron_tick = tick; // Note On 事件的 Gigatron tick
-                        long midi_note_off_gigatron_tick = tick + duration_ticks; // 原始 MIDI Note Off 应该发生的 Gigatron tick
-
-                        // 计算释放宏的持续时间
-                        long release_duration_ticks = release_vol_sequence.size() * tick_increment;
-                        // 最终的 Note Off 时间点，包括释放宏的持续时间
-                        long final_note_off_gigatron_tick = midi_note_off_gigatron_tick + release_duration_ticks;
-
-                        // 存储最终的 Note Off 时间点，用于后续判断是否忽略原始 Note Off 事件
-                        // 使用 (channel, note) 作为键，因为一个通道可能同时播放多个音符（在动态分配模式下）
-                        // 并且宏是针对单个音符的
-                        active_note_final_off_ticks[{event.channel, event.note}] = final_note_off_gigatron_tick;
-
-                        // 生成音符持续期间的宏序列事件
-                        for (size_t i = 0; i < vol_sequence.size(); ++i) {
-                            long macro_tick = note_on_gigatron_tick + i * tick_increment;
-                            
-                            // 如果宏事件超出了原始 MIDI Note Off 的时间，则停止生成
-                            if (macro_tick >= midi_note_off_gigatron_tick) {
-                                break;
+                            // 计算每个宏事件的时间间隔，基于 60 Gigatron ticks/second 和有效精度
+                            long tick_increment = static_cast<long>(std::round(60.0 / current_effective_accuracy));
+                            if (tick_increment == 0) tick_increment = 1; // 避免除以零或间隔为零
+
+                            // -envelope_rate：每 step_stride 步保留一步，包络的总长度不变
+                            size_t step_stride = 1;
+                            if (envelope_rate > 0) {
+                                step_stride = std::max(1L, static_cast<long>(std::round(60.0 / envelope_rate / tick_increment)));
                             }
+                            CustomMidiEvent last_kept_step = event;
+                            bool have_kept_step = false;
+                            long last_step_tick = tick - 1;
+
+                            long note_on_gigatron_tick = tick; // Note On 事件的 Gigatron tick
+                            long midi_note_off_gigatron_tick = tick + duration_ticks; // 原始 MIDI Note Off 应该发生的 Gigatron tick
+
+                            // 计算释放宏的持续时间
+                            long release_duration_ticks = release_vol_sequence.size() * tick_increment;
+                            // 最终的 Note Off 时间点，包括释放宏的持续时间
+                            long final_note_off_gigatron_tick = midi_note_off_gigatron_tick + release_duration_ticks;
+
+                            // 存储最终的 Note Off 时间点，用于后续判断是否忽略原始 Note Off 事件
+                            // 使用 (channel, note) 作为键，因为一个通道可能同时播放多个音符（在动态分配模式下）
+                            // 并且宏是针对单个音符的
+                            active_note_final_off_ticks[{event.channel, event.note}] = final_note_off_gigatron_tick;
+
+                            // 生成音符持续期间的宏序列事件
+                            for (size_t i = 0; i < vol_sequence.size(); ++i) {
+                                long macro_tick = note_on_gigatron_tick + i * tick_increment;
+                            
+                                // 如果宏事件超出了原始 MIDI Note Off 的时间，则停止生成
+                                if (macro_tick >= midi_note_off_gigatron_tick) {
+                                    break;
+                                }
+                                if (i % step_stride != 0) {
+                                    continue;
+                                }
 
-                            CustomMidiEvent macro_event = event;
-                            macro_event.timestamp = macro_tick;
-                            macro_event.duration = 0; // 宏事件没有持续时间
-                            macro_event.is_macro_event = true; // 标记为宏事件
+                                CustomMidiEvent macro_event = event;
+                                macro_event.timestamp = macro_tick;
+                                macro_event.duration = 0; // 宏事件没有持续时间
+                                macro_event.is_macro_event = true; // 标记为宏事件
                             
-                            // 应用宏值
-                            if (i < vol_sequence.size()) {
-                                int macro_vol_base = std::max(0, std::min(63, vol_sequence[i]));
-                                // 对于宏事件，直接使用宏定义的音量，不进行简化和音量抬升
-                                macro_event.volume = macro_vol_base;
-                                std::cerr << "DEBUG: Macro Event - Tick: " << macro_tick << ", Channel: " << macro_event.channel
-                                          << ", Note: " << macro_event.note << ", Macro Vol Base: " << macro_vol_base
-                                          << ", Final Vol (Macro): " << macro_event.volume << std::endl;
-                            }
+                                // 应用宏值
+                                if (i < vol_sequence.size()) {
+                                    int macro_vol_base = std::max(0, std::min(63, vol_sequence[i]));
+                                    // 对于宏事件，直接使用宏定义的音量，不进行简化和音量抬升
+                                    macro_event.volume = macro_vol_base;
+                                    if (!budget_search) std::cerr << "DEBUG: Macro Event - Tick: " << macro_tick << ", Channel: " << macro_event.channel
+                                              << ", Note: " << macro_event.note << ", Macro Vol Base: " << macro_vol_base
+                                              << ", Final Vol (Macro): " << macro_event.volume << std::endl;
+                                }
                             
-                            if (!wave_sequence.empty()) {
-                                if (i < wave_sequence.size()) {
-                                    macro_event.wave_value = wave_sequence[i];
+                                if (!wave_sequence.empty()) {
+                                    if (i < wave_sequence.size()) {
+                                        macro_event.wave_value = wave_sequence[i];
+                                    } else {
+                                        // 如果索引超出范围，使用序列中的最后一个波形值
+                                        macro_event.wave_value = wave_sequence.back();
+                                    }
                                 } else {
-                                    // 如果索引超出范围，使用序列中的最后一个波形值
-                                    macro_event.wave_value = wave_sequence.back();
+                                    // 如果波形序列为空，使用默认波形（例如三角波）
+                                    macro_event.wave_value = 1;
                                 }
-                            } else {
-                                // 如果波形序列为空，使用默认波形（例如三角波）
-                                macro_event.wave_value = 1;
-                            }
                             
-                            if (i < pitch_bend_sequence.size()) {
-                                macro_event.pitch_bend = pitch_bend_sequence[i] / 100.0; // 转换为半音单位
-                            }
+                                if (i < pitch_bend_sequence.size()) {
+                                    macro_event.pitch_bend = pitch_bend_sequence[i] / 100.0; // 转换为半音单位
+                                }
                             
-                            // 应用音高偏移
-                            macro_event.note = event.note + note_offset;
+                                // 应用音高偏移
+                                macro_event.note = event.note + note_offset;
+
+                                if (i > 0 && drop_macro_step(macro_event, have_kept_step ? &last_kept_step : nullptr)) {
+                                    continue;
+                                }
+                                if (i > 0) {
+                                    macro_tick = snap_macro_tick(macro_event.channel, macro_tick, last_step_tick + 1, midi_note_off_gigatron_tick);
+                                    macro_event.timestamp = macro_tick;
+                                }
+                                last_kept_step = macro_event;
+                                have_kept_step = true;
+                                last_step_tick = macro_tick;
                             
-                            macro_events[macro_tick].push_back(macro_event);
-                        }
+                                macro_events[macro_tick].push_back(macro_event);
+                            }
                         
-                        // 生成音符释放后的宏序列事件
-                        for (size_t i = 0; i < release_vol_sequence.size(); ++i) {
-                            long release_macro_tick = midi_note_off_gigatron_tick + i * tick_increment;
+                            // 生成音符释放后的宏序列事件
+                            last_step_tick = std::max(last_step_tick, midi_note_off_gigatron_tick - 1);
+                            for (size_t i = 0; i < release_vol_sequence.size(); ++i) {
+                                long release_macro_tick = midi_note_off_gigatron_tick + i * tick_increment;
+                                if (i % step_stride != 0) {
+                                    continue;
+                                }
                             
-                            CustomMidiEvent release_macro_event = event;
-                            release_macro_event.timestamp = release_macro_tick;
-                            release_macro_event.duration = 0; // 宏事件没有持续时间
-                            release_macro_event.is_macro_event = true; // 标记为宏事件
-                            release_macro_event.is_release_event = true; // 标记为释放事件
+                                CustomMidiEvent release_macro_event = event;
+                                release_macro_event.timestamp = release_macro_tick;
+                                release_macro_event.duration = 0; // 宏事件没有持续时间
+                                release_macro_event.is_macro_event = true; // 标记为宏事件
+                                release_macro_event.is_release_event = true; // 标记为释放事件
                             
-                            // 应用释放宏值
-                            if (i < release_vol_sequence.size()) {
-                                int release_macro_vol_base = std::max(0, std::min(63, release_vol_sequence[i]));
-                                release_macro_event.volume = release_macro_vol_base;
-                                std::cerr << "DEBUG: Release Macro Event - Tick: " << release_macro_tick << ", Channel: " << release_macro_event.channel
-                                          << ", Note: " << release_macro_event.note << ", Release Macro Vol Base: " << release_macro_vol_base
-                                          << ", Final Vol (Release Macro): " << release_macro_event.volume << std::endl;
-                            }
+                                // 应用释放宏值
+                                if (i < release_vol_sequence.size()) {
+                                    int release_macro_vol_base = std::max(0, std::min(63, release_vol_sequence[i]));
+                                    release_macro_event.volume = release_macro_vol_base;
+                                    if (!budget_search) std::cerr << "DEBUG: Release Macro Event - Tick: " << release_macro_tick << ", Channel: " << release_macro_event.channel
+                                              << ", Note: " << release_macro_event.note << ", Release Macro Vol Base: " << release_macro_vol_base
+                                              << ", Final Vol (Release Macro): " << release_macro_event.volume << std::endl;
+                                }
                             
-                            if (!release_wave_sequence.empty()) {
-                                if (i < release_wave_sequence.size()) {
-                                    release_macro_event.wave_value = release_wave_sequence[i];
+                                if (!release_wave_sequence.empty()) {
+                                    if (i < release_wave_sequence.size()) {
+                                        release_macro_event.wave_value = release_wave_sequence[i];
+                                    } else {
+                                        // 如果索引超出范围，使用序列中的最后一个波形值
+                                        release_macro_event.wave_value = release_wave_sequence.back();
+                                    }
                                 } else {
-                                    // 如果索引超出范围，使用序列中的最后一个波形值
-                                    release_macro_event.wave_value = release_wave_sequence.back();
+                                    // 如果释放波形序列为空，使用默认波形（例如三角波）
+                                    release_macro_event.wave_value = 1;
                                 }
-                            } else {
-                                // 如果释放波形序列为空，使用默认波形（例如三角波）
-                                release_macro_event.wave_value = 1;
-                            }
                             
-                            if (i < release_pitch_bend_sequence.size()) {
-                                release_macro_event.pitch_bend = release_pitch_bend_sequence[i] / 100.0; // 转换为半音单位
-                            }
+                                if (i < release_pitch_bend_sequence.size()) {
+                                    release_macro_event.pitch_bend = release_pitch_bend_sequence[i] / 100.0; // 转换为半音单位
+                                }
                             
-                            // 应用音高偏移
-                            release_macro_event.note = event.note + note_offset;
+                                // 应用音高偏移
+                                release_macro_event.note = event.note + note_offset;
+
+                                if (i > 0 && drop_macro_step(release_macro_event, have_kept_step ? &last_kept_step : nullptr)) {
+                                    continue;
+                                }
+                                if (i > 0) {
+                                    release_macro_tick = snap_macro_tick(release_macro_event.channel, release_macro_tick, last_step_tick + 1, final_note_off_gigatron_tick);
+                                    release_macro_event.timestamp = release_macro_tick;
+                                }
+                                last_kept_step = release_macro_event;
+                                have_kept_step = true;
+                                last_step_tick = release_macro_tick;
                             
-                            macro_events[release_macro_tick].push_back(release_macro_event);
-                        }
+                                macro_events[release_macro_tick].push_back(release_macro_event);
+                            }
 
-                        // 在最终的 Note Off 时间点添加一个 sound off 事件
-                        // 只有当有释放宏时才添加这个最终的 Note Off 事件，否则使用原始的 Note Off
-                        if (!release_vol_sequence.empty()) {
-                            CustomMidiEvent final_note_off_event = event; // 复制原始 Note On 事件
-                            final_note_off_event.timestamp = final_note_off_gigatron_tick;
-                            final_note_off_event.duration = 0;
-                            final_note_off_event.is_note_off = true; // 标记为最终的 Note Off 事件
-                            final_note_off_event.is_macro_event = false; // 这不是宏事件，而是最终的音符关闭
-                            final_note_off_event.is_release_event = false; // 这不是释放宏事件
-                            final_note_off_event.volume = 0; // 确保最终的 Note Off 事件音量为 0
-                            macro_events[final_note_off_gigatron_tick].push_back(final_note_off_event);
+                            // 在最终的 Note Off 时间点添加一个 sound off 事件
+                            // 只有当有释放宏时才添加这个最终的 Note Off 事件，否则使用原始的 Note Off
+                            if (!release_vol_sequence.empty()) {
+                                CustomMidiEvent final_note_off_event = event; // 复制原始 Note On 事件
+                                final_note_off_event.timestamp = final_note_off_gigatron_tick;
+                                final_note_off_event.duration = 0;
+                                final_note_off_event.is_note_off = true; // 标记为最终的 Note Off 事件
+                                final_note_off_event.is_macro_event = false; // 这不是宏事件，而是最终的音符关闭
+                                final_note_off_event.is_release_event = false; // 这不是释放宏事件
+                                final_note_off_event.volume = 0; // 确保最终的 Note Off 事件音量为 0
+                                macro_events[final_note_off_gigatron_tick].push_back(final_note_off_event);
+                            }
                         }
                     }
                 }
             }
-        }
         
-        // 将宏事件合并到events_by_tick中
-        for (const auto& pair : macro_events) {
-            // 确保宏事件不会覆盖原始的Note On事件，而是添加到现有事件之后
-            events_by_tick[pair.first].insert(events_by_tick[pair.first].end(),
-                pair.second.begin(), pair.second.end());
+            // 将宏事件合并到events_by_tick中
+            for (const auto& pair : macro_events) {
+                // 确保宏事件不会覆盖原始的Note On事件，而是添加到现有事件之后
+                events_by_tick[pair.first].insert(events_by_tick[pair.first].end(),
+                    pair.second.begin(), pair.second.end());
+            }
         }
-    }
     
-    // 按时间戳排序并生成输出
-    for (const auto& pair : events_by_tick) {
-        long tick = pair.first;
+        expand_seconds = seconds_since(stage_start);
+        stage_start = std::chrono::steady_clock::now();
+
+        // -arpeggio：每个通道正在演奏的琶音，从 start 帧开始每 arpeggio_rate 帧换一个音程，
+        // state 是没有加音程的通道状态
+        struct ArpeggioState {
+            long start;
+            std::vector<int> intervals;
+            ChannelState state;
+        };
+        std::map<int, ArpeggioState> arpeggios;
+
+        // 每个通道等待输出的状态。-frame_budget 限制每帧的 beep 数时，
+        // 音符起始总是在原来的帧输出，音量、波形和弯音的变化可以推迟到后面的帧
+        std::map<int, ChannelState> pending_channel_states;
+
+        // 该状态是否需要输出 call beep（与 emit_channel_state 的判断相同）
+        auto needs_output = [&](int channel, const ChannelState& state) {
+            if (state.vol == 0 && channel_is_on[channel]) {
+                return true;
+            }
+            bool changed = state.note != last_output_note[channel] ||
+                           state.vol != last_output_vol[channel] ||
+                           state.wave != last_output_wave[channel] ||
+                           state.pitch_bend != last_output_pitch_bend[channel];
+            return state.vol > 0 ? (changed || !channel_is_on[channel]) : (changed && !channel_is_on[channel]);
+        };
+
+        auto emit_channel_state = [&](int channel, const ChannelState& state) {
+            // 检查是否有任何参数自上次输出以来发生变化
+            bool changed = false;
+            if (state.note != last_output_note[channel] ||
+                state.vol != last_output_vol[channel] ||
+                state.wave != last_output_wave[channel] ||
+                state.pitch_bend != last_output_pitch_bend[channel])
+            {
+                changed = true;
+            }
+
+            // 如果音量为0，且通道当前是开启状态，则需要关闭声音
+            // 此时，通过将音量设置为0来隐式关闭声音，而不是显式输出 sound off
+            if (state.vol == 0 && channel_is_on[channel]) {
+                // 标记为关闭，并重置上次输出的值，以便下次音量大于0时能重新输出 call beep
+                channel_is_on[channel] = false;
+                last_output_note[channel] = -1;
+                last_output_vol[channel] = -1;
+                last_output_wave[channel] = -1;
+                last_output_pitch_bend[channel] = -9999;
+            }
         
-        // 如果设置了最大时长，并且当前事件的时间戳超过了最大 Gigatron tick，则停止处理
-        if (max_gigatron_tick != -1 && tick > max_gigatron_tick) {
-            break; // 跳出循环
-        }
+            // 只有当音量大于0时才输出 call beep，或者当音量为0但需要更新状态时
+            // 如果音量为0，且通道之前是开启状态，则不需要输出 call beep，因为已经通过上述逻辑处理了关闭
+            if (state.vol > 0 || (state.vol == 0 && changed && !channel_is_on[channel])) {
+                if (changed || !channel_is_on[channel]) { // 如果有变化或者通道之前是关闭的，则输出
+                    out << "\tcall beep," << channel << "," << state.note << "," << state.vol << "," << state.wave << "," << state.pitch_bend << std::endl;
+                    beep_count++;
+                    // 更新上次输出的值
+                    last_output_note[channel] = state.note;
+                    last_output_vol[channel] = state.vol;
+                    last_output_wave[channel] = state.wave;
+                    last_output_pitch_bend[channel] = state.pitch_bend;
+                    channel_is_on[channel] = true; // 标记为开启
+                }
+            }
+        };
+
+        // 输出当前帧等待的状态：先输出所有音符起始，其余按优先级
+        // （音量变化大的优先，其次是弯音，只改波形的最后）填满预算，剩下的留到下一帧
+        auto emit_pending = [&]() {
+            std::vector<std::pair<int, int>> deferrable; // (优先级, 通道)
+            std::map<int, bool> selected;
+            for (auto it = pending_channel_states.begin(); it != pending_channel_states.end(); ) {
+                int channel = it->first;
+                const ChannelState& state = it->second;
+                if (!needs_output(channel, state)) {
+                    it = pending_channel_states.erase(it);
+                    continue;
+                }
+                bool onset = state.vol > 0 && (!channel_is_on[channel] || state.note != last_output_note[channel]);
+                if (onset || frame_budget == 0) {
+                    selected[channel] = true;
+                } else {
+                    int priority = std::abs(state.vol - std::max(0, last_output_vol[channel])) * 4;
+                    if (state.pitch_bend != last_output_pitch_bend[channel]) priority += 2;
+                    if (state.vol == 0) priority += 256;
+                    deferrable.push_back({priority, channel});
+                }
+                ++it;
+            }
+            std::stable_sort(deferrable.begin(), deferrable.end(), [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+                return a.first > b.first;
+            });
+            for (const auto& item : deferrable) {
+                if (static_cast<int>(selected.size()) >= frame_budget) break;
+                selected[item.second] = true;
+            }
+            for (const auto& item : selected) {
+                emit_channel_state(item.first, pending_channel_states[item.first]);
+                pending_channel_states.erase(item.first);
+            }
+        };
+
+        // 在 last_tick 之后、before_tick 之前的空闲帧中输出推迟的状态
+        auto flush_pending = [&](long before_tick) {
+            while (!pending_channel_states.empty() && last_tick + 1 < before_tick) {
+                out << "\tcall eatSound_Timer," << ++last_tick << std::endl;
+                out << std::endl;
+                emit_pending();
+            }
+        };
 
-        // 先输出定时调用
-        output_file << "\tcall eatSound_Timer," << tick << std::endl;
-        output_file << std::endl;
+        // 按时间戳排序并生成输出
+        for (const auto& pair : events_by_tick) {
+            long tick = pair.first;
         
-        // 排序当前tick内的事件，确保处理顺序一致
-        std::vector<CustomMidiEvent> current_tick_events = pair.second;
-        std::sort(current_tick_events.begin(), current_tick_events.end(), [](const CustomMidiEvent& a, const CustomMidiEvent& b) {
-            return a.channel < b.channel;
-        });
+            // 如果设置了最大时长，并且当前事件的时间戳超过了最大 Gigatron tick，则停止处理
+            if (max_gigatron_tick != -1 && tick > max_gigatron_tick) {
+                break; // 跳出循环
+            }
 
-        // 存储当前tick内每个Gigatron通道的最终状态
-        std::map<int, ChannelState> final_channel_states_for_tick;
+            // 循环终点及之后的事件不输出，由跳回循环体代替
+            if (loop_first_tick != -1 && loop_end_tick != -1 && tick >= loop_end_tick) {
+                break;
+            }
 
-        for (const auto& event : current_tick_events) {
-            int channel = event.channel;
+            flush_pending(tick);
+
+            // 先输出定时调用
+            out << "\tcall eatSound_Timer," << tick << std::endl;
+            out << std::endl;
+            last_tick = tick;
+
+            // 进入循环体：记录各通道的状态，跳回 loop 之前恢复
+            if (loop_start_tick != -1 && loop_first_tick == -1 && tick >= loop_start_tick &&
+                (loop_end_tick == -1 || tick < loop_end_tick)) {
+                loop_first_tick = tick;
+                for (int ch = 1; ch <= 4; ++ch) {
+                    bool sounding = channel_is_on[ch] && last_output_vol[ch] > 0;
+                    loop_channel_states[ch] = { last_output_note[ch], last_output_vol[ch], last_output_wave[ch],
+                                                last_output_pitch_bend[ch], !sounding };
+                }
+                loop_slot_waves = slot_waves;
+                out << "loop:" << std::endl;
+            }
+        
+            // 排序当前tick内的事件，确保处理顺序一致
+            std::vector<CustomMidiEvent> current_tick_events = pair.second;
+            std::sort(current_tick_events.begin(), current_tick_events.end(), [](const CustomMidiEvent& a, const CustomMidiEvent& b) {
+                return a.channel < b.channel;
+            });
+
+            // 存储当前tick内每个Gigatron通道的最终状态
+            std::map<int, ChannelState> final_channel_states_for_tick;
+            // 这一帧开始的音符需要的自定义波形，按波形槽
+            std::map<int, const std::vector<int>*> tick_waves;
+
+            for (const auto& event : current_tick_events) {
+                int channel = event.channel;
+
+                // 确定当前事件的有效音量等级
+                int current_effective_volume_levels = default_volume_levels;
+                if (cmd_volume_levels != -1) {
+                    current_effective_volume_levels = cmd_volume_levels;
+                } else if (config_parser) {
+                    // 假设如果存在config_parser，则使用其默认精度
+                    current_effective_volume_levels = config_parser->getDefaultAccuracy();
+                }
+
+                if (event.is_note_off) {
+                    // 检查这个 Note Off 事件是否是原始的 MIDI Note Off，但其对应的 Note On 有释放宏
+                    // 如果是，并且这个 Note Off 的时间戳早于最终的 Note Off 时间戳，则忽略它
+                    auto it = active_note_final_off_ticks.find({event.channel, event.note});
+                    if (it != active_note_final_off_ticks.end() && event.timestamp < it->second) {
+                        // 这是一个被释放宏延长的 Note Off，忽略它
+                        continue;
+                    }
+                    // 否则，这是一个真正的 Note Off 事件（要么没有释放宏，要么是最终的 Note Off 事件）
+                    // 此时，我们不立即输出 sound off，而是将其状态记录下来，在后续统一处理
+                    final_channel_states_for_tick[channel].is_note_off = true;
+                    final_channel_states_for_tick[channel].note = -1;
+                    final_channel_states_for_tick[channel].vol = 0; // 强制设置为0，表示音符关闭
+                    final_channel_states_for_tick[channel].wave = -1;
+                    final_channel_states_for_tick[channel].pitch_bend = -9999;
+                    continue; // 处理下一个事件
+                }
+
+                // 计算当前事件的最终音符、音量、波形和弯音单位
+                double total_bend_semitones = event.pitch_bend;
+                int note_offset = static_cast<int>(std::round(total_bend_semitones));
+                double fine_bend_semitones = total_bend_semitones - note_offset;
+                int final_note = convert_midi_note(event.note + note_offset);
+
+                double base_velocity = event.velocity;
+                double volume_controller = event.volume;
+                double expression_controller = event.expression;
+                double normalized_volume = (base_velocity / 127.0) * (volume_controller / 127.0) * (expression_controller / 127.0);
+                int gigatron_volume = static_cast<int>(std::round(normalized_volume * 63.0));
+                int vol;
+
+                if (event.is_macro_event) {
+                    // 如果是宏事件，直接使用宏定义的音量，不进行简化和音量抬升
+                    vol = event.volume;
+                } else {
+                    // 否则，应用音量简化和抬升
+                    int simplified_vol = simplify_volume(static_cast<int>(std::round(gigatron_volume + volume_offset)), current_effective_volume_levels);
+                    vol = apply_volume_boost(simplified_vol, min_volume_boost);
+                }
+
+                int wave;
+                if (channel_waveforms[channel] != -1) {
+                    wave = channel_waveforms[channel];
+                } else if (event.is_macro_event) {
+                    // 对于宏事件，波形值已经存储在event.wave_value中
+                    wave = event.wave_value;
+                } else {
+                    wave = convert_midi_waveform(event.program, config_parser);
+                }
+
+                int final_pitch_bend_gigatron_unit = 0;
+                if (!no_pitch_bend) {
+                    double current_pitch_bend_cents = fine_bend_semitones * 100.0;
+                    const double max_vibrato_depth_cents = 50.0;
+                    double vibrato_depth_cents = (static_cast<double>(event.modulation) / 127.0) * max_vibrato_depth_cents;
+                    current_pitch_bend_cents += vibrato_depth_cents;
+                    final_pitch_bend_gigatron_unit = static_cast<int>(current_pitch_bend_cents * pitch_bend_multiplier + (current_pitch_bend_cents > 0 ? 0.5 : -0.5));
+                }
 
-            // 确定当前事件的有效音量等级
-            int current_effective_volume_levels = default_volume_levels;
-            if (cmd_volume_levels != -1) {
-                current_effective_volume_levels = cmd_volume_levels;
-            } else if (config_parser) {
-                // 假设如果存在config_parser，则使用其默认精度
-                current_effective_volume_levels = config_parser->getDefaultAccuracy();
+                // -quantize：所有音量（包括宏）量化到较少的等级，发声的音符不会变成 0
+                if (quantize_levels < 64 && vol > 0) {
+                    vol = simplify_volume(vol, quantize_levels);
+                }
+
+                if (const std::vector<int>* samples = onset_wavetable(event)) {
+                    tick_waves[wave & 3] = samples;
+                }
+
+                // 更新当前tick内该通道的最终状态
+                final_channel_states_for_tick[channel].note = final_note;
+                final_channel_states_for_tick[channel].vol = vol;
+                final_channel_states_for_tick[channel].wave = wave;
+                final_channel_states_for_tick[channel].pitch_bend = final_pitch_bend_gigatron_unit;
+                final_channel_states_for_tick[channel].is_note_off = false; // 只要有Note On或宏事件，就不是Note Off
+
+                // 新的音符开始或结束该通道的琶音，音程从低到高，从音符本身开始
+                if (!event.is_macro_event && !event.is_pitch_bend_change && !event.is_volume_change) {
+                    if (arpeggio_rate > 0 && !event.arpeggio.empty()) {
+                        std::vector<int> intervals = event.arpeggio;
+                        intervals.push_back(0);
+                        std::sort(intervals.begin(), intervals.end());
+                        std::rotate(intervals.begin(), std::find(intervals.begin(), intervals.end(), 0), intervals.end());
+                        arpeggios[channel] = { tick, intervals, ChannelState() };
+                    } else {
+                        arpeggios.erase(channel);
+                    }
+                }
             }
 
-            if (event.is_note_off) {
-                // 检查这个 Note Off 事件是否是原始的 MIDI Note Off，但其对应的 Note On 有释放宏
-                // 如果是，并且这个 Note Off 的时间戳早于最终的 Note Off 时间戳，则忽略它
-                auto it = active_note_final_off_ticks.find({event.channel, event.note});
-                if (it != active_note_final_off_ticks.end() && event.timestamp < it->second) {
-                    // 这是一个被释放宏延长的 Note Off，忽略它
-                    continue;
+            // 琶音：发声的通道换成当前的音程，并保证下一次换音符的帧会被处理
+            for (auto it = arpeggios.begin(); it != arpeggios.end(); ) {
+                int channel = it->first;
+                ArpeggioState& arpeggio = it->second;
+                auto final_state = final_channel_states_for_tick.find(channel);
+                if (final_state != final_channel_states_for_tick.end()) {
+                    if (final_state->second.is_note_off) {
+                        it = arpeggios.erase(it);
+                        continue;
+                    }
+                    arpeggio.state = final_state->second;
                 }
-                // 否则，这是一个真正的 Note Off 事件（要么没有释放宏，要么是最终的 Note Off 事件）
-                // 此时，我们不立即输出 sound off，而是将其状态记录下来，在后续统一处理
-                final_channel_states_for_tick[channel].is_note_off = true;
-                final_channel_states_for_tick[channel].note = -1;
-                final_channel_states_for_tick[channel].vol = 0; // 强制设置为0，表示音符关闭
-                final_channel_states_for_tick[channel].wave = -1;
-                final_channel_states_for_tick[channel].pitch_bend = -9999;
-                continue; // 处理下一个事件
-            }
-
-            // 计算当前事件的最终音符、音量、波形和弯音单位
-            double total_bend_semitones = event.pitch_bend;
-            int note_offset = static_cast<int>(std::round(total_bend_semitones));
-            double fine_bend_semitones = total_bend_semitones - note_offset;
-            int final_note = convert_midi_note(event.note + note_offset);
-
-            double base_velocity = event.velocity;
-            double volume_controller = event.volume;
-            double expression_controller = event.expression;
-            double normalized_volume = (base_velocity / 127.0) * (volume_controller / 127.0) * (expression_controller / 127.0);
-            int gigatron_volume = static_cast<int>(std::round(normalized_volume * 63.0));
-            int vol;
-
-            if (event.is_macro_event) {
-                // 如果是宏事件，直接使用宏定义的音量，不进行简化和音量抬升
-                vol = event.volume;
-            } else {
-                // 否则，应用音量简化和抬升
-                int simplified_vol = simplify_volume(static_cast<int>(std::round(gigatron_volume + volume_offset)), current_effective_volume_levels);
-                vol = apply_volume_boost(simplified_vol, min_volume_boost);
-            }
-
-            int wave;
-            if (channel_waveforms[channel] != -1) {
-                wave = channel_waveforms[channel];
-            } else if (event.is_macro_event) {
-                // 对于宏事件，波形值已经存储在event.wave_value中
-                wave = event.wave_value;
-            } else {
-                wave = convert_midi_waveform(event.program, config_parser);
-            }
-
-            int final_pitch_bend_gigatron_unit = 0;
-            if (!no_pitch_bend) {
-                double current_pitch_bend_cents = fine_bend_semitones * 100.0;
-                const double max_vibrato_depth_cents = 50.0;
-                double vibrato_depth_cents = (static_cast<double>(event.modulation) / 127.0) * max_vibrato_depth_cents;
-                current_pitch_bend_cents += vibrato_depth_cents;
-                final_pitch_bend_gigatron_unit = static_cast<int>(current_pitch_bend_cents * pitch_bend_multiplier + (current_pitch_bend_cents > 0 ? 0.5 : -0.5));
-            }
-
-            // 更新当前tick内该通道的最终状态
-            final_channel_states_for_tick[channel].note = final_note;
-            final_channel_states_for_tick[channel].vol = vol;
-            final_channel_states_for_tick[channel].wave = wave;
-            final_channel_states_for_tick[channel].pitch_bend = final_pitch_bend_gigatron_unit;
-            final_channel_states_for_tick[channel].is_note_off = false; // 只要有Note On或宏事件，就不是Note Off
-        }
+                long step = (tick - arpeggio.start) / arpeggio_rate;
+                ChannelState state = arpeggio.state;
+                state.note = convert_midi_note(state.note + arpeggio.intervals[step % arpeggio.intervals.size()]);
+                final_channel_states_for_tick[channel] = state;
+                long next_tick = arpeggio.start + (step + 1) * arpeggio_rate;
+                if (next_tick <= events_by_tick.rbegin()->first) {
+                    events_by_tick.emplace(next_tick, std::vector<CustomMidiEvent>());
+                }
+                ++it;
+            }
 
-        // 遍历当前tick内每个通道的最终状态，并输出
-        for (const auto& final_state_pair : final_channel_states_for_tick) {
-            int channel = final_state_pair.first;
-            const auto& state = final_state_pair.second;
-
-            if (state.is_note_off) {
-            } else {
-                // 检查是否有任何参数自上次输出以来发生变化
-                bool changed = false;
-                if (state.note != last_output_note[channel] ||
-                    state.vol != last_output_vol[channel] ||
-                    state.wave != last_output_wave[channel] ||
-                    state.pitch_bend != last_output_pitch_bend[channel])
-                {
-                    changed = true;
-                }
-
-                // 如果音量为0，且通道当前是开启状态，则需要关闭声音
-                // 此时，通过将音量设置为0来隐式关闭声音，而不是显式输出 sound off
-                if (state.vol == 0 && channel_is_on[channel]) {
-                    // 标记为关闭，并重置上次输出的值，以便下次音量大于0时能重新输出 call beep
-                    channel_is_on[channel] = false;
-                    last_output_note[channel] = -1;
-                    last_output_vol[channel] = -1;
-                    last_output_wave[channel] = -1;
-                    last_output_pitch_bend[channel] = -9999;
-                }
-                
-                // 只有当音量大于0时才输出 call beep，或者当音量为0但需要更新状态时
-                // 如果音量为0，且通道之前是开启状态，则不需要输出 call beep，因为已经通过上述逻辑处理了关闭
-                if (state.vol > 0 || (state.vol == 0 && changed && !channel_is_on[channel])) {
-                    if (changed || !channel_is_on[channel]) { // 如果有变化或者通道之前是关闭的，则输出
-                        output_file << "\tcall beep," << channel << "," << state.note << "," << state.vol << "," << state.wave << "," << state.pitch_bend << std::endl;
-                        // 更新上次输出的值
-                        last_output_note[channel] = state.note;
-                        last_output_vol[channel] = state.vol;
-                        last_output_wave[channel] = state.wave;
-                        last_output_pitch_bend[channel] = state.pitch_bend;
-                        channel_is_on[channel] = true; // 标记为开启
+            for (const auto& need : tick_waves) {
+                if (slot_waves[need.first] != need.second) emit_wave(need.first, need.second);
+            }
+
+            // 当前tick内每个通道的最终状态（较新的状态替换尚未输出的旧状态），并输出
+            for (const auto& final_state_pair : final_channel_states_for_tick) {
+                if (!final_state_pair.second.is_note_off) {
+                    pending_channel_states[final_state_pair.first] = final_state_pair.second;
+                }
+            }
+            emit_pending();
+        }
+    
+        if (loop_first_tick != -1) {
+            // 等到循环终点再加上循环起点到循环体第一个事件的间隔，
+            // 恢复进入循环体时的通道状态，然后跳回 loop
+            long loop_end = (loop_end_tick != -1) ? loop_end_tick : last_tick + 1;
+            long loop_wait_tick = loop_end + (loop_first_tick - loop_start_tick);
+            flush_pending(loop_wait_tick);
+            out << "\tcall eatSound_Timer," << loop_wait_tick << std::endl;
+            for (int ch = 1; ch <= 4; ++ch) {
+                const ChannelState& state = loop_channel_states[ch];
+                bool sounding = channel_is_on[ch] && last_output_vol[ch] > 0;
+                if (!state.is_note_off) {
+                    if (!sounding || state.note != last_output_note[ch] || state.vol != last_output_vol[ch] ||
+                        state.wave != last_output_wave[ch] || state.pitch_bend != last_output_pitch_bend[ch]) {
+                        out << "\tcall beep," << ch << "," << state.note << "," << state.vol << "," << state.wave << "," << state.pitch_bend << std::endl;
                     }
+                } else if (sounding) {
+                    out << "\tcall beep," << ch << "," << last_output_note[ch] << ",0," << last_output_wave[ch] << "," << last_output_pitch_bend[ch] << std::endl;
+                }
+            }
+            for (const auto& slot : loop_slot_waves) {
+                if (slot.second && slot_waves[slot.first] != slot.second) emit_wave(slot.first, slot.second);
+            }
+            out << "\ttick_sum=" << loop_first_tick << std::endl;
+            out << "\tgoto loop" << std::endl;
+        } else {
+            flush_pending(last_tick + 1 + static_cast<long>(pending_channel_states.size()));
+            out << "\tsound off" << std::endl;
+            out << "\tgoto start" << std::endl;
+        }
+        out << "endproc" << std::endl;
+        output_ticks = static_cast<long>(events_by_tick.size());
+    };
+
+    // -budget：从最高质量开始，每次把一个参数降一档，选每节省一个字节误差增加最少的一个，
+    // 直到不超过预算；然后在预算内尝试把参数升回去，保留误差更小的结果
+    if (byte_budget > 0) {
+        static const std::vector<int> ladders[4] = {
+            {64, 32, 16, 8, 4},          // -quantize
+            {0, 30, 20, 15, 10, 6, 4},   // -envelope_rate
+            {0, 2, 4, 8, 16},            // -drop_steps
+            {0, 1, 2, 3, 4},             // -envelope_jitter
+        };
+        budget_search = true;
+        auto apply_quality = [&](const std::array<int, 4>& steps) {
+            quantize_levels = ladders[0][steps[0]];
+            envelope_rate = ladders[1][steps[1]];
+            drop_steps = ladders[2][steps[2]];
+            envelope_jitter = ladders[3][steps[3]];
+        };
+        std::vector<FrameState> reference;
+        auto evaluate = [&](const std::array<int, 4>& steps, long& bytes, double& error) {
+            apply_quality(steps);
+            std::ostringstream music_data;
+            write_music_data(music_data);
+            bytes = estimate_song_bytes(music_data.str());
+            std::vector<FrameState> timeline = replay_music_data(music_data.str());
+            if (reference.empty()) reference = timeline;
+            error = timeline_error(reference, timeline);
+        };
+
+        std::array<int, 4> current = {0, 0, 0, 0};
+        long current_bytes;
+        double current_error;
+        evaluate(current, current_bytes, current_error);
+        while (current_bytes > byte_budget) {
+            std::array<int, 4> best = current;
+            long best_bytes = current_bytes;
+            double best_error = current_error;
+            double best_slope = 0;
+            for (int k = 0; k < 4; ++k) {
+                // 不省字节的档位（例如乐器的精度本来就低于 -envelope_rate）直接跳过
+                std::array<int, 4> candidate = current;
+                long bytes = current_bytes;
+                double error = current_error;
+                while (bytes >= current_bytes && candidate[k] + 1 < static_cast<int>(ladders[k].size())) {
+                    candidate[k]++;
+                    evaluate(candidate, bytes, error);
+                }
+                if (bytes >= current_bytes) continue;
+                // 超出预算需要的节省不算，避免一步跳得太远
+                double slope = (error - current_error) / std::min(current_bytes - bytes, current_bytes - byte_budget);
+                if (best == current || slope < best_slope) {
+                    best = candidate;
+                    best_bytes = bytes;
+                    best_error = error;
+                    best_slope = slope;
                 }
             }
+            if (best == current) break;
+            current = best;
+            current_bytes = best_bytes;
+            current_error = best_error;
+        }
+        for (bool improved = current_bytes <= byte_budget; improved; ) {
+            improved = false;
+            for (int k = 0; k < 4; ++k) {
+                std::array<int, 4> candidate = current;
+                long bytes = current_bytes;
+                double error = current_error;
+                while (bytes == current_bytes && candidate[k] > 0) {
+                    candidate[k]--;
+                    evaluate(candidate, bytes, error);
+                }
+                if (candidate != current && bytes <= byte_budget && error < current_error) {
+                    current = candidate;
+                    current_bytes = bytes;
+                    current_error = error;
+                    improved = true;
+                }
+            }
+        }
+        apply_quality(current);
+        budget_search = false;
+
+        std::cerr << (current_bytes <= byte_budget ? "Budget: " : "Warning: Budget not reached: ")
+                  << "about " << current_bytes << " of " << byte_budget << " bytes with -quantize " << quantize_levels
+                  << " -envelope_rate " << envelope_rate << " -drop_steps " << drop_steps
+                  << " -envelope_jitter " << envelope_jitter << ", error " << current_error << " per frame" << std::endl;
+        if (current_bytes > byte_budget) {
+            budget_failed = true;
         }
     }
-    
-    output_file << "\tsound off" << std::endl;
-    output_file << "\tgoto start" << std::endl;
-    output_file << "endproc" << std::endl;
+
+    write_music_data(output_file);
  
     output_file.close();
-    return 0;
+
+    if (!cache_path.empty() && !budget_failed) {
+        // 先写临时文件再改名，并行转换时不会读到写了一半的缓存
+        std::error_code ec;
+        std::string temp_path = cache_path + ".tmp";
+        std::filesystem::create_directories(cache_dir, ec);
+        std::filesystem::copy_file(output_filepath, temp_path, std::filesystem::copy_options::overwrite_existing, ec);
+        if (!ec) std::filesystem::rename(temp_path, cache_path, ec);
+        if (ec) {
+            std::cerr << "Warning: Could not store " << output_filepath << " in the cache: " << ec.message() << std::endl;
+        }
+    }
+
+    if (!stats_file.empty()) {
+        std::ofstream stats(stats_file);
+        if (!stats.is_open()) {
+            std::cerr << "Error: Could not open stats file " << stats_file << std::endl;
+            return 1;
+        }
+        stats << "{\"events\": " << midi_events.size()
+              << ", \"ticks\": " << output_ticks
+              << ", \"beeps\": " << beep_count
+              << ", \"stages\": {\"read\": " << parser.get_read_seconds()
+              << ", \"link\": " << parser.get_link_seconds()
+              << ", \"allocate\": " << allocate_seconds
+              << ", \"schedule\": " << schedule_seconds
+              << ", \"expand\": " << expand_seconds
+              << ", \"emit\": " << seconds_since(stage_start) << "}}" << std::endl;
+    }
+    return budget_failed ? 1 : 0;
 }
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <vector>
 
 
 namespace smf {
@@ -59,6 +60,8 @@ class Binasc {
 		                                              const std::string& infile);
 		int                  writeToBinary           (std::ostream& out,
 		                                              std::istream& input);
+		int                  writeToBuffer           (std::vector<uchar>& out,
+		                                              std::istream& input);
 
 		// functions for converting into an ASCII file with hex bytes:
 		int                  readFromBinary          (const std::string&
@@ -108,33 +111,41 @@ class Binasc {
 
 	private:
 		// helper functions for reading ASCII content to conver to binary:
-		int                  processLine             (std::ostream& out,
-		                                              const std::string& input,
-		                                              int lineNum);
-		int                  processAsciiWord        (std::ostream& out,
+		int                  processLine             (std::vector<uchar>& out,
+		                                              const char* input,
+		                                              int length, int lineNum,
+		                                              std::string& word);
+		int                  processAsciiWord        (std::vector<uchar>& out,
 		                                              const std::string& input,
 		                                              int lineNum);
-		int                  processStringWord       (std::ostream& out,
+		int                  processStringWord       (std::vector<uchar>& out,
 		                                              const std::string& input,
 		                                              int lineNum);
-		int                  processBinaryWord       (std::ostream& out,
+		int                  processBinaryWord       (std::vector<uchar>& out,
 		                                              const std::string& input,
 		                                              int lineNum);
-		int                  processDecimalWord      (std::ostream& out,
+		int                  processDecimalWord      (std::vector<uchar>& out,
 		                                              const std::string& input,
 		                                              int lineNum);
-		int                  processHexWord          (std::ostream& out,
+		int                  processHexWord          (std::vector<uchar>& out,
 		                                              const std::string& input,
 		                                              int lineNum);
-		int                  processVlvWord          (std::ostream& out,
+		int                  processVlvWord          (std::vector<uchar>& out,
 		                                              const std::string& input,
 		                                              int lineNum);
-		int                  processMidiPitchBendWord(std::ostream& out,
+		int                  processMidiPitchBendWord(std::vector<uchar>& out,
 		                                              const std::string& input,
 		                                              int lineNum);
-		int                  processMidiTempoWord    (std::ostream& out,
+		int                  processMidiTempoWord    (std::vector<uchar>& out,
 		                                              const std::string& input,
 		                                              int lineNum);
+		static bool          appendSimpleByte        (std::vector<uchar>& out,
+		                                              const std::string& word);
+		static void          appendBytes             (std::vector<uchar>& out,
+		                                              unsigned long long value,
+		                                              int count, bool bigEndian);
+		static unsigned long long floatBits          (float value);
+		static unsigned long long doubleBits         (double value);
 
 		// helper functions for reading binary content to convert to ASCII:
 		int  outputStyleAscii   (std::ostream& out, std::istream& input);
@@ -146,8 +157,8 @@ class Binasc {
 		int  readMidiEvent  (std::ostream& out, std::istream& infile,
 		                     int& trackbytes, int& command);
 		int  getVLV         (std::istream& infile, int& trackbytes);
-		int  getWord        (std::string& word, const std::string& input,
-		                     const std::string& terminators, int index);
+		int  getWord        (std::string& word, const char* input, int length,
+		                     const char* terminators, int index);
 
 		static const char *GMinstrument[128];
 
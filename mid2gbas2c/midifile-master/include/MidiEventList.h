@@ -15,6 +15,7 @@
 
 #include "MidiEvent.h"
 
+#include <memory>
 #include <vector>
 
 
@@ -69,6 +70,17 @@ class MidiEventList {
 		std::vector<MidiEvent*> list;
 
 	private:
+		// Events added by the list are built in blocks of storage instead
+		// of one heap node each.  Lists that take over some of the events
+		// (joinTracks(), splitTracks()) share the blocks, which are freed
+		// with the last list holding them.
+		struct Block;
+		std::vector<std::shared_ptr<Block>> blocks;
+		int              blockHint = 0;
+		MidiEvent*       newEvent           (const MidiEvent& event);
+		void             deleteEvent        (MidiEvent* event);
+		void             shareBlocks        (const MidiEventList& other);
+
 		void             sort                   (void) { return sortNoteOnsBeforeOffs(); }
 		void             sortNoteOnsBeforeOffs  (void);
 		void             sortNoteOffsBeforeOns  (void);
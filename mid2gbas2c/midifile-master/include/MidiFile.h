@@ -34,10 +34,13 @@ enum {
     TIME_STATE_ABSOLUTE = 1  // MidiMessage::ticks are in absolute time format (0=start time).
 };
 
+// A segment of the time map: the tempo is constant from tick
+// until the tick of the next segment.
 class _TickTime {
 	public:
 		int    tick;
 		double seconds;
+		double secondsPerTick;
 };
 
 
@@ -66,6 +69,16 @@ class MidiFile {
 		bool           readSmf                     (const std::string& filename);
 		bool           readSmf                     (std::istream& instream);
 
+		// Number of threads used to decode the tracks of a multi-track
+		// file (1 = serial, 0 = one per hardware thread):
+		void           setReadThreads              (int count);
+		int            getReadThreads              (void) const;
+
+		// Stop reading each track after its first event past this tick
+		// (-1 = read whole tracks):
+		void           setReadTickLimit            (int tick);
+		int            getReadTickLimit            (void) const;
+
 		bool           write                       (const std::string& filename);
 		bool           write                       (std::ostream& out);
 		bool           writeBase64                 (const std::string& out, int width = 0);
@@ -140,6 +153,9 @@ class MidiFile {
 		double           getTimeInSeconds          (int aTrack, int anIndex);
 		double           getTimeInSeconds          (int tickvalue);
 		double           getAbsoluteTickTime       (double starttime);
+		double           getTimeInSecondsSeq       (int tickvalue, int& segment);
+		double           getAbsoluteTickTimeSeq    (double starttime, int& segment);
+		int              getTimeMapSize            (void);
 		int              getFileDurationInTicks    (void);
 		double           getFileDurationInQuarters (void);
 		double           getFileDurationInSeconds  (void);
@@ -157,7 +173,9 @@ class MidiFile {
 
 		// event functionality:
 		MidiEvent*       addEvent                  (int aTrack, int aTick,
-		                                            std::vector<uchar>& midiData);
+		                                            const std::vector<uchar>& midiData);
+		MidiEvent*       addEvent                  (int aTrack, int aTick,
+		                                            const MidiMessage& message);
 		MidiEvent*       addEvent                  (MidiEvent& mfevent);
 		MidiEvent*       addEvent                  (int aTrack, MidiEvent& mfevent);
 		MidiEvent&       getEvent                  (int aTrack, int anIndex);
@@ -294,10 +312,11 @@ class MidiFile {
 		// the object.
 		std::string m_readFileName;
 
-		// m_timemapvalid ==
+		// m_timemapvalid == True if m_timemap is up to date.
 		bool m_timemapvalid = false;
 
-		// m_timemap ==
+		// m_timemap == One segment per tempo in effect, sorted by tick.  The
+		// last entry is at the last tick of the file and ends the map.
 		std::vector<_TickTime> m_timemap;
 
 		// m_rwstatus == True if last read was successful, false if a problem.
@@ -306,22 +325,40 @@ class MidiFile {
 		// m_linkedEventQ == True if link analysis has been done.
 		bool m_linkedEventsQ = false;
 
+		// m_readThreads == Number of threads for decoding tracks in readSmf().
+		int m_readThreads = 1;
+
+		// m_readTickLimit == Tick after which readSmf() stops reading a track.
+		int m_readTickLimit = -1;
+
 	private:
 		int         extractMidiData                 (std::istream& inputfile,
 		                                             std::vector<uchar>& array,
 		                                             uchar& runningCommand);
 		ulong       readVLValue                     (std::istream& inputfile);
+		bool        readSmfData                     (const std::vector<uchar>& data);
+		bool        readHeader                      (std::istream& input,
+		                                             int& tracks);
+		bool        readTracks                      (std::istream& input,
+		                                             int tracks);
+		bool        readTrackData                   (const std::vector<uchar>& data,
+		                                             ulong offset, int tracks);
+		bool        readTracksParallel              (const std::vector<uchar>& data,
+		                                             ulong offset, int tracks);
+		static bool decodeTrack                     (const uchar* data,
+		                                             ulong size, int track,
+		                                             int limit,
+		                                             MidiEventList& events);
+		void        truncateTracks                  (int tick);
 		ulong       unpackVLV                       (uchar a = 0, uchar b = 0,
 		                                             uchar c = 0, uchar d = 0,
 		                                             uchar e = 0);
 		void        writeVLValue                    (long aValue,
 		                                             std::vector<uchar>& data);
 		int         makeVLV                         (uchar *buffer, int number);
-		static int  ticksearch                      (const void* A, const void* B);
-		static int  secondsearch                    (const void* A, const void* B);
 		void        buildTimeMap                    (void);
-		double      linearTickInterpolationAtSecond (double seconds);
-		double      linearSecondInterpolationAtTick (int ticktime);
+		int         findSegmentAtTick               (int tickvalue, int segment);
+		int         findSegmentAtSecond             (double seconds, int segment);
 		std::string base64Encode                    (const std::string &input);
 		std::string base64Decode                    (const std::string &input);
 
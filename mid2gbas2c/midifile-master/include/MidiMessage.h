@@ -14,8 +14,12 @@
 #ifndef _MIDIMESSAGE_H_INCLUDED
 #define _MIDIMESSAGE_H_INCLUDED
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -26,7 +30,102 @@ typedef unsigned char  uchar;
 typedef unsigned short ushort;
 typedef unsigned long  ulong;
 
-class MidiMessage : public std::vector<uchar> {
+
+//////////////////////////////
+//
+// MidiBytes -- Byte storage of a MidiMessage, with the interface of the
+//    std::vector<uchar> it replaces.  Messages of up to INLINE_SIZE bytes
+//    (all channel messages and the short meta messages such as tempo or
+//    time signature) are kept inside the object; only longer meta and
+//    sysex messages allocate their bytes on the heap.
+//
+
+class MidiBytes {
+	public:
+		typedef uchar        value_type;
+		typedef size_t       size_type;
+		typedef uchar&       reference;
+		typedef const uchar& const_reference;
+		typedef uchar*       iterator;
+		typedef const uchar* const_iterator;
+
+		static const int INLINE_SIZE = 8;
+
+		               MidiBytes            (void) : m_data(m_inline), m_size(0),
+		                                             m_capacity(INLINE_SIZE) { }
+		               MidiBytes            (size_type count, uchar value = 0);
+		               MidiBytes            (const MidiBytes& other);
+		               MidiBytes            (MidiBytes&& other) noexcept;
+		              ~MidiBytes            () { if (m_data != m_inline) { delete [] m_data; } }
+
+		MidiBytes&     operator=            (const MidiBytes& other);
+		MidiBytes&     operator=            (MidiBytes&& other) noexcept;
+
+		size_type      size                 (void) const { return m_size; }
+		bool           empty                (void) const { return m_size == 0; }
+		size_type      capacity             (void) const { return m_capacity; }
+		uchar*         data                 (void) { return m_data; }
+		const uchar*   data                 (void) const { return m_data; }
+		iterator       begin                (void) { return m_data; }
+		const_iterator begin                (void) const { return m_data; }
+		const_iterator cbegin               (void) const { return m_data; }
+		iterator       end                  (void) { return m_data + m_size; }
+		const_iterator end                  (void) const { return m_data + m_size; }
+		const_iterator cend                 (void) const { return m_data + m_size; }
+		uchar&         operator[]           (size_type index) { return m_data[index]; }
+		const uchar&   operator[]           (size_type index) const { return m_data[index]; }
+		uchar&         at                   (size_type index);
+		const uchar&   at                   (size_type index) const;
+		uchar&         front                (void) { return m_data[0]; }
+		const uchar&   front                (void) const { return m_data[0]; }
+		uchar&         back                 (void) { return m_data[m_size-1]; }
+		const uchar&   back                 (void) const { return m_data[m_size-1]; }
+
+		void           clear                (void) { m_size = 0; }
+		void           reserve              (size_type count) { if (count > m_capacity) { grow(count); } }
+		void           resize               (size_type count, uchar value = 0);
+		void           push_back            (uchar value) {
+		                  if (m_size == m_capacity) { grow(m_size + 1); }
+		                  m_data[m_size++] = value;
+		               }
+		void           pop_back             (void) { m_size--; }
+		void           assign               (size_type count, uchar value);
+		template <class Iterator, class = typename std::enable_if<!std::is_integral<Iterator>::value>::type>
+		void           assign               (Iterator first, Iterator last) {
+		                  clear();
+		                  insert(end(), first, last);
+		               }
+		iterator       insert               (const_iterator pos, uchar value) { return insert(pos, 1, value); }
+		iterator       insert               (const_iterator pos, size_type count, uchar value);
+		template <class Iterator, class = typename std::enable_if<!std::is_integral<Iterator>::value>::type>
+		iterator       insert               (const_iterator pos, Iterator first, Iterator last) {
+		                  // copy first, the range may point into this message
+		                  std::vector<uchar> bytes(first, last);
+		                  return insertBytes(pos, bytes.data(), bytes.size());
+		               }
+		iterator       erase                (const_iterator pos) { return erase(pos, pos + 1); }
+		iterator       erase                (const_iterator first, const_iterator last);
+		void           swap                 (MidiBytes& other);
+
+		               operator std::vector<uchar> (void) const { return std::vector<uchar>(begin(), end()); }
+
+	private:
+		void           grow                 (size_type count);
+		iterator       insertBytes          (const_iterator pos, const uchar* bytes, size_type count);
+
+		uchar*   m_data;       // m_inline or a heap block of m_capacity bytes
+		uint32_t m_size;
+		uint32_t m_capacity;
+		uchar    m_inline[INLINE_SIZE];
+};
+
+bool operator==(const MidiBytes& a, const MidiBytes& b);
+bool operator!=(const MidiBytes& a, const MidiBytes& b);
+bool operator<(const MidiBytes& a, const MidiBytes& b);
+
+
+
+class MidiMessage : public MidiBytes {
 
 	public:
 		               MidiMessage          (void);
@@ -11,7 +11,10 @@
 
 #include "Binasc.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <sstream>
 
 
@@ -287,18 +290,65 @@ int Binasc::writeToBinary(std::ostream& out, const std::string& infile) {
 
 
 int Binasc::writeToBinary(std::ostream& out, std::istream& input) {
-	std::string inputLine;
-	inputLine.reserve(8196);
-	int  lineNum = 0;              // current line number
-	getline(input, inputLine, '\n');
-	lineNum++;
-	while (!input.eof()) {
-		int status = processLine(out, inputLine, lineNum);
+	std::vector<uchar> buffer;
+	int status = writeToBuffer(buffer, input);
+	out.write((const char*)buffer.data(), buffer.size());
+	return status;
+}
+
+
+
+//////////////////////////////
+//
+// Binasc::writeToBuffer -- Convert an ASCII representation of bytes into
+//     the bytes that it describes, appending them to a buffer in one pass
+//     over the text.  As with writeToBinary(), only lines that end in a
+//     newline are converted.  Returns 0 if there was a problem otherwise
+//     returns 1 (the bytes up to the problem are still appended).
+//
+
+int Binasc::writeToBuffer(std::vector<uchar>& out, std::istream& input) {
+	// Read the text straight into one string: going through an
+	// ostringstream would copy all of it again in str().  The string is
+	// sized up front when the stream can tell how much is left.
+	std::string data;
+	std::streambuf* source = input.rdbuf();
+	size_t length = 0;
+	if (source) {
+		std::streamoff here = source->pubseekoff(0, std::ios::cur, std::ios::in);
+		std::streamoff end = source->pubseekoff(0, std::ios::end, std::ios::in);
+		if ((here >= 0) && (end >= here) &&
+				(source->pubseekpos(here, std::ios::in) == here)) {
+			data.resize((size_t)(end - here) + 1);
+		}
+	}
+	while (source) {
+		if (data.size() <= length) {
+			data.resize(length + std::max<size_t>(length, 65536));
+		}
+		std::streamsize count = source->sgetn(&data[length],
+				(std::streamsize)(data.size() - length));
+		if (count <= 0) {
+			break;
+		}
+		length += (size_t)count;
+	}
+	data.resize(length);
+	out.reserve(out.size() + data.size() / 3);
+
+	std::string word;
+	word.reserve(256);
+	int lineNum = 0;
+	size_t start = 0;
+	size_t end;
+	while ((end = data.find('\n', start)) != std::string::npos) {
+		lineNum++;
+		int status = processLine(out, data.data() + start, (int)(end - start),
+				lineNum, word);
 		if (!status) {
 			return 0;
 		}
-		getline(input, inputLine, '\n');
-		lineNum++;
+		start = end + 1;
 	}
 	return 1;
 }
@@ -534,12 +584,10 @@ int Binasc::outputStyleBoth(std::ostream& out, std::istream& input) {
 // Binasc::processLine -- Read a line of input and output any specified bytes.
 //
 
-int Binasc::processLine(std::ostream& out, const std::string& input,
-		int lineCount) {
+int Binasc::processLine(std::vector<uchar>& out, const char* input, int length,
+		int lineCount, std::string& word) {
 	int status = 1;
 	int i = 0;
-	int length = (int)input.size();
-	std::string word;
 	while (i<length) {
 		if ((input[i] == ';') || (input[i] == '#') || (input[i] == '/')) {
 			// comment to end of line, so ignore
@@ -550,23 +598,25 @@ int Binasc::processLine(std::ostream& out, const std::string& input,
 			i++;
 			continue;
 		} else if (input[i] == '+') {
-			i = getWord(word, input, " \n\t", i);
+			i = getWord(word, input, length, " \n\t", i);
 			status = processAsciiWord(out, word, lineCount);
 		} else if (input[i] == '"') {
-			i = getWord(word, input, "\"", i);
+			i = getWord(word, input, length, "\"", i);
 			status = processStringWord(out, word, lineCount);
 		} else if (input[i] == 'v') {
-			i = getWord(word, input, " \n\t", i);
+			i = getWord(word, input, length, " \n\t", i);
 			status = processVlvWord(out, word, lineCount);
 		} else if (input[i] == 'p') {
-			i = getWord(word, input, " \n\t", i);
+			i = getWord(word, input, length, " \n\t", i);
 			status = processMidiPitchBendWord(out, word, lineCount);
 		} else if (input[i] == 't') {
-			i = getWord(word, input, " \n\t", i);
+			i = getWord(word, input, length, " \n\t", i);
 			status = processMidiTempoWord(out, word, lineCount);
 		} else {
-			i = getWord(word, input, " \n\t", i);
-			if (word.find('\'') != std::string::npos) {
+			i = getWord(word, input, length, " \n\t", i);
+			if (appendSimpleByte(out, word)) {
+				status = 1;
+			} else if (word.find('\'') != std::string::npos) {
 				status = processDecimalWord(out, word, lineCount);
 			} else if ((word.find(',') != std::string::npos)
 					|| (word.size() > 2)) {
@@ -593,16 +643,16 @@ int Binasc::processLine(std::ostream& out, const std::string& input,
 //   terminator characters.
 //
 
-int Binasc::getWord(std::string& word, const std::string& input,
-		const std::string& terminators, int index) {
+int Binasc::getWord(std::string& word, const char* input, int length,
+		const char* terminators, int index) {
 	word.resize(0);
 	int i = index;
 	int escape = 0;
 	int ecount = 0;
-	if (terminators.find('"') != std::string::npos) {
+	if (strchr(terminators, '"') != NULL) {
 		escape = 1;
 	}
-	while (i < (int)input.size()) {
+	while (i < length) {
 		if (escape && input[i] == '\"') {
 			ecount++;
 			i++;
@@ -610,12 +660,14 @@ int Binasc::getWord(std::string& word, const std::string& input,
 				break;
 			}
 		}
-		if (escape && (i<(int)input.size()-1) && (input[i] == '\\')
+		// past the end of the line reads as the terminating null of a string
+		char c = (i < length) ? input[i] : '\0';
+		if (escape && (i<length-1) && (c == '\\')
 				&& (input[i+1] == '"')) {
 			word.push_back(input[i+1]);
 			i += 2;
-		} else if (terminators.find(input[i]) == std::string::npos) {
-			word.push_back(input[i]);
+		} else if ((c == '\0') || (strchr(terminators, c) == NULL)) {
+			word.push_back(c);
 			i++;
 		} else {
 			i++;
@@ -627,6 +679,86 @@ int Binasc::getWord(std::string& word, const std::string& input,
 
 
 
+//////////////////////////////
+//
+// Binasc::appendSimpleByte -- Handle the most common words, one or two
+//     hex digits or an unsigned one-byte decimal such as '64, without the
+//     general parsers.  Returns false for anything else, including words
+//     that the general parsers reject.
+//
+
+bool Binasc::appendSimpleByte(std::vector<uchar>& out, const std::string& word) {
+	int length = (int)word.size();
+	int value = 0;
+	if ((length == 1) || (length == 2)) {
+		for (int i=0; i<length; i++) {
+			char c = word[i];
+			if ((c >= '0') && (c <= '9')) {
+				value = value * 16 + c - '0';
+			} else if ((c >= 'a') && (c <= 'f')) {
+				value = value * 16 + c - 'a' + 10;
+			} else if ((c >= 'A') && (c <= 'F')) {
+				value = value * 16 + c - 'A' + 10;
+			} else {
+				return false;
+			}
+		}
+	} else if ((length >= 2) && (length <= 4) && (word[0] == '\'')) {
+		for (int i=1; i<length; i++) {
+			if ((word[i] < '0') || (word[i] > '9')) {
+				return false;
+			}
+			value = value * 10 + word[i] - '0';
+		}
+		if (value > 255) {
+			return false;
+		}
+	} else {
+		return false;
+	}
+	out.push_back((uchar)value);
+	return true;
+}
+
+
+
+//////////////////////////////
+//
+// Binasc::appendBytes -- Append the low count bytes of value to a buffer,
+//     most significant byte first if bigEndian is true.
+//
+
+void Binasc::appendBytes(std::vector<uchar>& out, unsigned long long value,
+		int count, bool bigEndian) {
+	for (int i=0; i<count; i++) {
+		int shift = 8 * (bigEndian ? count - 1 - i : i);
+		out.push_back((uchar)((value >> shift) & 0xff));
+	}
+}
+
+
+
+//////////////////////////////
+//
+// Binasc::floatBits, Binasc::doubleBits -- The bytes of a floating-point
+//     number as an integer, for appendBytes().
+//
+
+unsigned long long Binasc::floatBits(float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+
+unsigned long long Binasc::doubleBits(double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+
+
 ///////////////////////////////
 //
 // Binasc::getVLV -- read a Variable-Length Value from the file
@@ -1197,7 +1329,7 @@ int Binasc::outputStyleMidi(std::ostream& out, std::istream& input) {
 //     constituent bytes
 //
 
-int Binasc::processDecimalWord(std::ostream& out, const std::string& word,
+int Binasc::processDecimalWord(std::vector<uchar>& out, const std::string& word,
 		int lineNum) {
 	int length = (int)word.size();        // length of ascii binary number
 	int byteCount = -1;              // number of bytes to output
@@ -1336,17 +1468,17 @@ int Binasc::processDecimalWord(std::ostream& out, const std::string& word,
 		switch (byteCount) {
 			case 4:
 			  if (endianIndex == -1) {
-				  writeBigEndianFloat(out, floatOutput);
+				  appendBytes(out, floatBits(floatOutput), 4, true);
 			  } else {
-				  writeLittleEndianFloat(out, floatOutput);
+				  appendBytes(out, floatBits(floatOutput), 4, false);
 			  }
 			  return 1;
 			  break;
 			case 8:
 			  if (endianIndex == -1) {
-				  writeBigEndianDouble(out, doubleOutput);
+				  appendBytes(out, doubleBits(doubleOutput), 8, true);
 			  } else {
-				  writeLittleEndianDouble(out, doubleOutput);
+				  appendBytes(out, doubleBits(doubleOutput), 8, false);
 			  }
 			  return 1;
 			  break;
@@ -1373,7 +1505,7 @@ int Binasc::processDecimalWord(std::ostream& out, const std::string& word,
 				return 0;
 			}
 			char charOutput = (char)tempLong;
-			out << charOutput;
+			out.push_back((uchar)charOutput);
 			return 1;
 		} else {
 			ulong tempLong = (ulong)atoi(&word[quoteIndex + 1]);
@@ -1384,7 +1516,7 @@ int Binasc::processDecimalWord(std::ostream& out, const std::string& word,
 				std::cerr << "Decimal number out of range from 0 to 255" << std::endl;
 				return 0;
 			}
-			out << ucharOutput;
+			out.push_back((uchar)ucharOutput);
 			return 1;
 		}
 	}
@@ -1395,12 +1527,12 @@ int Binasc::processDecimalWord(std::ostream& out, const std::string& word,
 			if (signIndex != -1) {
 				long tempLong = atoi(&word[quoteIndex + 1]);
 				char charOutput = (char)tempLong;
-				out << charOutput;
+				out.push_back((uchar)charOutput);
 				return 1;
 			} else {
 				ulong tempLong = (ulong)atoi(&word[quoteIndex + 1]);
 				uchar ucharOutput = (uchar)tempLong;
-				out << ucharOutput;
+				out.push_back((uchar)ucharOutput);
 				return 1;
 			}
 			break;
@@ -1409,18 +1541,18 @@ int Binasc::processDecimalWord(std::ostream& out, const std::string& word,
 				long tempLong = atoi(&word[quoteIndex + 1]);
 				short shortOutput = (short)tempLong;
 				if (endianIndex == -1) {
-					writeBigEndianShort(out, shortOutput);
+					appendBytes(out, (ushort)shortOutput, 2, true);
 				} else {
-					writeLittleEndianShort(out, shortOutput);
+					appendBytes(out, (ushort)shortOutput, 2, false);
 				}
 				return 1;
 			} else {
 				ulong tempLong = (ulong)atoi(&word[quoteIndex + 1]);
 				ushort ushortOutput = (ushort)tempLong;
 				if (endianIndex == -1) {
-					writeBigEndianUShort(out, ushortOutput);
+					appendBytes(out, ushortOutput, 2, true);
 				} else {
-					writeLittleEndianUShort(out, ushortOutput);
+					appendBytes(out, ushortOutput, 2, false);
 				}
 				return 1;
 			}
@@ -1439,13 +1571,13 @@ int Binasc::processDecimalWord(std::ostream& out, const std::string& word,
 			uchar byte2 = (uchar)((tempLong & 0x0000ff00) >> 8);
 			uchar byte3 = (uchar)((tempLong & 0x000000ff));
 			if (endianIndex == -1) {
-				out << byte1;
-				out << byte2;
-				out << byte3;
+				out.push_back((uchar)byte1);
+				out.push_back((uchar)byte2);
+				out.push_back((uchar)byte3);
 			} else {
-				out << byte3;
-				out << byte2;
-				out << byte1;
+				out.push_back((uchar)byte3);
+				out.push_back((uchar)byte2);
+				out.push_back((uchar)byte1);
 			}
 			return 1;
 			}
@@ -1454,17 +1586,17 @@ int Binasc::processDecimalWord(std::ostream& out, const std::string& word,
 			if (signIndex != -1) {
 				long tempLong = atoi(&word[quoteIndex + 1]);
 				if (endianIndex == -1) {
-					writeBigEndianLong(out, tempLong);
+					appendBytes(out, (ulong)tempLong, 4, true);
 				} else {
-					writeLittleEndianLong(out, tempLong);
+					appendBytes(out, (ulong)tempLong, 4, false);
 				}
 				return 1;
 			} else {
 				ulong tempuLong = (ulong)atoi(&word[quoteIndex + 1]);
 				if (endianIndex == -1) {
-					writeBigEndianULong(out, tempuLong);
+					appendBytes(out, tempuLong, 4, true);
 				} else {
-					writeLittleEndianULong(out, tempuLong);
+					appendBytes(out, tempuLong, 4, false);
 				}
 				return 1;
 			}
@@ -1485,7 +1617,7 @@ int Binasc::processDecimalWord(std::ostream& out, const std::string& word,
 //     its binary byte form.
 //
 
-int Binasc::processHexWord(std::ostream& out, const std::string& word,
+int Binasc::processHexWord(std::vector<uchar>& out, const std::string& word,
 		int lineNum) {
 	int length = (int)word.size();
 	uchar outputByte;
@@ -1503,7 +1635,7 @@ int Binasc::processHexWord(std::ostream& out, const std::string& word,
 	}
 
 	outputByte = (uchar)strtol(word.c_str(), (char**)NULL, 16);
-	out << outputByte;
+	out.push_back((uchar)outputByte);
 	return 1;
 }
 
@@ -1515,9 +1647,9 @@ int Binasc::processHexWord(std::ostream& out, const std::string& word,
 //     its constituent byte
 //
 
-int Binasc::processStringWord(std::ostream& out, const std::string& word,
+int Binasc::processStringWord(std::vector<uchar>& out, const std::string& word,
 		int /* lineNum */) {
-	out << word;
+	out.insert(out.end(), word.begin(), word.end());
 	return 1;
 }
 
@@ -1529,7 +1661,7 @@ int Binasc::processStringWord(std::ostream& out, const std::string& word,
 //     its constituent byte
 //
 
-int Binasc::processAsciiWord(std::ostream& out, const std::string& word,
+int Binasc::processAsciiWord(std::vector<uchar>& out, const std::string& word,
 		int lineNum) {
 	int length = (int)word.size();
 	uchar outputByte;
@@ -1552,7 +1684,7 @@ int Binasc::processAsciiWord(std::ostream& out, const std::string& word,
 	} else {
 		outputByte = ' ';
 	}
-	out << outputByte;
+	out.push_back((uchar)outputByte);
 	return 1;
 }
 
@@ -1564,7 +1696,7 @@ int Binasc::processAsciiWord(std::ostream& out, const std::string& word,
 //     its constituent byte
 //
 
-int Binasc::processBinaryWord(std::ostream& out, const std::string& word,
+int Binasc::processBinaryWord(std::vector<uchar>& out, const std::string& word,
 		int lineNum) {
 	int length = (int)word.size();        // length of ascii binary number
 	int commaIndex = -1;             // index location of comma in number
@@ -1655,7 +1787,7 @@ int Binasc::processBinaryWord(std::ostream& out, const std::string& word,
 	}
 
 	// send the byte to the output
-	out << output;
+	out.push_back((uchar)output);
 	return 1;
 }
 
@@ -1672,7 +1804,7 @@ int Binasc::processBinaryWord(std::ostream& out, const std::string& word,
 //   without space by an integer.
 //
 
-int Binasc::processVlvWord(std::ostream& out, const std::string& word,
+int Binasc::processVlvWord(std::vector<uchar>& out, const std::string& word,
 		int lineNum) {
 	if (word.size() < 2) {
 		std::cerr << "Error on line: " << lineNum
@@ -1708,7 +1840,7 @@ int Binasc::processVlvWord(std::ostream& out, const std::string& word,
 
 	for (i=0; i<5; i++) {
 		if (byte[i] >= 0x80 || i == 4) {
-			out << byte[i];
+			out.push_back((uchar)byte[i]);
 		}
 	}
 
@@ -1723,7 +1855,7 @@ int Binasc::processVlvWord(std::ostream& out, const std::string& word,
 //   a three-byte number of microseconds per beat per minute value.
 //
 
-int Binasc::processMidiTempoWord(std::ostream& out, const std::string& word,
+int Binasc::processMidiTempoWord(std::vector<uchar>& out, const std::string& word,
 		int lineNum) {
 	if (word.size() < 2) {
 		std::cerr << "Error on line: " << lineNum
@@ -1749,7 +1881,9 @@ int Binasc::processMidiTempoWord(std::ostream& out, const std::string& word,
 	uchar byte0 = intval & 0xff;
 	uchar byte1 = (intval >>  8) & 0xff;
 	uchar byte2 = (intval >> 16) & 0xff;
-	out << byte2 << byte1 << byte0;
+	out.push_back((uchar)byte2);
+	out.push_back((uchar)byte1);
+	out.push_back((uchar)byte0);
 	return 1;
 }
 
@@ -1764,7 +1898,7 @@ int Binasc::processMidiTempoWord(std::ostream& out, const std::string& word,
 //   7-bits of the 14-bit value, then the MSB coming second and containing
 //   the top 7-bits of the 14-bit value.
 
-int Binasc::processMidiPitchBendWord(std::ostream& out, const std::string& word,
+int Binasc::processMidiPitchBendWord(std::vector<uchar>& out, const std::string& word,
 		int lineNum) {
 	if (word.size() < 2) {
 		std::cerr << "Error on line: " << lineNum
@@ -1791,7 +1925,8 @@ int Binasc::processMidiPitchBendWord(std::ostream& out, const std::string& word,
 	int intval = (int)(((1 << 13)-0.5)  * (value + 1.0) + 0.5);
 	uchar LSB = intval & 0x7f;
 	uchar MSB = (intval >>  7) & 0x7f;
-	out << LSB << MSB;
+	out.push_back((uchar)LSB);
+	out.push_back((uchar)MSB);
 	return 1;
 }
 
@@ -45,7 +45,7 @@ MidiEvent::MidiEvent(int command, int p1, int p2)
 }
 
 
-MidiEvent::MidiEvent(int aTime, int aTrack, vector<uchar>& message)
+MidiEvent::MidiEvent(int aTime, int aTrack, std::vector<uchar>& message)
 		: MidiMessage(message) {
 	track       = aTrack;
 	tick        = aTime;
@@ -55,6 +55,11 @@ MidiEvent::MidiEvent(int aTime, int aTrack, vector<uchar>& message)
 }
 
 
+MidiEvent::MidiEvent(const MidiMessage& message) : MidiMessage(message) {
+	clearVariables();
+}
+
+
 MidiEvent::MidiEvent(const MidiEvent& mfevent) : MidiMessage() {
 	track   = mfevent.track;
 	tick    = mfevent.tick;
@@ -134,7 +139,7 @@ MidiEvent& MidiEvent::operator=(const MidiMessage& message) {
 }
 
 
-MidiEvent& MidiEvent::operator=(const vector<uchar>& bytes) {
+MidiEvent& MidiEvent::operator=(const std::vector<uchar>& bytes) {
 	clearVariables();
 	this->resize(bytes.size());
 	for (int i=0; i<(int)this->size(); i++) {
@@ -144,14 +149,14 @@ MidiEvent& MidiEvent::operator=(const vector<uchar>& bytes) {
 }
 
 
-MidiEvent& MidiEvent::operator=(const vector<char>& bytes) {
+MidiEvent& MidiEvent::operator=(const std::vector<char>& bytes) {
 	clearVariables();
 	setMessage(bytes);
 	return *this;
 }
 
 
-MidiEvent& MidiEvent::operator=(const vector<int>& bytes) {
+MidiEvent& MidiEvent::operator=(const std::vector<int>& bytes) {
 	clearVariables();
 	setMessage(bytes);
 	return *this;
@@ -14,8 +14,10 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <functional>
 #include <iterator>
 #include <list>
+#include <new>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -24,6 +26,38 @@
 
 namespace smf {
 
+//////////////////////////////
+//
+// MidiEventList::Block -- Storage for capacity events, constructed in
+//     order by the list that owns the block.  An event deleted from a
+//     list is destroyed in place; its storage is released with the block.
+//
+
+struct MidiEventList::Block {
+	const MidiEventList* owner;
+	MidiEvent* events;
+	int capacity;
+	int used;
+
+	Block(const MidiEventList* list, int size)
+		: owner(list),
+		  events(static_cast<MidiEvent*>(::operator new(sizeof(MidiEvent) * size))),
+		  capacity(size),
+		  used(0) {
+	}
+
+	~Block() {
+		::operator delete(events);
+	}
+
+	bool contains(const MidiEvent* event) const {
+		return !std::less<const MidiEvent*>()(event, events) &&
+				std::less<const MidiEvent*>()(event, events + used);
+	}
+};
+
+
+
 //////////////////////////////
 //
 // MidiEventList::MidiEventList -- Constructor.
@@ -42,9 +76,10 @@ MidiEventList::MidiEventList(void) {
 
 MidiEventList::MidiEventList(const MidiEventList& other) {
 	list.reserve(other.list.size());
+	blockHint = (int)other.list.size();
 	auto it = other.list.begin();
 	std::generate_n(std::back_inserter(list), other.list.size(), [&]() -> MidiEvent* {
-		return new MidiEvent(**it++);
+		return newEvent(**it++);
 	});
 }
 
@@ -58,6 +93,8 @@ MidiEventList::MidiEventList(const MidiEventList& other) {
 MidiEventList::MidiEventList(MidiEventList&& other) {
 	list = std::move(other.list);
 	other.list.clear();
+	blocks = std::move(other.blocks);
+	other.blocks.clear();
 }
 
 
@@ -167,11 +204,12 @@ const MidiEvent& MidiEventList::getEvent(int index) const {
 void MidiEventList::clear(void) {
 	for (auto& item : list) {
 		if (item != NULL) {
-			delete item;
+			deleteEvent(item);
 			item = NULL;
 		}
 	}
 	list.resize(0);
+	blocks.clear();
 }
 
 
@@ -199,6 +237,7 @@ void MidiEventList::reserve(int rsize) {
 	if (rsize > (int)list.size()) {
 		list.reserve(rsize);
 	}
+	blockHint = rsize;
 }
 
 
@@ -237,7 +276,7 @@ int MidiEventList::getEventCount(void) const {
 //
 
 int MidiEventList::append(MidiEvent& event) {
-	MidiEvent* ptr = new MidiEvent(event);
+	MidiEvent* ptr = newEvent(event);
 	list.push_back(ptr);
 	return (int)list.size()-1;
 }
@@ -271,7 +310,7 @@ void MidiEventList::removeEmpties(void) {
 	int count = 0;
 	for (auto& item : list) {
 		if (item->empty()) {
-			delete item;
+			deleteEvent(item);
 			item = NULL;
 			count++;
 		}
@@ -594,8 +633,10 @@ int MidiEventList::markSequence(int sequence) {
 
 //////////////////////////////
 //
-// MidiEventList::detach -- De-allocate any MidiEvents present in the list
-//    and set the size of the list to 0.
+// MidiEventList::detach -- Set the size of the list to 0 without
+//    de-allocating the MidiEvents it held.  The storage blocks stay with
+//    the list, so a list taking over its events has to share them with
+//    shareBlocks() before this list is deleted.
 //
 
 
@@ -626,10 +667,69 @@ int MidiEventList::push_back_no_copy(MidiEvent* event) {
 
 MidiEventList& MidiEventList::operator=(MidiEventList& other) {
 	list.swap(other.list);
+	blocks.swap(other.blocks);
 	return *this;
 }
 
 
+
+//////////////////////////////
+//
+// MidiEventList::newEvent -- Copy an event into the block storage of the
+//     list, starting a new block when the last one of the list is full.
+//     A new block holds what reserve() asked for, or as many events as
+//     the list already has, within 64 to 16384 events.
+//
+
+MidiEvent* MidiEventList::newEvent(const MidiEvent& event) {
+	if (blocks.empty() || (blocks.back()->owner != this) ||
+			(blocks.back()->used == blocks.back()->capacity)) {
+		int size = (int)list.size();
+		int capacity = blockHint > size ? blockHint - size : size;
+		capacity = std::max(64, std::min(capacity, 16384));
+		blocks.push_back(std::make_shared<Block>(this, capacity));
+	}
+	Block& block = *blocks.back();
+	MidiEvent* ptr = new (block.events + block.used) MidiEvent(event);
+	block.used++;
+	return ptr;
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventList::deleteEvent -- Destroy an event of the list, in place if
+//     it lives in a block, otherwise it came from push_back_no_copy().
+//
+
+void MidiEventList::deleteEvent(MidiEvent* event) {
+	for (auto it = blocks.rbegin(); it != blocks.rend(); ++it) {
+		if ((*it)->contains(event)) {
+			event->~MidiEvent();
+			return;
+		}
+	}
+	delete event;
+}
+
+
+
+//////////////////////////////
+//
+// MidiEventList::shareBlocks -- Keep the blocks of another list alive
+//     while this list holds events taken from it.
+//
+
+void MidiEventList::shareBlocks(const MidiEventList& other) {
+	for (auto& block : other.blocks) {
+		if (std::find(blocks.begin(), blocks.end(), block) == blocks.end()) {
+			blocks.insert(blocks.begin(), block);
+		}
+	}
+}
+
+
 ///////////////////////////////////////////////////////////////////////////
 //
 // private functions
@@ -16,18 +16,73 @@
 #include "Binasc.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
 #include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 
 namespace smf {
 
 
+//////////////////////////////
+//
+// MemoryBuffer -- Stream buffer for reading bytes held in memory without
+//     copying them, as std::istringstream would.
+//
+
+namespace {
+
+class MemoryBuffer : public std::streambuf {
+	public:
+		MemoryBuffer(const char* data, size_t size) {
+			char* start = const_cast<char*>(data);
+			setg(start, start, start + size);
+		}
+
+		// number of bytes read so far
+		size_t position(void) const { return gptr() - eback(); }
+};
+
+
+//////////////////////////////
+//
+// AppendBuffer -- Stream buffer that appends the bytes written to it to a
+//     vector, so that a stream can be copied into memory without the extra
+//     copy made by std::ostringstream::str().
+//
+
+class AppendBuffer : public std::streambuf {
+	public:
+		AppendBuffer(std::vector<uchar>& output) : output(output) { }
+
+	protected:
+		int_type overflow(int_type ch) override {
+			if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+				output.push_back((uchar)ch);
+			}
+			return traits_type::not_eof(ch);
+		}
+		std::streamsize xsputn(const char* data, std::streamsize count) override {
+			output.insert(output.end(), (const uchar*)data,
+					(const uchar*)data + count);
+			return count;
+		}
+
+	private:
+		std::vector<uchar>& output;
+};
+
+} // end of anonymous namespace
+
+
 const std::string MidiFile::encodeLookup = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/=";
 
 const std::vector<int> MidiFile::decodeLookup {
@@ -156,6 +211,8 @@ MidiFile& MidiFile::operator=(const MidiFile& other) {
 	m_timemapvalid        = other.m_timemapvalid;
 	m_timemap             = other.m_timemap;
 	m_rwstatus            = other.m_rwstatus;
+	m_readThreads         = other.m_readThreads;
+	m_readTickLimit       = other.m_readTickLimit;
 	if (other.m_linkedEventsQ) {
 		linkEventPairs();
 	}
@@ -176,6 +233,8 @@ MidiFile& MidiFile::operator=(MidiFile&& other) {
 	m_timemapvalid        = other.m_timemapvalid;
 	m_timemap             = other.m_timemap;
 	m_rwstatus            = other.m_rwstatus;
+	m_readThreads         = other.m_readThreads;
+	m_readTickLimit       = other.m_readTickLimit;
 	return *this;
 }
 
@@ -220,16 +279,15 @@ bool MidiFile::read(std::istream& input) {
 		// the MIDI file is in the binasc format which is an ASCII representation
 		// of the MIDI file.  Convert the binasc content into binary content and
 		// then continue reading with this function.
-		std::stringstream binarydata;
+		std::vector<uchar> binarydata;
 		Binasc binasc;
-		binasc.writeToBinary(binarydata, input);
-		binarydata.seekg(0, std::ios_base::beg);
-		if (binarydata.peek() != 'M') {
+		binasc.writeToBuffer(binarydata, input);
+		if (binarydata.empty() || (binarydata[0] != 'M')) {
 			std::cerr << "Bad MIDI data input" << std::endl;
 			m_rwstatus = false;
 			return m_rwstatus;
 		} else {
-			m_rwstatus = readSmf(binarydata);
+			m_rwstatus = readSmfData(binarydata);
 			return m_rwstatus;
 		}
 	} else {
@@ -295,6 +353,76 @@ bool MidiFile::readSmf(const std::string& filename) {
 bool MidiFile::readSmf(std::istream& input) {
 	m_rwstatus = true;
 
+	int tracks;
+	if (!readHeader(input, tracks)) {
+		return m_rwstatus;
+	}
+
+	//////////////////////////////////////////////////
+	//
+	// now read individual tracks:
+	//
+
+	if ((m_readTickLimit >= 0) || ((m_readThreads != 1) && (tracks > 1))) {
+		std::vector<uchar> data;
+		AppendBuffer buffer(data);
+		std::ostream output(&buffer);
+		output << input.rdbuf();
+		if (!readTrackData(data, 0, tracks)) {
+			return m_rwstatus;
+		}
+	} else if (!readTracks(input, tracks)) {
+		return m_rwstatus;
+	}
+
+	m_theTimeState = TIME_STATE_ABSOLUTE;
+
+	// The original order of the MIDI events is marked with an enumeration which
+	// allows for reconstruction of the order when merging/splitting tracks to/from
+	// a type-0 configuration.
+	markSequence();
+
+	return m_rwstatus;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::readSmfData -- Parse a Standard MIDI File held in memory,
+//     such as the output of the Binasc class, without copying it into a
+//     stream.
+//
+
+bool MidiFile::readSmfData(const std::vector<uchar>& data) {
+	m_rwstatus = true;
+
+	MemoryBuffer buffer((const char*)data.data(), data.size());
+	std::istream input(&buffer);
+	int tracks;
+	if (!readHeader(input, tracks)) {
+		return m_rwstatus;
+	}
+	if (!readTrackData(data, buffer.position(), tracks)) {
+		return m_rwstatus;
+	}
+
+	m_theTimeState = TIME_STATE_ABSOLUTE;
+	markSequence();
+
+	return m_rwstatus;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::readHeader -- Read the MThd chunk of a Standard MIDI File and
+//     prepare one event list for each of its tracks.  Returns false if the
+//     header is not valid.
+//
+
+bool MidiFile::readHeader(std::istream& input, int& tracks) {
 	std::string filename = getFilename();
 
 	int    character;
@@ -382,7 +510,6 @@ bool MidiFile::readSmf(std::istream& input) {
 	}
 
 	// Header parameter #2: track count
-	int tracks;
 	shortdata = readLittleEndian2Bytes(input);
 	if (type == 0 && shortdata != 1) {
 		std::cerr << "Error: Type 0 MIDI file can only contain one track" << std::endl;
@@ -425,11 +552,105 @@ bool MidiFile::readSmf(std::istream& input) {
 		m_ticksPerQuarterNote = shortdata;
 	}
 
+	return true;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::readTrackData -- Read the track chunks that start at offset in
+//     data, decoding them from memory and falling back to the serial reader
+//     for chunks that the buffer decoder does not handle.
+//
+
+bool MidiFile::readTrackData(const std::vector<uchar>& data, ulong offset, int tracks) {
+	if (!readTracksParallel(data, offset, tracks)) {
+		// The track chunks are not laid out the way the serial reader
+		// would find them, so read them again serially (which also
+		// prints the usual error messages).
+		for (int i=0; i<tracks; i++) {
+			m_events[i]->clear();
+		}
+		MemoryBuffer buffer((const char*)data.data() + offset, data.size() - offset);
+		std::istream serial(&buffer);
+		if (!readTracks(serial, tracks)) {
+			return false;
+		}
+		if (m_readTickLimit >= 0) {
+			truncateTracks(m_readTickLimit);
+		}
+	}
+	return true;
+}
 
-	//////////////////////////////////////////////////
-	//
-	// now read individual tracks:
-	//
+
+
+//////////////////////////////
+//
+// MidiFile::setReadThreads -- Set the number of threads used by readSmf()
+//     to decode the tracks of a multi-track file.  1 (the default) reads
+//     the tracks serially, and 0 uses one thread per hardware thread.
+//
+
+void MidiFile::setReadThreads(int count) {
+	m_readThreads = count < 0 ? 0 : count;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::getReadThreads -- Return the number of threads used by
+//     readSmf() to decode tracks (0 = one per hardware thread).
+//
+
+int MidiFile::getReadThreads(void) const {
+	return m_readThreads;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::setReadTickLimit -- Make readSmf() stop reading each track
+//     after the first event whose tick is past the limit, so that a
+//     preview of the start of a long file does not decode all of it.
+//     The rest of the track chunks is skipped without being checked,
+//     and the tracks do not end with an end-of-track message.  Note-offs
+//     past the limit are not read, so notes sounding at the limit are
+//     left unlinked.  -1 (the default) reads whole tracks.
+//
+
+void MidiFile::setReadTickLimit(int tick) {
+	m_readTickLimit = tick < 0 ? -1 : tick;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::getReadTickLimit -- Return the tick after which readSmf()
+//     stops reading a track, or -1 if whole tracks are read.
+//
+
+int MidiFile::getReadTickLimit(void) const {
+	return m_readTickLimit;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::readTracks -- Read the track chunks of a Standard MIDI File
+//     one after another from the input stream.  Returns false if reading
+//     has to stop early.
+//
+
+bool MidiFile::readTracks(std::istream& input, int tracks) {
+	std::string filename = getFilename();
+	int    character;
+	ulong  longdata;
 
 	uchar runningCommand;
 	MidiEvent event;
@@ -535,14 +756,234 @@ bool MidiFile::readSmf(std::istream& input) {
 		}
 	}
 
-	m_theTimeState = TIME_STATE_ABSOLUTE;
+	return true;
+}
 
-	// The original order of the MIDI events is marked with an enumeration which
-	// allows for reconstruction of the order when merging/splitting tracks to/from
-	// a type-0 configuration.
-	markSequence();
 
-	return m_rwstatus;
+
+//////////////////////////////
+//
+// MidiFile::readTracksParallel -- Index the track chunks that start at
+//     offset in data, just after the MIDI header, and decode them on a pool of threads.  Each
+//     thread only writes to the event lists of the tracks it decodes.
+//     Returns false if a chunk does not end with its end-of-track
+//     message or holds anything the serial reader treats specially, in
+//     which case the caller reads the data again serially.  With a read
+//     tick limit each chunk is only decoded up to the limit.
+//
+
+bool MidiFile::readTracksParallel(const std::vector<uchar>& data, ulong offset,
+		int tracks) {
+	const uchar* base = data.data();
+	ulong size = data.size();
+	std::vector<ulong> start(tracks);
+	std::vector<ulong> length(tracks);
+	ulong position = offset;
+	for (int i=0; i<tracks; i++) {
+		if ((size - position < 8) || (memcmp(base + position, "MTrk", 4) != 0)) {
+			return false;
+		}
+		const uchar* p = base + position + 4;
+		ulong chunksize = ((ulong)p[0] << 24) | ((ulong)p[1] << 16) |
+				((ulong)p[2] << 8) | (ulong)p[3];
+		position += 8;
+		if (chunksize > size - position) {
+			return false;
+		}
+		start[i] = position;
+		length[i] = chunksize;
+		position += chunksize;
+	}
+
+	int threads = m_readThreads;
+	if (threads <= 0) {
+		threads = (int)std::thread::hardware_concurrency();
+	}
+	threads = std::max(1, std::min(threads, tracks));
+
+	std::atomic<int> next(0);
+	std::atomic<bool> valid(true);
+	auto worker = [&]() {
+		int i;
+		while (valid && ((i = next++) < tracks)) {
+			m_events[i]->reserve((int)length[i]/2);
+			if (!decodeTrack(base + start[i], length[i], i, m_readTickLimit,
+					*m_events[i])) {
+				valid = false;
+			}
+		}
+	};
+
+	std::vector<std::thread> pool;
+	try {
+		for (int t=1; t<threads; t++) {
+			pool.emplace_back(worker);
+		}
+	} catch (const std::system_error&) {
+		// Continue with the threads that could be started.
+	}
+	worker();
+	for (auto& thread : pool) {
+		thread.join();
+	}
+	return valid;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::decodeTrack -- Decode one track chunk into events in the
+//     same way as readTracks() does, without touching the object state.
+//     Returns false on anything readTracks() would report as an error or
+//     read differently, and if the end-of-track message is not the last
+//     thing in the chunk.  If limit is not negative, decoding stops after
+//     the first event past that tick.
+//
+
+bool MidiFile::decodeTrack(const uchar* data, ulong size, int track,
+		int limit, MidiEventList& events) {
+	ulong p = 0;
+	uchar runningCommand = 0;
+	int absticks = 0;
+	MidiEvent event;
+	std::vector<uchar> bytes;
+
+	// VLV values of up to 4 bytes, as readVLValue() reads them.
+	auto readVLV = [&](ulong& value) -> bool {
+		value = 0;
+		for (int k=0; k<4; k++) {
+			if (p >= size) {
+				return false;
+			}
+			uchar byte = data[p++];
+			value = (value << 7) | (byte & 0x7f);
+			if (byte < 0x80) {
+				return true;
+			}
+		}
+		return false;
+	};
+	auto readData = [&](int count) -> bool {
+		if (size - p < (ulong)count) {
+			return false;
+		}
+		for (int k=0; k<count; k++) {
+			if (data[p] > 0x7f) {
+				return false;
+			}
+			bytes.push_back(data[p++]);
+		}
+		return true;
+	};
+
+	while (p < size) {
+		ulong delta;
+		if (!readVLV(delta) || (p >= size)) {
+			return false;
+		}
+		absticks += delta;
+
+		bytes.clear();
+		uchar byte = data[p++];
+		int runningQ = 0;
+		if (byte < 0x80) {
+			if ((runningCommand == 0) || (runningCommand >= 0xf0)) {
+				return false;
+			}
+			runningQ = 1;
+		} else {
+			runningCommand = byte;
+		}
+		bytes.push_back(runningCommand);
+		if (runningQ) {
+			bytes.push_back(byte);
+		}
+
+		switch (runningCommand & 0xf0) {
+			case 0x80:
+			case 0x90:
+			case 0xA0:
+			case 0xB0:
+			case 0xE0:
+				if (!readData(2 - runningQ)) {
+					return false;
+				}
+				break;
+			case 0xC0:
+			case 0xD0:
+				if (!readData(1 - runningQ)) {
+					return false;
+				}
+				break;
+			default:
+				if (runningCommand == 0xff) {
+					// Meta type and length VLV are kept in the message.
+					// extractMidiData() stops a VLV at a second byte of 0x80.
+					if (p >= size) {
+						return false;
+					}
+					ulong start = p++;
+					ulong count;
+					if (!readVLV(count)) {
+						return false;
+					}
+					if ((p - start > 2) && (data[start + 2] == 0x80)) {
+						return false;
+					}
+					if (count > size - p) {
+						return false;
+					}
+					bytes.insert(bytes.end(), data + start, data + p + count);
+					p += count;
+				} else if ((runningCommand == 0xf0) || (runningCommand == 0xf7)) {
+					ulong count;
+					if (!readVLV(count) || (count > size - p)) {
+						return false;
+					}
+					bytes.insert(bytes.end(), data + p, data + p + count);
+					p += count;
+				} else {
+					return false;
+				}
+		}
+
+		event.setMessage(bytes);
+		event.tick = absticks;
+		event.track = track;
+		events.push_back(event);
+		if ((bytes[0] == 0xff) && (bytes[1] == 0x2f)) {
+			return p == size;
+		}
+		if ((limit >= 0) && (absticks > limit)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::truncateTracks -- Remove the events of each track that follow
+//     its first event past the given tick, as decodeTrack() leaves them
+//     with a read tick limit.
+//
+
+void MidiFile::truncateTracks(int tick) {
+	for (auto track : m_events) {
+		std::vector<MidiEvent*>& list = track->list;
+		for (int i=0; i<(int)list.size(); i++) {
+			if (list[i]->tick > tick) {
+				for (int j=i+1; j<(int)list.size(); j++) {
+					track->deleteEvent(list[j]);
+				}
+				list.resize(i+1);
+				break;
+			}
+		}
+	}
 }
 
 
@@ -1050,6 +1491,7 @@ void MidiFile::joinTracks(void) {
 		makeAbsoluteTicks();
 	}
 	for (i=0; i<length; i++) {
+		joinedTrack->shareBlocks(*m_events[i]);
 		for (j=0; j<(int)m_events[i]->size(); j++) {
 			joinedTrack->push_back_no_copy(&(*m_events[i])[j]);
 		}
@@ -1104,6 +1546,7 @@ void MidiFile::splitTracks(void) {
 	m_events.resize(trackCount);
 	for (i=0; i<trackCount; i++) {
 		m_events[i] = new MidiEventList;
+		m_events[i]->shareBlocks(*olddata);
 	}
 
 	for (i=0; i<length; i++) {
@@ -1168,6 +1611,7 @@ void MidiFile::splitTracksByChannel(void) {
 	m_events.resize(trackCount);
 	for (i=0; i<trackCount; i++) {
 		m_events[i] = new MidiEventList;
+		m_events[i]->shareBlocks(eventlist);
 	}
 
 	for (i=0; i<length; i++) {
@@ -1506,67 +1950,92 @@ double MidiFile::getTimeInSeconds(int aTrack, int anIndex) {
 
 
 double MidiFile::getTimeInSeconds(int tickvalue) {
+	int segment = 0;
+	return getTimeInSecondsSeq(tickvalue, segment);
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::getAbsoluteTickTime -- return the tick value represented
+//    by the input time in seconds.  If there is not tick entry at
+//    the given time in seconds, then interpolate between two values.
+//
+
+double MidiFile::getAbsoluteTickTime(double starttime) {
+	int segment = 0;
+	return getAbsoluteTickTimeSeq(starttime, segment);
+}
+
+
+
+//////////////////////////////
+//
+// MidiFile::getTimeInSecondsSeq -- return the time in seconds for
+//    the given tick, like getTimeInSeconds().  segment is a cursor
+//    into the time map: start it at 0 and pass it back for the next
+//    lookup, so that ascending ticks are found in constant time.
+//    Returns -1.0 for ticks outside of the file.
+//
+
+double MidiFile::getTimeInSecondsSeq(int tickvalue, int& segment) {
 	if (m_timemapvalid == 0) {
 		buildTimeMap();
 		if (m_timemapvalid == 0) {
 			return -1.0;    // something went wrong
 		}
 	}
-
-	_TickTime key;
-	key.tick    = tickvalue;
-	key.seconds = -1;
-
-	void* ptr = bsearch(&key, m_timemap.data(), m_timemap.size(),
-			sizeof(_TickTime), ticksearch);
-
-	if (ptr == NULL) {
-		// The specific tick value was not found, so do a linear
-		// search for the two tick values which occur before and
-		// after the tick value, and do a linear interpolation of
-		// the time in seconds values to figure out the final
-		// time in seconds.
-		// Since the code is not yet written, kill the program at this point:
-		return linearSecondInterpolationAtTick(tickvalue);
-	} else {
-		return ((_TickTime*)ptr)->seconds;
+	if ((tickvalue < 0) || (tickvalue > m_timemap.back().tick)) {
+		return -1.0;    // don't try to extrapolate
 	}
+
+	segment = findSegmentAtTick(tickvalue, segment);
+	const _TickTime& entry = m_timemap[segment];
+	return entry.seconds + (tickvalue - entry.tick) * entry.secondsPerTick;
 }
 
 
 
 //////////////////////////////
 //
-// MidiFile::getAbsoluteTickTime -- return the tick value represented
-//    by the input time in seconds.  If there is not tick entry at
-//    the given time in seconds, then interpolate between two values.
+// MidiFile::getAbsoluteTickTimeSeq -- return the tick value at the
+//    given time in seconds, like getAbsoluteTickTime(), using segment
+//    as a cursor in the same way as getTimeInSecondsSeq().
 //
 
-double MidiFile::getAbsoluteTickTime(double starttime) {
+double MidiFile::getAbsoluteTickTimeSeq(double starttime, int& segment) {
 	if (m_timemapvalid == 0) {
 		buildTimeMap();
 		if (m_timemapvalid == 0) {
 			return -1.0;    // something went wrong
 		}
 	}
+	if ((starttime < 0.0) || (starttime > m_timemap.back().seconds)) {
+		return -1.0;
+	}
 
-	_TickTime key;
-	key.tick    = -1;
-	key.seconds = starttime;
+	segment = findSegmentAtSecond(starttime, segment);
+	const _TickTime& entry = m_timemap[segment];
+	if (entry.secondsPerTick <= 0.0) {
+		return entry.tick;
+	}
+	return entry.tick + (starttime - entry.seconds) / entry.secondsPerTick;
+}
 
-	void* ptr = bsearch(&key, m_timemap.data(), m_timemap.size(),
-			sizeof(_TickTime), secondsearch);
 
-	if (ptr == NULL) {
-		// The specific seconds value was not found, so do a linear
-		// search for the two time values which occur before and
-		// after the given time value, and do a linear interpolation of
-		// the time in tick values to figure out the final time in ticks.
-		return linearTickInterpolationAtSecond(starttime);
-	} else {
-		return ((_TickTime*)ptr)->tick;
-	}
 
+//////////////////////////////
+//
+// MidiFile::getTimeMapSize -- return the number of tempo segments in
+//    the time map, including the entry which ends it.
+//
+
+int MidiFile::getTimeMapSize(void) {
+	if (m_timemapvalid == 0) {
+		buildTimeMap();
+	}
+	return (int)m_timemap.size();
 }
 
 
@@ -1659,7 +2128,7 @@ const char* MidiFile::getFilename(void) const {
 //
 
 MidiEvent* MidiFile::addEvent(int aTrack, int aTick,
-		std::vector<uchar>& midiData) {
+		const std::vector<uchar>& midiData) {
 	m_timemapvalid = 0;
 	MidiEvent* me = new MidiEvent;
 	me->tick = aTick;
@@ -1670,6 +2139,17 @@ MidiEvent* MidiFile::addEvent(int aTrack, int aTick,
 }
 
 
+MidiEvent* MidiFile::addEvent(int aTrack, int aTick,
+		const MidiMessage& message) {
+	m_timemapvalid = 0;
+	MidiEvent* me = new MidiEvent(message);
+	me->tick = aTick;
+	me->track = aTrack;
+	m_events[aTrack]->push_back_no_copy(me);
+	return me;
+}
+
+
 
 //////////////////////////////
 //
@@ -2595,221 +3075,147 @@ void MidiFile::clearLinks(void) {
 
 //////////////////////////////
 //
-// MidiFile::linearTickInterpolationAtSecond -- return the tick value at the
-//    given input time.
+// MidiFile::findSegmentAtTick -- return the index of the last time map
+//    entry at or before the given tick.  The search starts at segment,
+//    so stepping through ascending ticks costs O(1) per call and a jump
+//    costs O(log T) for T tempo segments.
 //
 
-double MidiFile::linearTickInterpolationAtSecond(double seconds) {
-	if (m_timemapvalid == 0) {
-		buildTimeMap();
-		if (m_timemapvalid == 0) {
-			return -1.0;    // something went wrong
-		}
+int MidiFile::findSegmentAtTick(int tickvalue, int segment) {
+	int count = (int)m_timemap.size();
+	if ((segment < 0) || (segment >= count) || (m_timemap[segment].tick > tickvalue)) {
+		segment = 0;
 	}
-
-	int i;
-	double lasttime = m_timemap[m_timemap.size()-1].seconds;
-	// give an error value of -1 if time is out of range of data.
-	if (seconds < 0.0) {
-		return -1.0;
-	}
-	if (seconds > m_timemap[m_timemap.size()-1].seconds) {
-		return -1.0;
-	}
-
-	// Guess which side of the list is closest to target:
-	// Could do a more efficient algorithm since time values are sorted,
-	// but good enough for now...
-	int startindex = -1;
-	if (seconds < lasttime / 2) {
-		for (i=0; i<(int)m_timemap.size(); i++) {
-			if (m_timemap[i].seconds > seconds) {
-				startindex = i-1;
-				break;
-			} else if (m_timemap[i].seconds == seconds) {
-				startindex = i;
-				break;
-			}
-		}
-	} else {
-		for (i=(int)m_timemap.size()-1; i>0; i--) {
-			if (m_timemap[i].seconds < seconds) {
-				startindex = i+1;
-				break;
-			} else if (m_timemap[i].seconds == seconds) {
-				startindex = i;
-				break;
-			}
+	if ((segment + 1 < count) && (m_timemap[segment+1].tick <= tickvalue)) {
+		segment++;
+		if ((segment + 1 < count) && (m_timemap[segment+1].tick <= tickvalue)) {
+			auto it = std::upper_bound(m_timemap.begin() + segment + 1, m_timemap.end(),
+					tickvalue, [](int tick, const _TickTime& entry) {
+						return tick < entry.tick;
+					});
+			segment = (int)(it - m_timemap.begin()) - 1;
 		}
 	}
-
-	if (startindex < 0) {
-		return -1.0;
-	}
-	if (startindex >= (int)m_timemap.size()-1) {
-		return -1.0;
-	}
-
-	double x1 = m_timemap[startindex].seconds;
-	double x2 = m_timemap[startindex+1].seconds;
-	double y1 = m_timemap[startindex].tick;
-	double y2 = m_timemap[startindex+1].tick;
-	double xi = seconds;
-
-	return (xi-x1) * ((y2-y1)/(x2-x1)) + y1;
+	return segment;
 }
 
 
 
 //////////////////////////////
 //
-// MidiFile::linearSecondInterpolationAtTick -- return the time in seconds
-//    value at the given input tick time. (Ticks input could be made double).
+// MidiFile::findSegmentAtSecond -- return the index of the last time map
+//    entry at or before the given time in seconds, searching from segment
+//    like findSegmentAtTick().
 //
 
-double MidiFile::linearSecondInterpolationAtTick(int ticktime) {
-	if (m_timemapvalid == 0) {
-		buildTimeMap();
-		if (m_timemapvalid == 0) {
-			return -1.0;    // something went wrong
-		}
+int MidiFile::findSegmentAtSecond(double seconds, int segment) {
+	int count = (int)m_timemap.size();
+	if ((segment < 0) || (segment >= count) || (m_timemap[segment].seconds > seconds)) {
+		segment = 0;
 	}
-
-	int i;
-	double lasttick = m_timemap[m_timemap.size()-1].tick;
-	// give an error value of -1 if time is out of range of data.
-	if (ticktime < 0.0) {
-		return -1;
-	}
-	if (ticktime > m_timemap.back().tick) {
-		return -1;  // don't try to extrapolate
-	}
-
-	// Guess which side of the list is closest to target:
-	// Could do a more efficient algorithm since time values are sorted,
-	// but good enough for now...
-	int startindex = -1;
-	if (ticktime < lasttick / 2) {
-		for (i=0; i<(int)m_timemap.size(); i++) {
-			if (m_timemap[i].tick > ticktime) {
-				startindex = i-1;
-				break;
-			} else if (m_timemap[i].tick == ticktime) {
-				startindex = i;
-				break;
-			}
-		}
-	} else {
-		for (i=(int)m_timemap.size()-1; i>0; i--) {
-			if (m_timemap[i].tick < ticktime) {
-				startindex = i;
-				break;
-			} else if (m_timemap[i].tick == ticktime) {
-				startindex = i;
-				break;
-			}
+	if ((segment + 1 < count) && (m_timemap[segment+1].seconds <= seconds)) {
+		segment++;
+		if ((segment + 1 < count) && (m_timemap[segment+1].seconds <= seconds)) {
+			auto it = std::upper_bound(m_timemap.begin() + segment + 1, m_timemap.end(),
+					seconds, [](double value, const _TickTime& entry) {
+						return value < entry.seconds;
+					});
+			segment = (int)(it - m_timemap.begin()) - 1;
 		}
 	}
-
-	if (startindex < 0) {
-		return -1;
-	}
-	if (startindex >= (int)m_timemap.size()-1) {
-		return -1;
-	}
-
-	if (m_timemap[startindex].tick == ticktime) {
-		return m_timemap[startindex].seconds;
-	}
-
-	double x1 = m_timemap[startindex].tick;
-	double x2 = m_timemap[startindex+1].tick;
-	double y1 = m_timemap[startindex].seconds;
-	double y2 = m_timemap[startindex+1].seconds;
-	double xi = ticktime;
-
-	return (xi-x1) * ((y2-y1)/(x2-x1)) + y1;
+	return segment;
 }
 
 
 
 //////////////////////////////
 //
-// MidiFile::buildTimeMap -- build an index of the absolute tick values
-//      found in a MIDI file, and their corresponding time values in
-//      seconds, taking into consideration tempo change messages.  If no
-//      tempo messages are given (or until they are given, then the
-//      tempo is set to 120 beats per minute).  If SMPTE time code is
-//      used, then ticks are actually time values.  So don't build
-//      a time map for SMPTE ticks, and just calculate the time in
-//      seconds from the tick value (1000 ticks per second SMPTE
+// MidiFile::buildTimeMap -- build the tempo segments of the MIDI file:
+//      the tick and time in seconds at which each tempo starts, and its
+//      length of a tick in seconds.  Until the first tempo message the
+//      tempo is 120 beats per minute.  Tempo messages at the same tick
+//      are taken in track order, the last one wins.  The time in seconds
+//      of every event is then filled in by stepping through each track.
+//      If SMPTE time code is used, then ticks are actually time values.
+//      So don't build a time map for SMPTE ticks, and just calculate the
+//      time in seconds from the tick value (1000 ticks per second SMPTE
 //      is the only mode tested (25 frames per second and 40 subframes
 //      per frame).
 //
 
 void MidiFile::buildTimeMap(void) {
 
-	// convert the MIDI file to absolute time representation
-	// in single track mode (and undo if the MIDI file was not
+	// Work in absolute ticks, and undo this if the MIDI file was not
 	// in that state when this function was called.
-	//
-	int trackstate = getTrackState();
-	int timestate  = getTickState();
-
+	int timestate = getTickState();
 	makeAbsoluteTicks();
-	joinTracks();
-
-	int allocsize = getNumEvents(0);
-	m_timemap.reserve(allocsize+10);
-	m_timemap.clear();
 
-	_TickTime value;
-
-	int lasttick = 0;
-	int tickinit = 0;
-
-	int i;
 	int tpq = getTicksPerQuarterNote();
 	double defaultTempo = 120.0;
-	double secondsPerTick = 60.0 / (defaultTempo * tpq);
 
-	double lastsec = 0.0;
-	double cursec = 0.0;
-
-	for (i=0; i<getNumEvents(0); i++) {
-		int curtick = getEvent(0, i).tick;
-		getEvent(0, i).seconds = cursec;
-		if ((curtick > lasttick) || !tickinit) {
-			tickinit = 1;
-
-			// calculate the current time in seconds:
-			cursec = lastsec + (curtick - lasttick) * secondsPerTick;
-			getEvent(0, i).seconds = cursec;
+	std::vector<std::pair<int, double>> tempos;
+	int lasttick = 0;
+	int i, j;
+	for (i=0; i<getTrackCount(); i++) {
+		if (m_events[i] == NULL) {
+			continue;
+		}
+		MidiEventList& track = *m_events[i];
+		for (j=0; j<track.size(); j++) {
+			if (track[j].tick > lasttick) {
+				lasttick = track[j].tick;
+			}
+			if (track[j].isTempo()) {
+				tempos.emplace_back(track[j].tick, track[j].getTempoSPT(tpq));
+			}
+		}
+	}
+	std::stable_sort(tempos.begin(), tempos.end(),
+			[](const std::pair<int, double>& a, const std::pair<int, double>& b) {
+				return a.first < b.first;
+			});
 
-			// store the new tick to second mapping
-			value.tick = curtick;
-			value.seconds = cursec;
-			m_timemap.push_back(value);
-			lasttick   = curtick;
-			lastsec    = cursec;
+	m_timemap.clear();
+	_TickTime value;
+	value.tick = 0;
+	value.seconds = 0.0;
+	value.secondsPerTick = 60.0 / (defaultTempo * tpq);
+	m_timemap.push_back(value);
+	for (i=0; i<(int)tempos.size(); i++) {
+		_TickTime& last = m_timemap.back();
+		if (tempos[i].first == last.tick) {
+			last.secondsPerTick = tempos[i].second;
+			continue;
 		}
+		value.seconds = last.seconds + (tempos[i].first - last.tick) * last.secondsPerTick;
+		value.tick = tempos[i].first;
+		value.secondsPerTick = tempos[i].second;
+		m_timemap.push_back(value);
+	}
+	// close the map at the end of the file
+	if (lasttick > m_timemap.back().tick) {
+		_TickTime& last = m_timemap.back();
+		value.seconds = last.seconds + (lasttick - last.tick) * last.secondsPerTick;
+		value.tick = lasttick;
+		value.secondsPerTick = last.secondsPerTick;
+		m_timemap.push_back(value);
+	}
+	m_timemapvalid = 1;
 
-		// update the tempo if needed:
-		if (getEvent(0,i).isTempo()) {
-			secondsPerTick = getEvent(0,i).getTempoSPT(getTicksPerQuarterNote());
+	for (i=0; i<getTrackCount(); i++) {
+		if (m_events[i] == NULL) {
+			continue;
+		}
+		MidiEventList& track = *m_events[i];
+		int segment = 0;
+		for (j=0; j<track.size(); j++) {
+			track[j].seconds = getTimeInSecondsSeq(track[j].tick, segment);
 		}
 	}
 
-	// reset the states of the tracks or time values if necessary here:
 	if (timestate == TIME_STATE_DELTA) {
 		deltaTicks();
 	}
-	if (trackstate == TRACK_STATE_SPLIT) {
-		splitTracks();
-	}
-
-	m_timemapvalid = 1;
-
 }
 
 
@@ -3102,43 +3508,6 @@ void MidiFile::clear_no_deallocate(void) {
 
 
 
-//////////////////////////////
-//
-// MidiFile::ticksearch -- for finding a tick entry in the time map.
-//
-
-int MidiFile::ticksearch(const void* A, const void* B) {
-	_TickTime& a = *((_TickTime*)A);
-	_TickTime& b = *((_TickTime*)B);
-
-	if (a.tick < b.tick) {
-		return -1;
-	} else if (a.tick > b.tick) {
-		return 1;
-	}
-	return 0;
-}
-
-
-
-//////////////////////////////
-//
-// MidiFile::secondsearch -- for finding a second entry in the time map.
-//
-
-int MidiFile::secondsearch(const void* A, const void* B) {
-	_TickTime& a = *((_TickTime*)A);
-	_TickTime& b = *((_TickTime*)B);
-
-	if (a.seconds < b.seconds) {
-		return -1;
-	} else if (a.seconds > b.seconds) {
-		return 1;
-	}
-	return 0;
-}
-
-
 ///////////////////////////////////////////////////////////////////////////
 //
 // Static functions:
@@ -13,60 +13,276 @@
 
 #include "MidiMessage.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <initializer_list>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <stdexcept>
 
 
 namespace smf {
 
+//////////////////////////////
+//
+// MidiBytes::MidiBytes -- Constructor.
+//
+
+MidiBytes::MidiBytes(size_type count, uchar value) : MidiBytes() {
+	resize(count, value);
+}
+
+
+MidiBytes::MidiBytes(const MidiBytes& other) : MidiBytes() {
+	insertBytes(end(), other.data(), other.size());
+}
+
+
+MidiBytes::MidiBytes(MidiBytes&& other) noexcept : MidiBytes() {
+	swap(other);
+}
+
+
+
+//////////////////////////////
+//
+// MidiBytes::operator= --
+//
+
+MidiBytes& MidiBytes::operator=(const MidiBytes& other) {
+	if (this == &other) {
+		return *this;
+	}
+	clear();
+	insertBytes(end(), other.data(), other.size());
+	return *this;
+}
+
+
+MidiBytes& MidiBytes::operator=(MidiBytes&& other) noexcept {
+	if (this != &other) {
+		swap(other);
+		other.clear();
+	}
+	return *this;
+}
+
+
+
+//////////////////////////////
+//
+// MidiBytes::at -- Access a byte with a range check.
+//
+
+uchar& MidiBytes::at(size_type index) {
+	if (index >= m_size) {
+		throw std::out_of_range("MidiBytes::at");
+	}
+	return m_data[index];
+}
+
+
+const uchar& MidiBytes::at(size_type index) const {
+	if (index >= m_size) {
+		throw std::out_of_range("MidiBytes::at");
+	}
+	return m_data[index];
+}
+
+
+
+//////////////////////////////
+//
+// MidiBytes::resize -- Change the number of bytes, setting new bytes
+//    to value.
+//
+
+void MidiBytes::resize(size_type count, uchar value) {
+	reserve(count);
+	if (count > m_size) {
+		std::memset(m_data + m_size, value, count - m_size);
+	}
+	m_size = (uint32_t)count;
+}
+
+
+
+//////////////////////////////
+//
+// MidiBytes::assign -- Replace the contents with count copies of value.
+//
+
+void MidiBytes::assign(size_type count, uchar value) {
+	clear();
+	resize(count, value);
+}
+
+
+
+//////////////////////////////
+//
+// MidiBytes::insert -- Insert count copies of value before pos.
+//
+
+MidiBytes::iterator MidiBytes::insert(const_iterator pos, size_type count, uchar value) {
+	size_type index = pos - m_data;
+	reserve(m_size + count);
+	std::memmove(m_data + index + count, m_data + index, m_size - index);
+	std::memset(m_data + index, value, count);
+	m_size += (uint32_t)count;
+	return m_data + index;
+}
+
+
+
+//////////////////////////////
+//
+// MidiBytes::erase -- Remove the bytes from first up to last.
+//
+
+MidiBytes::iterator MidiBytes::erase(const_iterator first, const_iterator last) {
+	size_type index = first - m_data;
+	size_type count = last - first;
+	std::memmove(m_data + index, m_data + index + count, m_size - index - count);
+	m_size -= (uint32_t)count;
+	return m_data + index;
+}
+
+
+
+//////////////////////////////
+//
+// MidiBytes::swap -- Exchange the contents with another message.
+//
+
+void MidiBytes::swap(MidiBytes& other) {
+	if (this == &other) {
+		return;
+	}
+	uchar saved[INLINE_SIZE];
+	bool inlined = (m_data == m_inline);
+	bool otherInlined = (other.m_data == other.m_inline);
+	std::memcpy(saved, m_inline, INLINE_SIZE);
+	std::memcpy(m_inline, other.m_inline, INLINE_SIZE);
+	std::memcpy(other.m_inline, saved, INLINE_SIZE);
+	std::swap(m_data, other.m_data);
+	std::swap(m_size, other.m_size);
+	std::swap(m_capacity, other.m_capacity);
+	if (otherInlined) {
+		m_data = m_inline;
+	}
+	if (inlined) {
+		other.m_data = other.m_inline;
+	}
+}
+
+
+
+//////////////////////////////
+//
+// MidiBytes::grow -- Move the bytes to a heap block of at least count
+//    bytes.
+//
+
+void MidiBytes::grow(size_type count) {
+	size_type capacity = std::max(count, (size_type)m_capacity * 2);
+	uchar* block = new uchar[capacity];
+	std::memcpy(block, m_data, m_size);
+	if (m_data != m_inline) {
+		delete [] m_data;
+	}
+	m_data = block;
+	m_capacity = (uint32_t)capacity;
+}
+
+
+
+//////////////////////////////
+//
+// MidiBytes::insertBytes -- Insert count bytes before pos.
+//
+
+MidiBytes::iterator MidiBytes::insertBytes(const_iterator pos, const uchar* bytes, size_type count) {
+	size_type index = pos - m_data;
+	reserve(m_size + count);
+	std::memmove(m_data + index + count, m_data + index, m_size - index);
+	if (count > 0) {
+		std::memcpy(m_data + index, bytes, count);
+	}
+	m_size += (uint32_t)count;
+	return m_data + index;
+}
+
+
+
+//////////////////////////////
+//
+// comparison operators for MidiBytes --
+//
+
+bool operator==(const MidiBytes& a, const MidiBytes& b) {
+	return (a.size() == b.size()) && std::equal(a.begin(), a.end(), b.begin());
+}
+
+
+bool operator!=(const MidiBytes& a, const MidiBytes& b) {
+	return !(a == b);
+}
+
+
+bool operator<(const MidiBytes& a, const MidiBytes& b) {
+	return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+}
+
+
+
 //////////////////////////////
 //
 // MidiMessage::MidiMessage -- Constructor.
 //
 
-MidiMessage::MidiMessage(void) : vector<uchar>() {
+MidiMessage::MidiMessage(void) : MidiBytes() {
 	// do nothing
 }
 
 
-MidiMessage::MidiMessage(int command) : vector<uchar>(1, (uchar)command) {
+MidiMessage::MidiMessage(int command) : MidiBytes(1, (uchar)command) {
 	// do nothing
 }
 
 
-MidiMessage::MidiMessage(int command, int p1) : vector<uchar>(2) {
+MidiMessage::MidiMessage(int command, int p1) : MidiBytes(2) {
 	(*this)[0] = (uchar)command;
 	(*this)[1] = (uchar)p1;
 }
 
 
-MidiMessage::MidiMessage(int command, int p1, int p2) : vector<uchar>(3) {
+MidiMessage::MidiMessage(int command, int p1, int p2) : MidiBytes(3) {
 	(*this)[0] = (uchar)command;
 	(*this)[1] = (uchar)p1;
 	(*this)[2] = (uchar)p2;
 }
 
 
-MidiMessage::MidiMessage(const MidiMessage& message) : vector<uchar>() {
+MidiMessage::MidiMessage(const MidiMessage& message) : MidiBytes() {
 	(*this) = message;
 }
 
 
-MidiMessage::MidiMessage(const std::vector<uchar>& message) : vector<uchar>() {
+MidiMessage::MidiMessage(const std::vector<uchar>& message) : MidiBytes() {
 	setMessage(message);
 }
 
 
-MidiMessage::MidiMessage(const std::vector<char>& message) : vector<uchar>() {
+MidiMessage::MidiMessage(const std::vector<char>& message) : MidiBytes() {
 	setMessage(message);
 }
 
 
-MidiMessage::MidiMessage(const std::vector<int>& message) : vector<uchar>() {
+MidiMessage::MidiMessage(const std::vector<int>& message) : MidiBytes() {
 	setMessage(message);
 }
 
@@ -92,15 +308,12 @@ MidiMessage& MidiMessage::operator=(const MidiMessage& message) {
 	if (this == &message) {
 		return *this;
 	}
-	std::vector<uchar>::operator=(static_cast<const std::vector<uchar> &>(message));
+	MidiBytes::operator=(message);
 	return *this;
 }
 
 
 MidiMessage& MidiMessage::operator=(const std::vector<uchar>& bytes) {
-	if (this == &bytes) {
-		return *this;
-	}
 	setMessage(bytes);
 	return *this;
 }
@@ -327,7 +540,7 @@ bool MidiMessage::isMetaMessage(void) const {
 
 bool MidiMessage::isNoteOff(void) const {
 	const MidiMessage& message = *this;
-	const vector<uchar>& chars = message;
+	const MidiBytes& chars = message;
 	if (message.size() != 3) {
 		return false;
 	} else if ((chars[0] & 0xf0) == 0x80) {
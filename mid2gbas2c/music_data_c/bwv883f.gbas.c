@@ -1,7 +1,7 @@
 
 /* extern const byte* bwv883f[];
  * -- generated by gbas_to_c.py from file bwv883f.gbas
- *    memsize 250 in 81 segments
+ *    memsize 17649 in 70 segments
  */
 
 #define D(x) x                     /* wait x frames */
@@ -9,1195 +9,1147 @@
 #define N(c,n) 143+(c),(n)         /* channel c on, note=n */
 #define M(c,n,v) 159+(c),(n),(v)   /* channel c on, note=n, wavA=v */
 #define W(c,n,v,w) 175+(c),(n),(v),(w)   /* channel c on, note=n, wavA=v ,wavX=w*/
+#define P(i) 180,(i)               /* play phrase i of the dictionary */
+#define R() 181                    /* return from a phrase */
+#define A(c,r,a,b,d,e) 183+(c),(r),(a),(b),(d),(e) /* channel c arpeggio a,b,d,e every r frames */
+#define DRUM(c,i) 187+(c),(i)      /* channel c plays pattern i of the drum kit */
+#define WAVE(w,i) 182,(w),(i)      /* load entry i of the wave table into waveform w */
+#define FADE(c,v,f,s) 191+(c),(v),(f),(s)&255,((s)>>8)&255 /* channel c wavA to v in f frames, step s/256 a frame */
+#define GLIDE(c,n,f,s) 195+(c),(n),(f),(s)&255,((s)>>8)&255 /* channel c key to note n in f frames, step s a frame */
 #define byte unsigned char
 #define nohop __attribute__((nohop))
 
 nohop static const byte bwv883f000[] = {
-  D(14),W(1,61,64,3),D(3),W(1,61,97,3),D(1),D(5),W(1,61,107,1),D(6),W(1,61,117,1),D(6),
-  X(1),D(1),W(1,57,64,3),D(3),W(1,57,97,3),D(1),D(1),D(4),W(1,57,107,1),D(6),
-  W(1,57,117,1),D(6),X(1),D(2),W(1,54,64,3),D(3),W(1,54,97,3),D(1),D(5),W(1,54,107,1),
-  D(6),W(1,54,117,1),D(6),X(1),D(6),W(1,62,64,3),D(6),W(1,62,67,1),D(6),W(1,62,72,1),
-  D(6),W(1,62,77,1),D(6),W(1,62,82,1),D(6),W(1,62,87,1),D(6),W(1,62,92,1),D(6),W(1,62,97,1),
-  D(6),W(1,62,107,1),D(6),W(1,62,117,1),D(6),X(1),D(12),W(1,62,97,3),D(2),W(1,61,64,3),
-  D(3),W(1,61,97,3),D(1),W(1,62,107,1),D(5),W(1,61,107,1),D(1),W(1,59,64,3),D(3),W(1,59,97,3),
-  D(2),W(1,61,117,1),D(1),X(1),D(3),W(1,59,107,1),D(2),X(1),D(1),D(1),
-  W(1,61,64,3),D(2),W(1,59,117,1),D(2),D(2),W(1,61,67,1),D(2),X(1),D(4),W(1,61,72,1),
-  D(2),D(4),W(1,61,77,1),D(6),W(1,61,82,1),D(6),W(1,61,87,1),D(6),W(1,61,92,1),D(6),
-  W(1,61,97,1),D(6),W(1,61,107,1),D(2),W(1,61,97,3),D(6),W(1,61,107,1),D(6),W(1,61,117,1),D(6),
-  X(1),D(1),W(1,66,64,3),D(2),
+  D(14),W(1,61,64,3),D(3),M(1,61,97),D(6),W(1,61,107,1),D(6),M(1,61,117),D(6),X(1),
+  D(1),W(1,57,64,3),D(3),M(1,57,97),D(6),W(1,57,107,1),D(6),M(1,57,117),D(6),X(1),
+  D(2),W(1,54,64,3),D(3),M(1,54,97),D(6),W(1,54,107,1),D(6),M(1,54,117),D(6),X(1),
+  D(6),W(1,62,64,3),D(6),W(1,62,67,1),D(6),M(1,62,72),D(6),M(1,62,77),D(6),M(1,62,82),
+  D(6),M(1,62,87),D(6),M(1,62,92),D(6),M(1,62,97),D(6),M(1,62,107),D(6),M(1,62,117),
+  D(6),X(1),D(12),W(1,62,97,3),D(2),M(1,61,64),D(3),M(1,61,97),D(1),W(1,62,107,1),
+  D(5),N(1,61),D(1),W(1,59,64,3),D(3),M(1,59,97),D(2),W(1,61,117,1),D(1),X(1),
+  D(3),M(1,59,107),D(2),X(1),D(2),W(1,61,64,3),D(2),W(1,59,117,1),D(4),M(1,61,67),
+  D(2),X(1),D(4),M(1,61,72),D(6),M(1,61,77),D(6),M(1,61,82),D(6),M(1,61,87),
+  D(6),M(1,61,92),D(6),M(1,61,97),D(6),M(1,61,107),D(2),W(1,61,97,3),D(6),W(1,61,107,1),
+  D(6),M(1,61,117),D(6),X(1),D(1),W(1,66,64,3),D(2),M(1,66,97),D(6),W(1,66,107,1),
+  D(6),M(1,66,117),D(6),X(1),D(5),W(1,59,64,3),D(6),W(1,59,67,1),D(6),M(1,59,72),
+  D(6),M(1,59,77),D(6),M(1,59,82),
   0
 };
 
 nohop static const byte bwv883f001[] = {
-  W(1,66,97,3),D(3),D(3),W(1,66,107,1),D(6),W(1,66,117,1),D(6),X(1),D(5),W(1,59,64,3),
-  D(1),D(5),W(1,59,67,1),D(6),W(1,59,72,1),D(6),W(1,59,77,1),D(6),W(1,59,82,1),D(6),
-  W(1,59,87,1),D(6),W(1,59,92,1),D(6),W(1,59,97,1),D(6),W(1,59,107,1),D(6),W(1,59,117,1),D(6),
-  X(1),D(10),W(1,59,97,3),D(1),D(1),W(1,57,64,3),D(3),W(1,57,97,3),D(1),W(1,59,107,1),
-  D(5),W(1,57,107,1),D(1),W(1,56,64,3),D(3),W(1,56,97,3),D(2),W(1,57,117,1),D(1),X(1),
-  D(3),W(1,56,107,1),D(1),W(1,57,64,3),D(1),X(1),D(1),W(1,57,97,3),D(1),D(2),
-  W(1,56,117,1),D(2),D(1),W(1,57,107,1),D(3),X(1),D(3),W(1,57,117,1),D(3),D(3),
-  X(1),D(2),W(1,54,64,3),D(2),W(1,54,97,3),D(1),D(1),D(4),W(1,54,107,1),D(6),
-  W(1,54,117,1),D(6),X(1),D(2),W(1,57,64,3),D(3),W(1,57,97,3),D(1),D(1),W(1,56,64,3),
-  D(4),W(1,56,97,3),D(1),D(1),W(1,57,64,3),D(3),W(1,57,97,3),D(1),W(1,56,107,1),D(1),
-  W(1,56,64,3),D(3),W(1,56,97,3),D(1),W(1,57,107,1),D(1),W(1,57,64,3),D(2),W(1,57,97,3),D(1),
-  D(1),W(1,56,107,1),D(1),W(1,56,64,3),
+  D(6),M(1,59,87),D(6),M(1,59,92),D(6),M(1,59,97),D(6),M(1,59,107),D(6),M(1,59,117),
+  D(6),X(1),D(10),W(1,59,97,3),D(2),M(1,57,64),D(3),M(1,57,97),D(1),W(1,59,107,1),
+  D(5),N(1,57),D(1),W(1,56,64,3),D(3),M(1,56,97),D(2),W(1,57,117,1),D(1),X(1),
+  D(3),M(1,56,107),D(1),W(1,57,64,3),D(1),X(1),D(1),M(1,57,97),D(3),W(1,56,117,1),
+  D(3),M(1,57,107),D(3),X(1),D(3),M(1,57,117),D(6),X(1),D(2),W(1,54,64,3),
+  D(2),M(1,54,97),D(6),W(1,54,107,1),D(6),M(1,54,117),D(6),X(1),D(2),W(1,57,64,3),
+  D(3),M(1,57,97),D(2),M(1,56,64),D(4),M(1,56,97),D(2),M(1,57,64),D(3),M(1,57,97),
+  D(1),W(1,56,107,1),D(1),W(1,56,64,3),D(3),M(1,56,97),D(1),W(1,57,107,1),D(1),W(1,57,64,3),
+  D(2),M(1,57,97),D(2),W(1,56,107,1),D(1),W(1,56,64,3),D(1),X(1),D(2),M(1,56,97),
+  D(2),M(1,57,64),D(1),X(1),D(2),M(1,57,97),D(1),W(1,56,107,1),D(2),W(1,56,64,3),
+  D(3),M(1,56,97),D(1),W(1,56,117,1),D(1),W(1,57,64,3),D(2),M(1,57,97),D(2),W(1,56,107,1),
+  D(1),W(1,56,64,3),D(3),M(1,56,97),D(2),W(1,56,117,1),D(2),W(1,57,64,3),D(2),M(1,57,97),
+  D(1),
   0
 };
 
 nohop static const byte bwv883f002[] = {
-  D(1),X(1),D(2),W(1,56,97,3),D(2),W(1,57,64,3),D(1),X(1),D(1),D(1),
-  W(1,57,97,3),D(1),W(1,56,107,1),D(2),W(1,56,64,3),D(1),D(2),W(1,56,97,3),D(1),W(1,56,117,1),
-  D(1),W(1,57,64,3),D(1),D(1),W(1,57,97,3),D(1),D(1),W(1,56,107,1),D(1),W(1,56,64,3),
-  D(3),W(1,56,97,3),D(1),D(1),W(1,56,117,1),D(1),D(1),W(1,57,64,3),D(2),W(1,57,97,3),
-  D(1),W(1,56,64,3),D(1),X(1),D(2),W(1,56,97,3),D(1),D(1),W(1,57,107,1),D(2),
-  W(1,57,64,3),D(2),W(1,57,97,3),D(1),D(1),W(1,56,64,3),D(2),W(1,56,97,3),D(1),D(1),
-  W(1,57,64,3),D(2),X(1),D(1),W(1,57,97,3),D(1),W(1,56,107,1),D(2),W(1,56,64,3),D(2),
-  D(1),W(1,57,107,1),D(1),W(1,56,117,1),D(2),W(1,56,67,1),D(2),W(1,56,97,3),D(1),W(1,57,117,1),
-  D(1),W(1,54,64,3),D(2),D(2),W(1,56,107,1),D(1),X(1),D(1),W(1,54,67,1),D(4),
-  W(1,56,117,1),D(1),D(1),W(1,54,72,1),D(4),X(1),D(2),W(1,54,77,1),D(4),D(2),
-  W(1,54,82,1),W(2,56,64,3),D(2),W(1,54,97,3),D(1),D(3),W(2,56,67,1),D(2),W(1,54,107,1),D(4),
-  W(2,56,72,1),D(2),W(1,54,117,1),D(4),
+  M(1,56,64),D(1),X(1),D(2),M(1,56,97),D(2),W(1,57,107,1),D(2),W(1,57,64,3),D(2),
+  M(1,57,97),D(2),M(1,56,64),D(2),M(1,56,97),D(2),M(1,57,64),D(2),X(1),D(1),
+  M(1,57,97),D(1),W(1,56,107,1),D(2),W(1,56,64,3),D(3),W(1,57,107,1),D(1),M(1,56,117),D(2),
+  M(1,56,67),D(2),W(1,56,97,3),D(1),W(1,57,117,1),D(1),W(1,54,64,3),D(4),W(1,56,107,1),D(1),
+  X(1),D(1),M(1,54,67),D(4),M(1,56,117),D(2),M(1,54,72),D(4),X(1),D(2),
+  M(1,54,77),D(6),M(1,54,82),W(2,56,64,3),D(2),W(1,54,97,3),D(4),W(2,56,67,1),D(2),W(1,54,107,1),
+  D(4),M(2,56,72),D(2),M(1,54,117),D(4),M(2,56,77),D(2),X(1),D(3),W(1,57,64,3),
+  D(1),W(2,56,97,3),D(5),W(1,57,67,1),D(1),W(2,56,107,1),D(5),M(1,57,72),D(1),M(2,56,117),
+  D(5),M(1,57,77),D(1),X(2),D(3),W(2,66,64,3),D(1),W(3,59,64,3),D(1),M(1,57,82),
+  D(1),M(2,66,97),D(4),W(3,59,67,1),D(1),M(1,57,87),D(1),W(2,66,107,1),D(4),M(3,59,72),
+  D(1),W(1,57,97,3),D(1),M(2,66,117),D(4),M(3,59,77),D(1),W(1,57,107,1),D(1),X(2),
+  D(4),W(1,64,64,3),M(3,59,82),D(1),W(1,57,117,1),W(2,61,64,3),
   0
 };
 
 nohop static const byte bwv883f003[] = {
-  W(2,56,77,1),D(2),X(1),D(3),W(1,57,64,3),D(1),W(2,56,97,3),D(2),D(3),W(1,57,67,1),
-  D(1),W(2,56,107,1),D(5),W(1,57,72,1),D(1),W(2,56,117,1),D(5),W(1,57,77,1),D(1),X(2),
-  D(3),W(2,66,64,3),D(1),W(3,59,64,3),D(1),W(1,57,82,1),D(1),W(2,66,97,3),D(1),D(3),
-  W(3,59,67,1),D(1),W(1,57,87,1),D(1),W(2,66,107,1),D(4),W(3,59,72,1),D(1),W(1,57,97,3),D(1),
-  W(2,66,117,1),D(4),W(3,59,77,1),D(1),W(1,57,107,1),D(1),X(2),D(4),W(1,64,64,3),W(3,59,82,1),
-  D(1),W(1,57,117,1),W(2,61,64,3),W(3,59,97,3),D(1),D(3),W(1,64,97,3),D(1),D(1),X(1),
-  W(2,61,67,1),W(3,59,107,1),D(4),W(1,64,107,1),D(2),W(2,61,72,1),W(3,59,117,1),D(2),W(2,61,97,3),D(1),
-  D(1),W(1,64,117,1),D(2),X(3),D(2),W(2,61,107,1),D(2),W(1,61,64,3),D(2),W(1,61,97,3),
-  D(1),D(1),W(2,61,117,1),D(2),D(2),W(1,61,107,1),D(2),X(2),D(4),W(1,61,117,1),
-  D(2),D(4),X(1),D(5),W(1,69,64,3),D(1),D(5),W(1,69,67,1),D(6),W(1,69,72,1),
-  D(6),W(1,69,77,1),D(4),W(2,63,64,3),D(2),W(1,69,82,1),D(3),W(2,63,97,3),D(1),D(2),
+  W(3,59,97,3),D(4),W(1,64,97,3),D(2),X(1),W(2,61,67,1),W(3,59,107,1),D(4),W(1,64,107,1),D(2),
+  M(2,61,72),M(3,59,117),D(2),W(2,61,97,3),D(2),M(1,64,117),D(2),X(3),D(2),W(2,61,107,1),
+  D(2),W(1,61,64,3),D(2),M(1,61,97),D(2),M(2,61,117),D(4),W(1,61,107,1),D(2),X(2),
+  D(4),M(1,61,117),D(6),X(1),D(5),W(1,69,64,3),D(6),W(1,69,67,1),D(6),M(1,69,72),
+  D(6),M(1,69,77),D(4),W(2,63,64,3),D(2),M(1,69,82),D(3),M(2,63,97),D(3),M(1,69,87),
+  D(3),W(2,63,107,1),D(3),M(1,69,92),D(3),M(2,63,117),D(3),M(1,69,97),D(3),X(2),
+  D(2),W(2,64,64,3),D(1),M(1,69,107),D(5),W(2,64,67,1),D(1),M(1,69,117),D(5),M(2,64,72),
+  D(1),X(1),D(5),M(2,64,77),D(3),W(1,69,97,3),D(2),M(1,68,64),D(1),M(2,64,82),
+  D(2),M(1,68,97),D(1),W(1,69,107,1),D(3),M(2,64,87),D(2),W(1,66,64,3),D(1),W(1,69,117,1),
+  D(1),W(1,66,97,3),D(2),M(2,64,92),D(2),W(1,68,117,1),D(1),X(1),D(1),M(1,66,107),
+  D(1),W(2,64,97,3),D(3),X(1),D(1),W(1,68,64,3),D(1),W(1,66,117,1),D(1),W(2,64,107,1),
+  D(4),M(1,68,67),D(1),X(1),D(1),M(2,64,117),D(4),M(1,68,72),D(2),X(2),
   0
 };
 
 nohop static const byte bwv883f004[] = {
-  W(1,69,87,1),D(3),W(2,63,107,1),D(3),W(1,69,92,1),D(3),W(2,63,117,1),D(3),W(1,69,97,1),D(3),
-  X(2),D(2),W(2,64,64,3),D(1),W(1,69,107,1),D(3),D(2),W(2,64,67,1),D(1),W(1,69,117,1),
-  D(5),W(2,64,72,1),D(1),X(1),D(5),W(2,64,77,1),D(3),W(1,69,97,3),D(2),W(1,68,64,3),
-  D(1),W(2,64,82,1),D(2),W(1,68,97,3),D(1),W(1,69,107,1),D(3),W(2,64,87,1),D(2),W(1,66,64,3),
-  D(1),W(1,69,117,1),D(1),W(1,66,97,3),D(1),D(1),W(2,64,92,1),D(2),W(1,68,117,1),D(1),
-  X(1),D(1),W(1,66,107,1),D(1),W(2,64,97,3),D(3),X(1),D(1),W(1,68,64,3),D(1),
-  W(1,66,117,1),D(1),W(2,64,107,1),D(3),D(1),W(1,68,67,1),D(1),X(1),D(1),W(2,64,117,1),
-  D(4),W(1,68,72,1),D(1),D(1),X(2),D(4),W(1,68,77,1),D(2),D(3),W(2,64,64,3),
-  D(1),W(1,68,82,1),D(2),W(2,64,97,3),D(4),W(1,68,87,1),D(2),W(2,64,107,1),D(4),W(1,68,92,1),
-  D(2),W(2,64,117,1),D(4),W(1,68,97,1),D(2),X(2),D(2),W(1,68,97,3),W(2,58,64,3),D(4),
-  D(2),W(1,68,107,1),W(2,58,67,1),D(6),W(1,68,117,1),W(2,58,72,1),D(6),X(1),W(2,58,77,1),D(4),
+  D(4),M(1,68,77),D(5),W(2,64,64,3),D(1),M(1,68,82),D(2),M(2,64,97),D(4),M(1,68,87),
+  D(2),W(2,64,107,1),D(4),M(1,68,92),D(2),M(2,64,117),D(4),M(1,68,97),D(2),X(2),
+  D(2),W(1,68,97,3),W(2,58,64,3),D(6),W(1,68,107,1),W(2,58,67,1),D(6),M(1,68,117),M(2,58,72),D(6),
+  X(1),M(2,58,77),D(4),W(1,73,64,3),D(2),M(1,73,97),M(2,58,82),D(6),W(1,73,107,1),M(2,58,87),
+  D(6),M(1,73,117),M(2,58,92),D(6),X(1),M(2,58,97),D(4),W(1,66,64,3),D(2),M(2,58,107),
+  D(4),W(1,66,67,1),D(2),W(2,58,97,3),D(4),M(1,66,72),D(2),W(2,58,107,1),D(4),M(1,66,77),
+  D(2),M(2,58,117),D(3),W(2,60,64,3),D(1),M(1,66,82),D(2),M(2,60,97),D(4),M(1,66,87),
+  D(2),W(2,60,107,1),D(4),M(1,66,92),D(2),M(2,60,117),D(4),M(1,66,97),D(2),X(2),
+  D(4),M(1,66,107),W(2,61,64,3),D(6),M(1,66,117),W(2,61,67,1),D(6),X(1),M(2,61,72),D(6),
+  M(2,61,77),D(3),W(3,64,64,3),D(3),M(2,61,82),M(3,64,97),D(2),W(1,66,97,3),W(2,61,97,3),D(4),
+  W(3,64,107,1),D(1),M(1,63,64),D(1),W(1,66,107,1),W(2,61,107,1),D(2),W(1,63,97,3),D(2),M(3,64,117),
+  D(2),
   0
 };
 
 nohop static const byte bwv883f005[] = {
-  W(1,73,64,3),D(2),W(1,73,97,3),W(2,58,82,1),D(6),W(1,73,107,1),W(2,58,87,1),D(6),W(1,73,117,1),W(2,58,92,1),
-  D(6),X(1),W(2,58,97,1),D(4),W(1,66,64,3),D(2),W(2,58,107,1),D(4),W(1,66,67,1),D(2),
-  W(2,58,97,3),D(4),W(1,66,72,1),D(2),W(2,58,107,1),D(4),W(1,66,77,1),D(2),W(2,58,117,1),D(3),
-  W(2,60,64,3),D(1),W(1,66,82,1),D(2),W(2,60,97,3),D(4),W(1,66,87,1),D(2),W(2,60,107,1),D(4),
-  W(1,66,92,1),D(2),W(2,60,117,1),D(4),W(1,66,97,1),D(2),X(2),D(4),W(1,66,107,1),W(2,61,64,3),
-  D(2),D(4),W(1,66,117,1),W(2,61,67,1),D(6),X(1),W(2,61,72,1),D(6),W(2,61,77,1),D(3),
-  W(3,64,64,3),D(3),W(2,61,82,1),W(3,64,97,3),D(1),D(1),W(1,66,97,3),W(2,61,97,3),D(1),D(3),
-  W(3,64,107,1),D(1),W(1,63,64,3),D(1),W(1,66,107,1),W(2,61,107,1),D(2),W(1,63,97,3),D(2),W(3,64,117,1),
-  D(2),W(1,66,117,1),W(2,61,117,1),D(2),W(1,63,107,1),D(1),W(1,64,64,3),D(1),X(3),D(2),
-  W(1,64,97,3),X(2),D(1),D(1),W(1,63,117,1),D(2),D(2),W(1,64,107,1),D(2),X(1),
-  D(4),W(1,64,117,1),
+  W(1,66,117,1),M(2,61,117),D(2),M(1,63,107),D(1),W(1,64,64,3),D(1),X(3),D(2),M(1,64,97),
+  X(2),D(2),W(1,63,117,1),D(4),M(1,64,107),D(2),X(1),D(4),M(1,64,117),D(6),
+  X(1),D(1),W(1,61,64,3),D(6),W(1,61,67,1),D(6),M(1,61,72),D(6),M(1,61,77),D(4),
+  W(2,64,64,3),D(2),M(1,61,82),D(1),M(2,64,97),D(2),M(2,63,64),D(3),M(1,61,87),M(2,63,97),
+  D(1),W(2,64,107,1),D(1),W(2,64,64,3),D(1),W(1,61,97,3),D(2),M(2,64,97),D(1),W(2,63,107,1),
+  D(1),M(2,64,117),D(1),M(1,63,64),D(1),W(1,61,107,1),D(2),M(2,64,107),D(1),W(1,63,97,3),
+  M(2,63,117),D(1),M(1,64,64),W(2,60,64,3),D(2),W(1,61,117,1),D(1),W(1,64,97,3),M(2,60,97),D(1),
+  W(2,64,117,1),D(1),M(1,63,64),X(2),D(3),M(1,63,97),D(1),W(1,64,107,1),M(2,60,107),D(1),
+  W(1,58,64,3),W(2,64,64,3),D(1),W(1,63,117,1),D(2),W(1,58,97,3),M(2,64,97),D(1),W(1,63,107,1),D(1),
+  W(1,63,64,3),W(2,60,117,1),D(2),X(1),D(1),M(1,63,97),D(1),W(1,58,107,1),M(2,64,107),D(1),
+  W(1,64,64,3),D(1),X(1),W(2,60,64,3),D(2),M(1,64,97),M(2,60,97),D(1),W(1,63,107,1),D(1),
   0
 };
 
 nohop static const byte bwv883f006[] = {
-  D(2),D(4),X(1),D(1),W(1,61,64,3),D(5),D(1),W(1,61,67,1),D(6),W(1,61,72,1),
-  D(6),W(1,61,77,1),D(4),W(2,64,64,3),D(2),W(1,61,82,1),D(1),W(2,64,97,3),D(1),D(1),
-  W(2,63,64,3),D(3),W(1,61,87,1),W(2,63,97,3),D(1),W(2,64,107,1),D(1),W(2,64,64,3),D(1),W(1,61,97,3),
-  D(2),W(2,64,97,3),D(1),W(2,63,107,1),D(1),W(2,64,117,1),D(1),W(1,63,64,3),D(1),W(1,61,107,1),
-  D(2),W(2,64,107,1),D(1),W(1,63,97,3),W(2,63,117,1),D(1),W(1,64,64,3),W(2,60,64,3),D(2),W(1,61,117,1),
-  D(1),W(1,64,97,3),W(2,60,97,3),D(1),W(2,64,117,1),D(1),W(1,63,64,3),X(2),D(1),D(2),
-  W(1,63,97,3),D(1),W(1,64,107,1),W(2,60,107,1),D(1),W(1,58,64,3),W(2,64,64,3),D(1),W(1,63,117,1),D(2),
-  W(1,58,97,3),W(2,64,97,3),D(1),W(1,63,107,1),D(1),W(1,63,64,3),W(2,60,117,1),D(1),D(1),X(1),
-  D(1),W(1,63,97,3),D(1),W(1,58,107,1),W(2,64,107,1),D(1),W(1,64,64,3),D(1),X(1),W(2,60,64,3),
-  D(2),W(1,64,97,3),W(2,60,97,3),D(1),W(1,63,107,1),D(1),W(1,63,64,3),W(2,64,117,1),D(1),X(1),
-  D(1),D(1),
+  W(1,63,64,3),W(2,64,117,1),D(1),X(1),D(2),M(1,63,97),D(1),W(1,64,107,1),M(2,60,107),D(1),
+  W(1,64,64,3),D(1),X(1),X(2),D(2),M(1,64,97),D(1),M(1,63,64),D(1),W(1,64,117,1),
+  M(2,60,117),D(1),X(1),D(2),W(1,63,97,3),D(1),M(1,64,64),W(2,56,64,3),D(1),W(1,63,117,1),
+  D(1),X(1),X(2),D(1),W(1,64,97,3),M(2,56,97),D(1),M(1,63,64),D(1),W(1,63,107,1),
+  D(1),M(1,64,117),D(1),W(1,63,97,3),D(2),M(1,64,64),W(2,56,107,1),D(2),W(1,63,117,1),D(1),
+  W(1,64,97,3),D(1),W(1,63,107,1),D(1),W(1,63,64,3),D(1),W(1,64,117,1),M(2,56,117),D(2),X(1),
+  D(1),W(1,63,97,3),D(1),W(1,63,117,1),D(2),X(1),X(2),D(3),M(1,63,107),D(1),
+  X(1),D(1),W(1,64,64,3),W(2,61,64,3),D(4),W(1,63,117,1),D(2),M(1,64,67),W(2,61,67,1),D(4),
+  X(1),D(2),M(1,64,72),M(2,61,72),D(3),W(2,61,97,3),D(3),M(1,64,77),D(3),W(2,61,107,1),
+  D(3),M(1,64,82),W(2,73,64,3),D(2),M(2,73,97),D(1),W(2,61,117,1),D(3),M(1,64,87),D(2),
+  M(2,73,107),D(1),X(2),D(3),M(1,64,92),D(2),M(2,73,117),D(4),W(1,64,97,3),D(2),
+  X(2),D(4),M(1,66,64),D(6),W(1,66,67,1),D(6),
   0
 };
 
 nohop static const byte bwv883f007[] = {
-  W(1,63,97,3),D(1),W(1,64,107,1),W(2,60,107,1),D(1),W(1,64,64,3),D(1),X(1),X(2),D(1),
-  D(1),W(1,64,97,3),D(1),W(1,63,64,3),D(1),W(1,64,117,1),W(2,60,117,1),D(1),X(1),D(1),
-  D(1),W(1,63,97,3),D(1),W(1,64,64,3),W(2,56,64,3),D(1),W(1,63,117,1),D(1),X(1),X(2),
-  D(1),W(1,64,97,3),W(2,56,97,3),D(1),W(1,63,64,3),D(1),W(1,63,107,1),D(1),W(1,64,117,1),D(1),
-  W(1,63,97,3),D(1),D(1),W(1,64,64,3),W(2,56,107,1),D(2),W(1,63,117,1),D(1),W(1,64,97,3),D(1),
-  W(1,63,107,1),D(1),W(1,63,64,3),D(1),W(1,64,117,1),W(2,56,117,1),D(2),X(1),D(1),W(1,63,97,3),
-  D(1),W(1,63,117,1),D(2),X(1),X(2),D(2),D(1),W(1,63,107,1),D(1),X(1),
-  D(1),W(1,64,64,3),W(2,61,64,3),D(1),D(3),W(1,63,117,1),D(1),D(1),W(1,64,67,1),W(2,61,67,1),
-  D(4),X(1),D(2),W(1,64,72,1),W(2,61,72,1),D(3),W(2,61,97,3),D(1),D(2),W(1,64,77,1),
-  D(3),W(2,61,107,1),D(3),W(1,64,82,1),W(2,73,64,3),D(2),W(2,73,97,3),D(1),W(2,61,117,1),D(3),
-  W(1,64,87,1),D(2),W(2,73,107,1),D(1),X(2),D(3),W(1,64,92,1),D(2),
+  M(1,66,72),D(6),M(1,66,77),D(5),W(2,57,64,3),D(1),M(1,66,82),D(3),M(2,57,97),D(3),
+  M(1,66,87),D(3),W(2,57,107,1),D(3),M(1,66,92),D(3),M(2,57,117),D(3),M(1,66,97),D(3),
+  X(2),D(1),W(2,62,64,3),D(2),M(1,66,107),D(4),W(2,62,67,1),D(2),M(1,66,117),D(2),
+  W(1,66,97,3),D(2),M(2,62,72),D(4),W(1,66,107,1),D(2),M(2,62,77),D(4),W(1,71,64,3),D(2),
+  M(1,71,97),M(2,62,82),D(4),X(1),D(2),W(1,71,107,1),M(2,62,87),D(6),M(1,71,117),M(2,62,92),
+  D(6),X(1),M(2,62,97),D(3),W(1,64,64,3),D(3),W(2,62,97,3),D(3),W(1,64,67,1),D(3),
+  W(2,62,107,1),D(3),M(1,64,72),D(3),M(2,62,117),D(3),M(1,64,77),D(3),X(2),D(2),
+  W(2,56,64,3),D(1),M(1,64,82),D(2),M(2,56,97),D(4),M(1,64,87),D(2),W(2,56,107,1),D(4),
+  M(1,64,92),D(2),M(2,56,117),D(4),M(1,64,97),D(2),X(2),D(3),W(2,61,64,3),D(1),
+  W(1,64,97,3),D(5),W(2,61,67,1),D(1),W(1,64,107,1),D(5),M(2,61,72),D(1),M(1,64,117),D(5),
+  M(2,61,77),D(1),X(1),D(3),W(1,69,64,3),D(2),M(2,61,82),D(4),W(1,69,67,1),D(2),
+  M(2,61,87),D(4),M(1,69,72),D(2),M(2,61,92),D(4),M(1,69,77),D(2),
   0
 };
 
 nohop static const byte bwv883f008[] = {
-  W(2,73,117,1),D(1),D(3),W(1,64,97,3),D(2),X(2),D(4),W(1,66,64,3),D(2),D(4),
-  W(1,66,67,1),D(6),W(1,66,72,1),D(6),W(1,66,77,1),D(5),W(2,57,64,3),D(1),W(1,66,82,1),D(3),
-  W(2,57,97,3),D(3),W(1,66,87,1),D(3),W(2,57,107,1),D(3),W(1,66,92,1),D(3),W(2,57,117,1),D(3),
-  W(1,66,97,1),D(3),X(2),D(1),W(2,62,64,3),D(2),W(1,66,107,1),D(3),D(1),W(2,62,67,1),
-  D(2),W(1,66,117,1),D(2),W(1,66,97,3),D(1),D(1),W(2,62,72,1),D(4),W(1,66,107,1),D(2),
-  W(2,62,77,1),D(4),W(1,71,64,3),D(2),W(1,71,97,3),W(2,62,82,1),D(1),D(3),X(1),D(2),
-  W(1,71,107,1),W(2,62,87,1),D(4),D(2),W(1,71,117,1),W(2,62,92,1),D(6),X(1),W(2,62,97,1),D(3),
-  W(1,64,64,3),D(3),W(2,62,97,3),D(3),W(1,64,67,1),D(3),W(2,62,107,1),D(3),W(1,64,72,1),D(3),
-  W(2,62,117,1),D(3),W(1,64,77,1),D(3),X(2),D(2),W(2,56,64,3),D(1),W(1,64,82,1),D(2),
-  W(2,56,97,3),D(1),D(3),W(1,64,87,1),D(2),W(2,56,107,1),D(4),W(1,64,92,1),D(2),W(2,56,117,1),
-  D(4),W(1,64,97,1),D(2),X(2),D(3),W(2,61,64,3),D(1),W(1,64,97,3),
+  M(2,61,97),D(4),M(1,69,82),W(3,59,64,3),D(2),M(2,61,107),D(4),M(1,69,87),W(3,59,67,1),D(1),
+  W(2,61,97,3),D(5),M(1,69,92),M(3,59,72),D(1),W(2,61,107,1),D(5),M(1,69,97),M(3,59,77),D(1),
+  M(2,61,117),D(3),W(2,68,64,3),D(2),W(1,69,97,3),M(3,59,82),D(1),X(2),D(3),W(2,68,67,1),
+  D(2),W(1,69,107,1),M(3,59,87),D(4),M(2,68,72),D(2),M(1,69,117),M(3,59,92),D(4),M(2,68,77),
+  D(2),X(1),M(3,59,97),D(3),W(1,57,64,3),D(1),M(2,68,82),D(2),M(3,59,107),D(3),
+  W(1,57,67,1),W(3,59,97,3),D(1),M(2,68,87),D(5),M(1,57,72),W(3,59,107,1),D(1),M(2,68,92),D(5),
+  M(1,57,77),M(3,59,117),D(1),M(2,68,97),D(3),W(3,66,64,3),D(2),M(1,57,82),X(3),D(1),
+  W(2,68,97,3),D(3),W(3,66,67,1),D(2),M(1,57,87),D(1),W(2,68,107,1),D(3),M(3,66,72),D(2),
+  M(1,57,92),D(1),M(2,68,117),D(3),M(3,66,77),D(2),M(1,57,97),D(1),X(2),D(3),
+  W(1,57,97,3),W(2,56,64,3),M(3,66,82),D(6),W(1,57,107,1),W(2,56,67,1),M(3,66,87),D(6),M(1,57,117),M(2,56,72),
+  M(3,66,92),D(6),X(1),M(2,56,77),M(3,66,97),D(4),W(1,49,64,3),
   0
 };
 
 nohop static const byte bwv883f009[] = {
-  D(1),D(1),D(3),W(2,61,67,1),D(1),W(1,64,107,1),D(5),W(2,61,72,1),D(1),W(1,64,117,1),
-  D(5),W(2,61,77,1),D(1),X(1),D(3),W(1,69,64,3),D(2),W(2,61,82,1),D(1),D(3),
-  W(1,69,67,1),D(2),W(2,61,87,1),D(4),W(1,69,72,1),D(2),W(2,61,92,1),D(4),W(1,69,77,1),D(2),
-  W(2,61,97,1),D(4),W(1,69,82,1),W(3,59,64,3),D(2),W(2,61,107,1),D(4),W(1,69,87,1),W(3,59,67,1),D(1),
-  W(2,61,97,3),D(1),D(4),W(1,69,92,1),W(3,59,72,1),D(1),W(2,61,107,1),D(5),W(1,69,97,1),W(3,59,77,1),
-  D(1),W(2,61,117,1),D(3),W(2,68,64,3),D(2),W(1,69,97,3),W(3,59,82,1),D(1),X(2),D(3),
-  W(2,68,67,1),D(2),W(1,69,107,1),W(3,59,87,1),D(1),D(3),W(2,68,72,1),D(2),W(1,69,117,1),W(3,59,92,1),
-  D(4),W(2,68,77,1),D(2),X(1),W(3,59,97,1),D(3),W(1,57,64,3),D(1),W(2,68,82,1),D(2),
-  W(3,59,107,1),D(3),W(1,57,67,1),W(3,59,97,3),D(1),W(2,68,87,1),D(5),W(1,57,72,1),W(3,59,107,1),D(1),
-  W(2,68,92,1),D(5),W(1,57,77,1),W(3,59,117,1),D(1),W(2,68,97,1),D(3),W(3,66,64,3),D(2),
+  W(4,65,64,3),D(1),W(2,56,97,3),D(1),M(1,49,97),M(3,66,107),D(2),W(3,66,97,3),D(2),W(4,65,67,1),
+  D(1),W(2,56,107,1),D(1),W(1,49,107,1),D(2),W(3,66,107,1),D(2),M(4,65,72),D(1),M(2,56,117),
+  D(1),M(1,49,117),D(2),M(3,66,117),D(2),M(4,65,77),D(1),X(2),D(1),X(1),
+  D(2),X(3),D(1),W(4,65,97,3),D(1),W(1,54,64,3),W(2,45,64,3),D(4),M(2,45,97),D(1),
+  W(4,65,107,1),D(1),W(1,54,67,1),D(4),W(2,45,107,1),D(1),M(4,65,117),D(1),M(1,54,72),D(4),
+  M(2,45,117),D(1),X(4),D(1),M(1,54,77),D(4),X(2),D(1),W(2,42,64,3),D(1),
+  M(1,54,82),D(2),M(2,42,97),D(4),M(1,54,87),D(2),W(2,42,107,1),D(4),M(1,54,92),D(2),
+  M(2,42,117),D(4),M(1,54,97),D(2),X(2),D(1),W(1,54,97,3),D(2),M(1,50,64),D(4),
+  W(1,54,107,1),D(2),M(1,50,67),D(4),M(1,54,117),D(2),M(1,50,72),D(4),X(1),D(2),
+  M(1,50,77),D(4),W(2,71,64,3),D(2),M(1,50,82),D(1),M(2,71,97),D(5),M(1,50,87),D(1),
+  W(2,71,107,1),D(5),M(1,50,92),D(1),M(2,71,117),D(5),M(1,50,97),D(1),X(2),D(3),
+  W(2,68,64,3),D(2),M(1,50,107),D(1),M(2,68,97),D(5),M(1,50,117),D(1),W(2,68,107,1),D(5),
+  X(1),D(1),
   0
 };
 
 nohop static const byte bwv883f010[] = {
-  W(1,57,82,1),X(3),D(1),W(2,68,97,3),D(3),W(3,66,67,1),D(2),W(1,57,87,1),D(1),W(2,68,107,1),
-  D(3),W(3,66,72,1),D(2),W(1,57,92,1),D(1),W(2,68,117,1),D(3),W(3,66,77,1),D(2),W(1,57,97,1),
-  D(1),X(2),D(3),W(1,57,97,3),W(2,56,64,3),W(3,66,82,1),D(1),D(2),D(3),W(1,57,107,1),
-  W(2,56,67,1),W(3,66,87,1),D(6),W(1,57,117,1),W(2,56,72,1),W(3,66,92,1),D(6),X(1),W(2,56,77,1),W(3,66,97,1),
-  D(4),W(1,49,64,3),W(4,65,64,3),D(1),W(2,56,97,3),D(1),W(1,49,97,3),W(3,66,107,1),D(1),D(1),
-  W(3,66,97,3),D(2),W(4,65,67,1),D(1),W(2,56,107,1),D(1),W(1,49,107,1),D(2),W(3,66,107,1),D(2),
-  W(4,65,72,1),D(1),W(2,56,117,1),D(1),W(1,49,117,1),D(2),W(3,66,117,1),D(2),W(4,65,77,1),D(1),
-  X(2),D(1),X(1),D(2),X(3),D(1),W(4,65,97,3),D(1),W(1,54,64,3),W(2,45,64,3),
-  D(1),D(1),D(2),W(2,45,97,3),D(1),W(4,65,107,1),D(1),W(1,54,67,1),D(4),W(2,45,107,1),
-  D(1),W(4,65,117,1),D(1),W(1,54,72,1),D(4),W(2,45,117,1),D(1),X(4),D(1),W(1,54,77,1),
-  D(4),X(2),D(1),W(2,42,64,3),D(1),
+  M(2,68,117),D(4),W(1,50,97,3),D(2),M(1,64,64),X(2),D(1),W(2,49,64,3),D(1),M(1,64,97),
+  D(1),M(2,49,97),D(1),W(1,50,107,1),D(4),N(1,64),D(1),W(1,47,64,3),W(2,49,107,1),D(1),
+  W(1,50,117,1),D(2),W(1,47,97,3),D(2),W(1,64,117,1),D(1),M(2,49,117),D(1),X(1),D(2),
+  M(1,47,107),D(2),X(1),D(1),X(2),D(1),W(1,49,64,3),W(2,52,64,3),D(2),W(1,47,117,1),
+  D(4),M(1,49,67),W(2,52,67,1),D(2),X(1),D(3),W(2,52,97,3),D(1),M(1,49,72),D(5),
+  W(2,52,107,1),D(1),M(1,49,77),D(4),W(2,69,64,3),D(1),W(2,52,117,1),D(1),M(1,49,82),D(1),
+  W(2,69,97,3),D(4),X(2),D(1),M(1,49,87),D(1),W(2,69,107,1),D(5),M(1,49,92),D(1),
+  M(2,69,117),D(5),M(1,49,97),D(1),X(2),D(4),W(2,66,64,3),W(3,57,64,3),D(1),M(1,49,107),
+  D(3),M(2,66,97),D(2),W(3,57,67,1),D(1),M(1,49,117),D(3),W(2,66,107,1),D(2),W(1,49,97,3),
+  M(3,57,72),D(4),M(2,66,117),D(2),W(1,49,107,1),M(3,57,77),D(4),W(1,54,64,3),W(2,63,64,3),D(2),
+  W(1,49,117,1),M(3,57,82),D(1),M(2,63,97),D(2),W(3,57,97,3),D(1),W(1,54,97,3),D(2),X(1),
+  D(1),W(2,63,107,1),D(2),
   0
 };
 
 nohop static const byte bwv883f011[] = {
-  W(1,54,82,1),D(2),W(2,42,97,3),D(1),D(1),D(2),W(1,54,87,1),D(2),W(2,42,107,1),D(4),
-  W(1,54,92,1),D(2),W(2,42,117,1),D(4),W(1,54,97,1),D(2),X(2),D(1),W(1,54,97,3),D(1),
-  D(1),W(1,50,64,3),D(3),D(1),W(1,54,107,1),D(2),W(1,50,67,1),D(4),W(1,54,117,1),D(2),
-  W(1,50,72,1),D(4),X(1),D(2),W(1,50,77,1),D(4),W(2,71,64,3),D(2),W(1,50,82,1),D(1),
-  W(2,71,97,3),D(1),D(4),W(1,50,87,1),D(1),W(2,71,107,1),D(5),W(1,50,92,1),D(1),W(2,71,117,1),
-  D(5),W(1,50,97,1),D(1),X(2),D(3),W(2,68,64,3),D(2),W(1,50,107,1),D(1),W(2,68,97,3),
-  D(5),W(1,50,117,1),D(1),W(2,68,107,1),D(5),X(1),D(1),W(2,68,117,1),D(4),W(1,50,97,3),
-  D(2),W(1,64,64,3),X(2),D(1),W(2,49,64,3),D(1),W(1,64,97,3),D(1),W(2,49,97,3),D(1),
-  W(1,50,107,1),D(2),D(2),W(1,64,107,1),D(1),W(1,47,64,3),W(2,49,107,1),D(1),W(1,50,117,1),D(2),
-  W(1,47,97,3),D(1),D(1),W(1,64,117,1),D(1),W(2,49,117,1),D(1),X(1),D(2),W(1,47,107,1),
-  D(2),X(1),D(1),X(2),D(1),W(1,49,64,3),W(2,52,64,3),D(2),W(1,47,117,1),D(2),
-  D(1),D(1),
+  W(3,57,107,1),D(1),W(1,54,107,1),D(3),M(2,63,117),D(2),M(3,57,117),D(1),M(1,54,117),D(3),
+  X(2),D(2),X(3),D(1),W(1,47,64,3),W(2,62,64,3),W(3,59,92,3),D(6),W(1,47,67,1),W(2,62,67,1),
+  D(1),W(1,47,84,3),D(5),W(1,47,72,1),M(2,62,72),D(6),M(1,47,77),M(2,62,77),D(4),W(1,47,84,3),
+  W(2,62,97,3),M(3,68,64),D(1),M(2,59,64),D(1),W(1,47,82,1),D(1),M(3,68,97),D(3),W(2,62,107,1),
+  D(1),M(2,59,67),D(1),M(1,47,87),D(1),W(3,68,107,1),D(3),M(2,62,117),D(1),M(2,59,72),
+  D(1),M(1,47,92),D(1),M(3,68,117),D(3),X(2),D(1),M(2,59,77),D(1),M(1,47,97),
+  D(1),X(3),D(2),W(2,59,97,3),D(1),M(2,65,64),W(3,56,64,3),D(2),M(1,47,107),D(3),
+  W(2,59,107,1),D(1),W(2,65,97,3),W(3,56,67,1),D(2),M(1,47,117),D(3),W(2,59,117,1),D(1),W(1,47,84,3),
+  M(2,65,107),M(3,56,72),D(2),X(1),D(3),X(2),D(1),N(1,47),M(2,65,117),M(3,56,77),
+  D(3),W(2,45,64,3),W(4,61,64,3),D(1),M(1,47,97),D(1),W(3,56,97,3),D(1),X(2),D(3),
+  W(2,45,67,1),W(4,61,67,1),D(1),W(1,47,107,1),W(2,45,97,3),D(1),W(3,56,107,1),D(1),
   0
 };
 
 nohop static const byte bwv883f012[] = {
-  W(1,49,67,1),W(2,52,67,1),D(2),X(1),D(3),W(2,52,97,3),D(1),W(1,49,72,1),D(2),D(3),
-  W(2,52,107,1),D(1),W(1,49,77,1),D(4),W(2,69,64,3),D(1),W(2,52,117,1),D(1),W(1,49,82,1),D(1),
-  W(2,69,97,3),D(4),X(2),D(1),W(1,49,87,1),D(1),W(2,69,107,1),D(4),D(1),W(1,49,92,1),
-  D(1),W(2,69,117,1),D(5),W(1,49,97,1),D(1),X(2),D(4),W(2,66,64,3),W(3,57,64,3),D(1),
-  W(1,49,107,1),D(1),D(2),W(2,66,97,3),D(2),W(3,57,67,1),D(1),W(1,49,117,1),D(3),W(2,66,107,1),
-  D(2),W(1,49,97,3),W(3,57,72,1),D(4),W(2,66,117,1),D(2),W(1,49,107,1),W(3,57,77,1),D(4),W(1,54,64,3),
-  W(2,63,64,3),D(2),W(1,49,117,1),W(3,57,82,1),D(1),W(2,63,97,3),D(2),W(3,57,97,3),D(1),W(1,54,97,3),
-  D(2),X(1),D(1),W(2,63,107,1),D(2),W(3,57,107,1),D(1),W(1,54,107,1),D(2),D(1),
-  W(2,63,117,1),D(2),W(3,57,117,1),D(1),W(1,54,117,1),D(3),X(2),D(2),X(3),D(1),
-  W(1,47,64,3),W(2,62,64,3),W(3,59,92,3),D(1),D(2),D(2),D(1),W(1,47,67,1),W(2,62,67,1),D(1),
-  W(1,47,84,3),D(5),W(1,47,72,1),W(2,62,72,1),D(6),
+  W(1,44,64,3),D(2),M(1,44,97),D(1),W(4,61,97,3),D(1),W(1,47,117,1),W(2,45,107,1),D(1),M(3,56,117),
+  D(3),M(1,44,107),D(1),W(4,61,107,1),D(1),X(1),M(2,45,117),D(1),X(3),D(1),
+  W(1,57,64,3),W(2,45,64,3),W(3,66,64,3),D(2),W(1,44,117,1),D(1),M(2,45,97),M(4,61,117),D(1),X(2),
+  D(2),M(1,57,67),W(3,66,67,1),D(1),W(1,57,97,3),D(1),X(1),D(1),W(2,45,107,1),X(4),
+  D(3),M(3,66,72),D(1),W(1,57,107,1),D(2),M(2,45,117),D(3),M(3,66,77),D(1),M(1,57,117),
+  D(2),W(1,42,64,3),X(2),D(1),W(2,57,64,3),D(1),M(1,42,97),D(1),M(3,66,82),D(1),
+  X(1),D(3),M(2,57,97),D(1),W(1,42,107,1),D(1),M(3,66,87),D(4),W(2,57,107,1),D(1),
+  M(1,42,117),D(1),M(3,66,92),D(4),M(2,57,117),D(1),X(1),D(1),M(3,66,97),D(1),
+  W(1,59,64,3),W(2,45,64,3),D(3),M(1,59,97),X(2),D(2),M(2,45,97),M(3,66,107),D(2),M(1,44,64),
+  D(2),W(1,59,107,1),D(2),W(2,45,107,1),M(3,66,117),D(1),W(1,44,97,3),D(1),M(1,45,64),D(2),
+  W(1,59,117,1),D(2),M(2,45,117),X(3),D(1),M(1,44,107),W(2,44,64,3),D(1),M(1,45,67),D(2),
+  X(1),M(2,44,97),D(2),W(1,62,64,3),X(2),D(1),
   0
 };
 
 nohop static const byte bwv883f013[] = {
-  W(1,47,77,1),W(2,62,77,1),D(4),W(1,47,84,3),W(2,62,97,3),W(3,68,64,3),D(1),W(2,59,64,3),D(1),W(1,47,82,1),
-  D(1),W(3,68,97,3),D(1),D(2),W(2,62,107,1),D(1),W(2,59,67,1),D(1),W(1,47,87,1),D(1),
-  W(3,68,107,1),D(3),W(2,62,117,1),D(1),W(2,59,72,1),D(1),W(1,47,92,1),D(1),W(3,68,117,1),D(3),
-  X(2),D(1),W(2,59,77,1),D(1),W(1,47,97,1),D(1),X(3),D(2),W(2,59,97,3),D(1),
-  W(2,65,64,3),W(3,56,64,3),D(2),W(1,47,107,1),D(1),D(2),W(2,59,107,1),D(1),W(2,65,97,3),W(3,56,67,1),
-  D(2),W(1,47,117,1),D(3),W(2,59,117,1),D(1),W(1,47,84,3),W(2,65,107,1),W(3,56,72,1),D(2),X(1),
-  D(3),X(2),D(1),W(1,47,84,3),W(2,65,117,1),W(3,56,77,1),D(3),W(2,45,64,3),W(4,61,64,3),D(1),
-  W(1,47,97,3),D(1),W(3,56,97,3),D(1),X(2),D(3),W(2,45,67,1),W(4,61,67,1),D(1),W(1,47,107,1),
-  W(2,45,97,3),D(1),W(3,56,107,1),D(1),W(1,44,64,3),D(2),W(1,44,97,3),D(1),W(4,61,97,3),D(1),
-  W(1,47,117,1),W(2,45,107,1),D(1),W(3,56,117,1),D(3),W(1,44,107,1),D(1),W(4,61,107,1),D(1),
+  W(1,44,117,1),M(2,45,64),D(1),W(1,62,97,3),D(2),W(2,44,107,1),D(2),W(1,45,107,1),D(1),W(1,44,64,3),
+  M(2,45,67),D(1),W(1,62,107,1),D(2),M(2,44,117),D(1),W(1,44,97,3),W(2,45,97,3),D(1),M(1,45,64),
+  D(2),W(1,62,117,1),D(2),X(2),D(1),M(1,44,107),W(2,45,107,1),D(1),M(1,45,67),W(2,44,64,3),
+  D(2),X(1),W(3,66,97,3),D(2),M(3,65,64),D(1),W(1,45,97,3),W(2,45,117,1),D(1),M(1,45,64),
+  M(2,44,67),D(2),W(3,66,107,1),D(1),W(2,44,97,3),D(1),M(3,65,67),D(1),M(1,45,97),X(2),
+  D(3),M(1,44,64),M(3,66,117),D(1),W(2,44,107,1),D(1),M(3,65,72),D(1),W(1,45,107,1),D(2),
+  W(2,45,64,3),D(1),M(1,44,67),X(3),D(1),W(2,44,117,1),D(1),W(1,44,97,3),M(3,65,77),D(1),
+  M(1,44,64),D(2),M(2,45,67),W(4,56,64,3),D(2),X(2),M(4,56,97),D(1),W(1,44,107,1),W(2,45,64,3),
+  M(3,65,82),D(1),M(1,44,67),D(3),W(1,44,97,3),D(1),W(4,56,107,1),D(1),M(1,44,64),W(2,45,67,1),
+  M(3,65,87),D(4),W(1,44,107,1),W(2,45,97,3),D(1),M(4,56,117),D(1),M(1,44,67),W(2,45,117,1),M(3,65,92),
+  D(4),M(1,44,117),M(2,45,107),
   0
 };
 
 nohop static const byte bwv883f014[] = {
-  X(1),W(2,45,117,1),D(1),X(3),D(1),W(1,57,64,3),W(2,45,64,3),W(3,66,64,3),D(2),W(1,44,117,1),
-  D(1),W(2,45,97,3),W(4,61,117,1),D(1),X(2),D(1),D(1),W(1,57,67,1),W(3,66,67,1),D(1),
-  W(1,57,97,3),D(1),X(1),D(1),W(2,45,107,1),X(4),D(1),D(2),W(3,66,72,1),D(1),
-  W(1,57,107,1),D(1),D(1),W(2,45,117,1),D(3),W(3,66,77,1),D(1),W(1,57,117,1),D(2),W(1,42,64,3),
-  X(2),D(1),W(2,57,64,3),D(1),W(1,42,97,3),D(1),W(3,66,82,1),D(1),X(1),D(2),
-  D(1),W(2,57,97,3),D(1),W(1,42,107,1),D(1),W(3,66,87,1),D(1),D(3),W(2,57,107,1),D(1),
-  W(1,42,117,1),D(1),W(3,66,92,1),D(4),W(2,57,117,1),D(1),X(1),D(1),W(3,66,97,1),D(1),
-  W(1,59,64,3),W(2,45,64,3),D(3),W(1,59,97,3),X(2),D(1),D(1),W(2,45,97,3),W(3,66,107,1),D(1),
-  D(1),W(1,44,64,3),D(2),W(1,59,107,1),D(2),W(2,45,107,1),W(3,66,117,1),D(1),W(1,44,97,3),D(1),
-  W(1,45,64,3),D(2),W(1,59,117,1),D(2),W(2,45,117,1),X(3),D(1),W(1,44,107,1),W(2,44,64,3),D(1),
-  W(1,45,67,1),D(2),X(1),W(2,44,97,3),D(1),D(1),W(1,62,64,3),X(2),D(1),
+  D(1),X(4),D(1),M(1,44,72),X(2),M(3,65,97),D(2),W(2,66,64,3),W(3,42,64,3),W(4,57,64,3),
+  D(1),W(1,44,97,3),D(1),X(1),W(2,45,117,1),D(1),M(3,65,97),D(2),M(4,57,97),D(1),
+  W(2,66,97,3),W(3,42,67,1),D(1),W(1,44,107,1),D(1),X(2),D(1),M(3,65,107),D(2),W(4,57,107,1),
+  D(1),W(2,66,107,1),M(3,42,72),D(1),M(1,44,117),D(2),M(3,65,117),D(2),M(4,57,117),D(1),
+  M(2,66,117),M(3,42,77),D(1),X(1),D(1),W(3,42,97,3),D(1),X(3),D(2),X(4),
+  D(1),X(2),D(1),W(1,69,64,3),D(1),W(2,61,64,3),W(3,42,107,1),D(4),M(2,61,97),D(1),
+  W(1,69,67,1),D(1),M(3,42,117),D(4),W(2,61,107,1),D(1),M(1,69,72),D(1),X(3),D(4),
+  M(2,61,117),D(1),M(1,69,77),D(5),X(2),D(1),M(1,69,82),W(2,71,64,3),D(1),W(1,69,97,3),
+  D(1),M(1,50,64),D(4),W(2,71,67,1),D(1),W(1,69,107,1),D(1),M(1,50,67),D(4),M(2,71,72),
+  D(1),M(1,69,117),D(1),M(1,50,72),D(4),M(2,71,77),D(1),X(1),D(1),M(1,50,77),
+  D(3),W(3,54,64,3),D(1),M(2,71,82),W(4,74,64,3),D(2),M(1,50,82),M(3,54,97),D(1),W(2,71,97,3),
+  D(3),W(4,74,67,1),D(2),M(1,50,87),W(3,54,107,1),D(1),
   0
 };
 
 nohop static const byte bwv883f015[] = {
-  W(1,44,117,1),W(2,45,64,3),D(1),W(1,62,97,3),D(1),D(1),W(2,44,107,1),D(2),W(1,45,107,1),D(1),
-  W(1,44,64,3),W(2,45,67,1),D(1),W(1,62,107,1),D(2),W(2,44,117,1),D(1),W(1,44,97,3),W(2,45,97,3),D(1),
-  W(1,45,64,3),D(1),D(1),W(1,62,117,1),D(2),X(2),D(1),W(1,44,107,1),W(2,45,107,1),D(1),
-  W(1,45,67,1),W(2,44,64,3),D(2),X(1),W(3,66,97,3),D(1),D(1),W(3,65,64,3),D(1),W(1,45,97,3),
-  W(2,45,117,1),D(1),W(1,45,64,3),W(2,44,67,1),D(2),W(3,66,107,1),D(1),W(2,44,97,3),D(1),W(3,65,67,1),
-  D(1),W(1,45,97,3),X(2),D(1),D(2),W(1,44,64,3),W(3,66,117,1),D(1),W(2,44,107,1),D(1),
-  W(3,65,72,1),D(1),W(1,45,107,1),D(2),W(2,45,64,3),D(1),W(1,44,67,1),X(3),D(1),W(2,44,117,1),
-  D(1),W(1,44,97,3),W(3,65,77,1),D(1),W(1,44,64,3),D(2),W(2,45,67,1),W(4,56,64,3),D(1),D(1),
-  X(2),W(4,56,97,3),D(1),W(1,44,107,1),W(2,45,64,3),W(3,65,82,1),D(1),W(1,44,67,1),D(3),W(1,44,97,3),
-  D(1),W(4,56,107,1),D(1),W(1,44,64,3),W(2,45,67,1),W(3,65,87,1),D(1),D(3),
+  W(2,71,107,1),D(3),M(4,74,72),D(2),M(1,50,92),M(3,54,117),D(1),M(2,71,117),D(3),M(4,74,77),
+  D(2),M(1,50,97),X(3),D(1),X(2),D(1),W(2,56,64,3),D(2),W(4,74,97,3),D(2),
+  M(1,50,107),D(1),M(2,56,97),D(3),W(4,74,107,1),D(2),M(1,50,117),D(1),W(2,56,107,1),D(3),
+  M(4,74,117),D(2),X(1),D(1),M(2,56,117),D(3),X(4),D(2),W(2,68,64,3),D(1),
+  X(2),D(1),W(3,59,64,3),D(4),W(2,68,67,1),D(2),W(3,59,67,1),D(2),W(3,59,97,3),D(2),
+  M(2,68,72),D(1),W(1,50,97,3),D(3),W(3,59,107,1),D(2),M(2,68,77),D(1),W(1,50,107,1),D(3),
+  M(3,59,117),D(2),W(1,69,64,3),M(2,68,82),D(1),W(1,50,117,1),D(2),W(3,49,64,3),D(1),X(3),
+  D(1),W(2,68,97,3),D(1),M(1,69,67),D(1),X(1),D(2),W(3,49,67,1),D(2),W(2,68,107,1),
+  D(1),M(1,69,72),D(3),M(3,49,72),D(2),M(2,68,117),D(1),M(1,69,77),D(3),M(3,49,77),
+  D(1),W(1,69,97,3),D(1),M(1,57,64),W(2,73,64,3),D(4),M(3,49,82),D(1),W(1,69,107,1),D(1),
+  W(1,57,97,3),W(2,73,67,1),D(4),M(3,49,87),D(1),W(1,69,117,1),D(1),M(1,57,107),M(2,73,72),D(4),
+  M(3,49,92),D(1),X(1),D(1),M(1,57,117),M(2,73,77),
   0
 };
 
 nohop static const byte bwv883f016[] = {
-  W(1,44,107,1),W(2,45,97,3),D(1),W(4,56,117,1),D(1),W(1,44,67,1),W(2,45,117,1),W(3,65,92,1),D(4),W(1,44,117,1),
-  W(2,45,107,1),D(1),X(4),D(1),W(1,44,72,1),X(2),W(3,65,97,1),D(2),W(2,66,64,3),W(3,42,64,3),
-  W(4,57,64,3),D(1),W(1,44,97,3),D(1),X(1),W(2,45,117,1),D(1),W(3,65,97,3),D(1),D(1),
-  W(4,57,97,3),D(1),W(2,66,97,3),W(3,42,67,1),D(1),W(1,44,107,1),D(1),X(2),D(1),W(3,65,107,1),
-  D(2),W(4,57,107,1),D(1),W(2,66,107,1),W(3,42,72,1),D(1),W(1,44,117,1),D(1),D(1),W(3,65,117,1),
-  D(2),W(4,57,117,1),D(1),W(2,66,117,1),W(3,42,77,1),D(1),X(1),D(1),W(3,42,97,3),D(1),
-  X(3),D(2),X(4),D(1),X(2),D(1),W(1,69,64,3),D(1),W(2,61,64,3),W(3,42,107,1),
-  D(1),D(2),D(1),W(2,61,97,3),D(1),W(1,69,67,1),D(1),W(3,42,117,1),D(4),W(2,61,107,1),
-  D(1),W(1,69,72,1),D(1),X(3),D(4),W(2,61,117,1),D(1),W(1,69,77,1),D(1),D(4),
-  X(2),D(1),W(1,69,82,1),W(2,71,64,3),D(1),W(1,69,97,3),D(1),W(1,50,64,3),D(3),D(1),
-  W(2,71,67,1),D(1),W(1,69,107,1),D(1),W(1,50,67,1),D(4),
+  D(4),M(3,49,97),D(2),W(1,62,64,3),M(2,73,82),D(1),W(4,47,64,3),D(1),W(2,73,97,3),D(1),
+  W(3,49,97,3),D(3),W(1,62,67,1),D(1),W(4,47,67,1),D(1),W(2,73,107,1),D(1),W(3,49,107,1),D(3),
+  M(1,62,72),D(1),M(4,47,72),D(1),M(2,73,117),D(1),M(3,49,117),D(3),M(1,62,77),D(1),
+  M(4,47,77),D(1),X(2),D(1),X(3),D(1),W(2,66,64,3),D(2),M(1,62,82),M(2,66,97),
+  D(1),M(4,47,82),D(5),M(1,62,87),M(2,68,64),D(1),M(4,47,87),D(1),M(2,68,97),D(4),
+  M(1,62,92),W(2,66,117,1),D(1),M(4,47,92),D(1),M(2,68,107),D(3),W(1,62,97,3),D(1),X(2),
+  D(1),M(1,69,64),M(4,47,97),D(1),W(2,59,64,3),D(2),M(1,69,97),D(1),W(1,62,107,1),D(1),
+  W(1,68,64,3),D(1),M(4,47,107),D(1),W(2,59,67,1),D(1),M(1,68,97),D(1),M(1,69,64),D(1),
+  W(1,62,117,1),D(2),W(1,69,97,3),M(4,47,117),D(1),M(2,59,72),D(1),W(1,68,107,1),D(1),W(1,68,64,3),
+  D(1),X(1),D(2),M(1,68,97),X(4),D(1),M(2,59,77),D(1),M(1,52,64),D(1),
+  X(1),D(2),M(1,52,97),D(1),M(1,68,64),D(1),M(2,59,82),D(1),M(1,68,97),D(3),
+  W(1,52,107,1),D(1),W(1,66,64,3),D(1),M(2,59,87),D(1),
   0
 };
 
 nohop static const byte bwv883f017[] = {
-  W(2,71,72,1),D(1),W(1,69,117,1),D(1),W(1,50,72,1),D(4),W(2,71,77,1),D(1),X(1),D(1),
-  W(1,50,77,1),D(3),W(3,54,64,3),D(1),W(2,71,82,1),W(4,74,64,3),D(1),D(1),W(1,50,82,1),W(3,54,97,3),
-  D(1),W(2,71,97,3),D(1),D(2),W(4,74,67,1),D(2),W(1,50,87,1),W(3,54,107,1),D(1),W(2,71,107,1),
-  D(3),W(4,74,72,1),D(2),W(1,50,92,1),W(3,54,117,1),D(1),W(2,71,117,1),D(3),W(4,74,77,1),D(2),
-  W(1,50,97,1),X(3),D(1),X(2),D(1),W(2,56,64,3),D(2),W(4,74,97,3),D(2),W(1,50,107,1),
-  D(1),W(2,56,97,3),D(3),W(4,74,107,1),D(2),W(1,50,117,1),D(1),W(2,56,107,1),D(3),W(4,74,117,1),
-  D(2),X(1),D(1),W(2,56,117,1),D(3),X(4),D(2),W(2,68,64,3),D(1),X(2),
-  D(1),W(3,59,64,3),D(2),D(2),W(2,68,67,1),D(1),D(1),W(3,59,67,1),D(2),W(3,59,97,3),
-  D(2),W(2,68,72,1),D(1),W(1,50,97,3),D(1),D(2),W(3,59,107,1),D(2),W(2,68,77,1),D(1),
-  W(1,50,107,1),D(3),W(3,59,117,1),D(2),W(1,69,64,3),W(2,68,82,1),D(1),W(1,50,117,1),D(2),W(3,49,64,3),
-  D(1),X(3),D(1),W(2,68,97,3),D(1),W(1,69,67,1),D(1),X(1),
+  M(1,66,97),D(2),M(1,68,64),D(1),W(1,52,117,1),D(1),X(1),D(1),M(2,59,92),D(1),
+  M(1,66,107),D(2),W(1,68,97,3),D(1),M(1,69,64),W(2,59,97,3),D(1),M(2,64,64),W(3,49,64,3),W(4,47,97,3),
+  D(2),W(1,66,117,1),D(1),M(2,64,97),D(1),M(1,68,107),M(3,49,97),D(1),M(1,69,67),W(2,59,107,1),
+  D(1),W(4,47,107,1),D(2),X(1),D(1),N(2,64),D(1),M(1,68,117),W(3,49,107,1),D(1),
+  M(1,69,72),M(2,59,117),D(1),M(4,47,117),D(3),N(2,64),D(1),X(1),M(3,49,117),D(1),
+  M(1,69,77),X(2),D(1),X(4),D(4),W(2,61,64,3),W(3,45,64,3),D(1),W(1,69,97,3),D(5),
+  W(2,61,67,1),W(3,45,67,1),D(1),W(1,69,107,1),D(4),W(3,45,97,3),D(1),M(2,61,72),D(1),M(1,69,117),
+  D(4),W(3,45,107,1),D(1),M(2,61,77),D(1),X(1),D(4),M(3,45,117),D(1),W(1,63,64,3),
+  M(2,61,82),W(3,54,64,3),D(1),W(2,61,97,3),D(4),X(3),D(1),W(1,63,67,1),W(3,54,67,1),D(1),
+  W(2,61,107,1),D(5),M(1,63,72),M(3,54,72),D(1),M(2,61,117),D(5),M(1,63,77),M(3,54,77),D(1),
+  X(2),D(5),M(1,63,82),W(2,66,64,3),M(3,54,82),W(4,75,64,3),D(2),W(1,63,97,3),D(2),M(4,75,97),
+  D(2),
   0
 };
 
 nohop static const byte bwv883f018[] = {
-  D(2),W(3,49,67,1),D(1),D(1),W(2,68,107,1),D(1),W(1,69,72,1),D(1),D(2),W(3,49,72,1),
-  D(2),W(2,68,117,1),D(1),W(1,69,77,1),D(3),W(3,49,77,1),D(1),W(1,69,97,3),D(1),W(1,57,64,3),
-  W(2,73,64,3),D(4),W(3,49,82,1),D(1),W(1,69,107,1),D(1),W(1,57,97,3),W(2,73,67,1),D(1),D(3),
-  W(3,49,87,1),D(1),W(1,69,117,1),D(1),W(1,57,107,1),W(2,73,72,1),D(4),W(3,49,92,1),D(1),X(1),
-  D(1),W(1,57,117,1),W(2,73,77,1),D(4),W(3,49,97,1),D(1),D(1),W(1,62,64,3),W(2,73,82,1),D(1),
-  W(4,47,64,3),D(1),W(2,73,97,3),D(1),W(3,49,97,3),D(3),W(1,62,67,1),D(1),W(4,47,67,1),D(1),
-  W(2,73,107,1),D(1),W(3,49,107,1),D(3),W(1,62,72,1),D(1),W(4,47,72,1),D(1),W(2,73,117,1),D(1),
-  W(3,49,117,1),D(3),W(1,62,77,1),D(1),W(4,47,77,1),D(1),X(2),D(1),X(3),D(1),
-  W(2,66,64,3),D(2),W(1,62,82,1),W(2,66,97,3),D(1),W(4,47,82,1),D(1),D(1),D(3),W(1,62,87,1),
-  W(2,68,64,3),D(1),W(4,47,87,1),D(1),W(2,68,97,3),D(1),D(3),W(1,62,92,1),W(2,66,117,1),D(1),
-  W(4,47,92,1),D(1),
+  W(2,66,67,1),M(3,54,87),D(2),W(1,63,107,1),D(2),W(4,75,107,1),D(2),M(2,66,72),M(3,54,92),D(2),
+  M(1,63,117),D(2),M(4,75,117),D(2),M(2,66,77),M(3,54,97),D(1),W(2,66,97,3),D(1),X(1),
+  D(2),X(4),D(1),W(1,72,64,3),D(1),M(3,54,107),D(1),W(2,66,107,1),D(2),M(1,72,97),
+  D(3),M(3,54,117),D(1),M(2,66,117),D(2),W(1,72,107,1),D(3),X(3),D(1),X(2),
+  D(2),M(1,72,117),D(6),W(1,68,64,3),W(2,60,64,3),D(4),M(1,68,97),D(2),W(2,60,67,1),D(4),
+  W(1,68,107,1),D(2),M(2,60,72),D(4),M(1,68,117),D(2),M(2,60,77),D(4),X(1),D(2),
+  W(1,61,64,3),M(2,60,82),W(4,52,64,3),D(2),W(3,54,97,3),D(1),W(2,60,97,3),D(3),W(1,61,67,1),W(4,52,67,1),
+  D(2),W(3,54,107,1),D(1),W(2,60,107,1),D(3),M(1,61,72),M(4,52,72),D(2),M(3,54,117),D(1),
+  M(2,60,117),D(3),M(1,61,77),M(4,52,77),D(2),X(3),D(1),X(2),D(1),W(1,61,97,3),
+  W(2,73,64,3),W(3,64,64,3),D(2),M(2,73,97),M(4,52,82),D(4),W(1,61,107,1),W(3,64,67,1),D(2),W(2,73,107,1),
+  M(4,52,87),D(4),M(1,61,117),M(3,64,72),D(2),M(2,73,117),M(4,52,92),D(4),X(1),M(3,64,77),
+  D(2),X(2),
   0
 };
 
 nohop static const byte bwv883f019[] = {
-  W(2,68,107,1),D(3),W(1,62,97,3),D(1),X(2),D(1),W(1,69,64,3),W(4,47,97,1),D(1),W(2,59,64,3),
-  D(2),W(1,69,97,3),D(1),W(1,62,107,1),D(1),W(1,68,64,3),D(1),W(4,47,107,1),D(1),W(2,59,67,1),
-  D(1),W(1,68,97,3),D(1),W(1,69,64,3),D(1),W(1,62,117,1),D(2),W(1,69,97,3),W(4,47,117,1),D(1),
-  W(2,59,72,1),D(1),W(1,68,107,1),D(1),W(1,68,64,3),D(1),X(1),D(2),W(1,68,97,3),X(4),
-  D(1),W(2,59,77,1),D(1),W(1,52,64,3),D(1),X(1),D(1),D(1),W(1,52,97,3),D(1),
-  W(1,68,64,3),D(1),W(2,59,82,1),D(1),W(1,68,97,3),D(1),D(2),W(1,52,107,1),D(1),W(1,66,64,3),
-  D(1),W(2,59,87,1),D(1),W(1,66,97,3),D(2),W(1,68,64,3),D(1),W(1,52,117,1),D(1),X(1),
-  D(1),W(2,59,92,1),D(1),W(1,66,107,1),D(2),W(1,68,97,3),D(1),W(1,69,64,3),W(2,59,97,3),D(1),
-  W(2,64,64,3),W(3,49,64,3),W(4,47,97,3),D(1),D(1),W(1,66,117,1),D(1),W(2,64,97,3),D(1),W(1,68,107,1),
-  W(3,49,97,3),D(1),W(1,69,67,1),W(2,59,107,1),D(1),W(4,47,107,1),D(2),X(1),D(1),W(2,64,107,1),
-  D(1),W(1,68,117,1),
+  W(3,64,97,3),M(4,52,97),D(3),W(1,78,64,3),W(2,63,98,3),D(1),M(3,51,64),W(4,52,97,3),D(2),W(3,64,107,1),
+  D(3),W(1,78,67,1),D(1),M(3,51,67),W(4,52,107,1),D(2),M(3,64,117),D(3),M(1,78,72),D(1),
+  M(3,51,72),M(4,52,117),D(2),X(3),D(3),M(1,78,77),D(1),M(3,51,77),X(4),D(3),
+  M(2,58,64),D(1),W(3,51,97,3),D(1),M(1,78,82),D(2),M(2,58,97),D(3),W(3,51,107,1),D(1),
+  M(1,78,87),D(1),M(2,60,64),D(1),W(2,58,107,1),D(1),W(2,60,97,3),D(2),M(3,51,117),D(1),
+  M(1,78,92),D(2),W(2,58,117,1),D(1),M(2,60,107),D(2),X(3),D(1),M(1,78,97),D(1),
+  W(2,61,64,3),W(3,75,64,3),D(1),X(2),D(1),W(2,60,117,1),D(1),W(2,61,97,3),D(2),M(1,78,107),
+  D(1),M(2,60,64),W(3,75,67,1),D(2),X(2),D(1),W(2,61,107,1),D(1),W(2,60,97,3),D(1),
+  M(1,78,117),D(1),M(2,61,64),M(3,75,72),D(2),M(2,61,97),D(1),M(2,60,64),D(1),W(2,60,107,1),
+  D(1),X(1),D(1),W(2,60,97,3),M(3,75,77),D(2),M(2,56,64),D(1),X(2),W(4,61,64,3),
+  D(1),W(2,60,117,1),D(2),M(2,60,107),M(3,75,82),D(2),M(2,56,67),M(4,61,97),D(1),W(1,60,64,3),
+  W(2,56,97,3),D(1),
   0
 };
 
 nohop static const byte bwv883f020[] = {
-  W(3,49,107,1),D(1),W(1,69,72,1),W(2,59,117,1),D(1),W(4,47,117,1),D(2),D(1),W(2,64,117,1),D(1),
-  X(1),W(3,49,117,1),D(1),W(1,69,77,1),X(2),D(1),X(4),D(3),X(2),D(1),
-  W(2,61,64,3),W(3,45,64,3),D(1),W(1,69,97,3),D(1),D(3),D(1),W(2,61,67,1),W(3,45,67,1),D(1),
-  W(1,69,107,1),D(4),W(3,45,97,3),D(1),W(2,61,72,1),D(1),W(1,69,117,1),D(4),W(3,45,107,1),D(1),
-  W(2,61,77,1),D(1),X(1),D(4),W(3,45,117,1),D(1),W(1,63,64,3),W(2,61,82,1),W(3,54,64,3),D(1),
-  W(2,61,97,3),D(4),X(3),D(1),W(1,63,67,1),W(3,54,67,1),D(1),W(2,61,107,1),D(4),D(1),
-  W(1,63,72,1),W(3,54,72,1),D(1),W(2,61,117,1),D(5),W(1,63,77,1),W(3,54,77,1),D(1),X(2),D(5),
-  W(1,63,82,1),W(2,66,64,3),W(3,54,82,1),W(4,75,64,3),D(1),D(1),W(1,63,97,3),D(2),W(4,75,97,3),D(2),
-  W(2,66,67,1),W(3,54,87,1),D(2),W(1,63,107,1),D(2),W(4,75,107,1),D(2),W(2,66,72,1),W(3,54,92,1),D(2),
-  W(1,63,117,1),D(2),W(4,75,117,1),D(2),W(2,66,77,1),W(3,54,97,1),D(1),W(2,66,97,3),D(1),X(1),
-  D(2),X(4),D(1),
+  X(2),D(2),M(1,60,97),W(2,60,117,1),M(3,75,87),D(1),M(1,58,64),D(1),X(2),W(4,61,107,1),
+  D(1),M(2,56,107),D(2),N(1,60),D(1),W(1,60,107,1),X(2),M(3,75,92),D(1),W(1,60,97,3),
+  D(1),M(4,61,117),D(1),M(2,56,117),D(2),W(1,58,107,1),D(1),M(1,60,117),M(3,75,97),D(1),
+  M(1,60,107),D(1),W(1,52,64,3),W(2,61,64,3),W(3,75,97,3),W(4,80,64,3),D(1),X(2),D(2),M(1,52,97),
+  D(1),X(1),D(1),W(1,60,117,1),D(1),M(1,78,107),W(2,61,67,1),W(3,75,107,1),W(4,80,67,1),D(3),
+  N(1,52),D(2),X(1),D(1),M(1,78,117),M(2,61,72),M(3,75,117),M(4,80,72),D(3),N(1,52),
+  D(3),X(1),M(2,61,77),X(3),M(4,80,77),D(4),W(1,76,64,3),W(3,49,64,3),D(2),M(2,61,82),
+  M(4,80,82),D(1),W(4,80,97,3),D(3),W(1,76,67,1),W(3,49,67,1),D(2),M(2,61,87),D(1),W(4,80,107,1),
+  D(3),M(1,76,72),M(3,49,72),D(2),M(2,61,92),D(1),M(4,80,117),D(3),M(1,76,77),M(3,49,77),
+  D(2),M(2,61,97),D(1),X(4),D(2),W(4,78,64,3),D(1),M(1,76,82),W(2,57,64,3),W(3,49,97,3),
+  D(2),W(1,76,97,3),D(3),W(4,78,67,1),D(1),W(2,57,67,1),W(3,49,107,1),D(2),
   0
 };
 
 nohop static const byte bwv883f021[] = {
-  W(1,72,64,3),D(1),W(3,54,107,1),D(1),W(2,66,107,1),D(1),D(1),W(1,72,97,3),D(1),D(2),
-  W(3,54,117,1),D(1),W(2,66,117,1),D(2),W(1,72,107,1),D(3),X(3),D(1),X(2),D(2),
-  W(1,72,117,1),D(4),D(2),W(1,68,64,3),W(2,60,64,3),D(4),W(1,68,97,3),D(1),D(1),W(2,60,67,1),
-  D(4),W(1,68,107,1),D(2),W(2,60,72,1),D(4),W(1,68,117,1),D(2),W(2,60,77,1),D(4),X(1),
-  D(2),W(1,61,64,3),W(2,60,82,1),W(4,52,64,3),D(2),W(3,54,97,3),D(1),W(2,60,97,3),D(1),D(2),
-  W(1,61,67,1),W(4,52,67,1),D(2),W(3,54,107,1),D(1),W(2,60,107,1),D(3),W(1,61,72,1),W(4,52,72,1),D(2),
-  W(3,54,117,1),D(1),W(2,60,117,1),D(3),W(1,61,77,1),W(4,52,77,1),D(2),X(3),D(1),X(2),
-  D(1),W(1,61,97,3),W(2,73,64,3),W(3,64,64,3),D(1),D(1),W(2,73,97,3),W(4,52,82,1),D(2),D(1),
-  D(1),W(1,61,107,1),W(3,64,67,1),D(2),W(2,73,107,1),W(4,52,87,1),D(4),W(1,61,117,1),W(3,64,72,1),D(2),
-  W(2,73,117,1),W(4,52,92,1),D(4),X(1),W(3,64,77,1),D(2),X(2),W(3,64,97,3),W(4,52,97,1),D(1),
-  D(2),W(1,78,64,3),
+  W(1,76,107,1),D(3),M(4,78,72),D(1),M(2,57,72),M(3,49,117),D(2),M(1,76,117),D(3),M(4,78,77),
+  D(1),M(2,57,77),X(3),D(2),X(1),D(2),W(1,81,64,3),W(3,66,64,3),D(1),M(4,78,82),
+  D(1),M(2,57,82),D(1),M(3,66,97),W(4,78,97,3),D(3),W(1,81,67,1),D(2),M(2,57,87),D(1),
+  W(3,66,107,1),W(4,78,107,1),D(3),M(1,81,72),D(2),M(2,57,92),D(1),M(3,66,117),M(4,78,117),D(3),
+  M(1,81,77),D(2),M(2,57,97),D(1),X(3),X(4),D(3),M(1,81,82),W(3,62,64,3),D(2),
+  M(2,57,107),D(3),M(3,62,97),D(1),M(1,81,87),D(2),M(2,57,117),D(3),W(3,62,107,1),D(1),
+  M(1,81,92),D(2),X(2),D(3),M(3,62,117),D(1),M(1,81,97),D(5),X(3),D(1),
+  M(1,81,107),W(3,59,64,3),W(4,74,64,3),D(1),W(1,81,97,3),D(2),M(3,59,97),D(3),W(4,74,67,1),D(1),
+  W(1,81,107,1),D(2),W(3,59,107,1),D(3),M(4,74,72),D(1),M(1,81,117),D(2),M(3,59,117),D(3),
+  M(4,74,77),D(1),X(1),D(2),X(3),D(1),W(1,76,64,3),W(4,74,97,3),D(1),W(3,56,64,3),
+  D(3),W(2,57,97,3),D(2),W(1,76,67,1),W(4,74,107,1),D(1),W(3,56,67,1),D(3),W(2,57,107,1),D(2),
+  M(1,76,72),M(4,74,117),D(1),M(3,56,72),
   0
 };
 
 nohop static const byte bwv883f022[] = {
-  W(2,63,98,3),D(1),W(3,51,64,3),W(4,52,97,3),D(2),W(3,64,107,1),D(3),W(1,78,67,1),D(1),W(3,51,67,1),
-  W(4,52,107,1),D(2),W(3,64,117,1),D(3),W(1,78,72,1),D(1),W(3,51,72,1),W(4,52,117,1),D(2),X(3),
-  D(3),W(1,78,77,1),D(1),W(3,51,77,1),X(4),D(2),D(1),W(2,58,64,3),D(1),W(3,51,97,3),
-  D(1),W(1,78,82,1),D(1),D(1),W(2,58,97,3),D(3),W(3,51,107,1),D(1),W(1,78,87,1),D(1),
-  W(2,60,64,3),D(1),W(2,58,107,1),D(1),W(2,60,97,3),D(1),D(1),W(3,51,117,1),D(1),W(1,78,92,1),
-  D(2),W(2,58,117,1),D(1),W(2,60,107,1),D(2),X(3),D(1),W(1,78,97,1),D(1),W(2,61,64,3),
-  W(3,75,64,3),D(1),X(2),D(1),W(2,60,117,1),D(1),W(2,61,97,3),D(1),D(1),W(1,78,107,1),
-  D(1),W(2,60,64,3),W(3,75,67,1),D(1),D(1),X(2),D(1),W(2,61,107,1),D(1),W(2,60,97,3),
-  D(1),W(1,78,117,1),D(1),W(2,61,64,3),W(3,75,72,1),D(2),W(2,61,97,3),D(1),W(2,60,64,3),D(1),
-  W(2,60,107,1),D(1),X(1),D(1),W(2,60,97,3),W(3,75,77,1),D(2),W(2,56,64,3),D(1),X(2),
-  W(4,61,64,3),D(1),W(2,60,117,1),D(2),W(2,60,107,1),
+  D(3),M(2,57,117),D(2),M(1,76,77),X(4),D(1),M(3,56,77),D(3),W(2,80,64,3),W(4,64,64,3),
+  D(2),M(1,76,82),D(1),M(3,56,82),D(1),W(1,76,97,3),M(4,64,97),D(2),W(2,80,67,1),D(3),
+  M(3,56,87),D(1),W(1,76,107,1),W(4,64,107,1),D(2),M(2,80,72),D(3),M(3,56,92),D(1),M(1,76,117),
+  M(4,64,117),D(2),M(2,80,77),D(3),M(3,56,97),D(1),X(1),X(4),D(2),W(1,61,64,3),
+  M(2,80,82),D(3),M(3,56,107),D(3),M(1,61,97),W(2,80,97,3),D(3),M(3,56,117),D(3),W(1,61,107,1),
+  W(2,80,107,1),D(3),X(3),D(3),M(1,61,117),M(2,80,117),D(4),W(1,73,64,3),D(1),W(2,57,64,3),
+  W(4,49,64,3),D(1),X(1),X(2),W(3,56,97,3),D(4),W(1,73,67,1),M(4,49,97),D(1),W(2,57,67,1),
+  D(1),W(3,56,107,1),D(4),M(1,73,72),W(4,49,107,1),D(1),M(2,57,72),D(1),M(3,56,117),D(1),
+  W(2,57,97,3),D(3),M(1,73,77),M(4,49,117),D(2),X(3),D(1),W(2,57,107,1),D(2),W(1,73,97,3),
+  W(2,71,64,3),D(1),W(3,54,64,3),X(4),D(3),W(2,57,117,1),D(2),W(1,73,107,1),M(2,71,67),D(1),
+  W(3,54,67,1),D(3),X(2),D(2),M(1,73,117),M(2,71,72),D(1),M(3,54,72),D(5),X(1),
+  M(2,71,77),
   0
 };
 
 nohop static const byte bwv883f023[] = {
-  W(3,75,82,1),D(2),W(2,56,67,1),W(4,61,97,3),D(1),W(1,60,64,3),W(2,56,97,3),D(1),X(2),D(2),
-  W(1,60,97,3),W(2,60,117,1),W(3,75,87,1),D(1),W(1,58,64,3),D(1),X(2),W(4,61,107,1),D(1),W(2,56,107,1),
-  D(1),D(1),W(1,60,64,3),D(1),W(1,60,107,1),X(2),W(3,75,92,1),D(1),W(1,60,97,3),D(1),
-  W(4,61,117,1),D(1),W(2,56,117,1),D(2),W(1,58,107,1),D(1),W(1,60,117,1),W(3,75,97,1),D(1),W(1,60,107,1),
-  D(1),W(1,52,64,3),W(2,61,64,3),W(3,75,97,3),W(4,80,64,3),D(1),X(2),D(2),W(1,52,97,3),D(1),
-  X(1),D(1),W(1,60,117,1),D(1),W(1,78,107,1),W(2,61,67,1),W(3,75,107,1),W(4,80,67,1),D(1),D(2),
-  W(1,52,107,1),D(1),D(1),X(1),D(1),W(1,78,117,1),W(2,61,72,1),W(3,75,117,1),W(4,80,72,1),D(3),
-  W(1,52,117,1),D(2),D(1),X(1),W(2,61,77,1),X(3),W(4,80,77,1),D(3),X(1),D(1),
-  W(1,76,64,3),W(3,49,64,3),D(2),W(2,61,82,1),W(4,80,82,1),D(1),W(4,80,97,3),D(1),D(1),D(1),
-  W(1,76,67,1),W(3,49,67,1),D(2),W(2,61,87,1),D(1),W(4,80,107,1),D(3),W(1,76,72,1),W(3,49,72,1),
+  D(1),M(3,54,77),D(2),W(1,62,64,3),D(1),W(4,69,64,3),D(2),M(1,62,97),M(2,71,82),D(1),
+  M(3,54,82),D(3),W(4,69,67,1),D(2),W(1,62,107,1),M(2,71,87),D(1),W(1,61,64,3),M(3,54,87),D(3),
+  M(4,69,72),D(2),M(1,61,97),M(2,71,92),D(1),M(3,54,92),D(3),M(4,69,77),D(2),W(1,61,107,1),
+  M(2,71,97),D(1),W(1,59,64,3),M(3,54,97),D(1),W(2,68,64,3),D(2),M(4,69,82),D(1),M(1,59,97),
+  D(1),W(1,61,117,1),W(2,71,107,1),D(1),M(3,54,107),D(1),M(2,68,67),D(2),M(4,69,87),D(1),
+  M(1,59,107),D(1),X(1),M(2,71,117),D(1),M(3,54,117),D(1),M(2,68,72),D(2),M(4,69,92),
+  D(1),M(1,59,117),D(1),X(2),D(1),X(3),D(1),M(2,68,77),D(1),W(2,71,97,3),
+  D(1),M(4,69,97),D(1),W(1,57,64,3),D(3),W(2,68,82,1),D(1),M(2,71,107),D(1),M(4,69,107),
+  D(1),W(1,57,67,1),D(3),M(2,68,87),D(1),M(2,71,117),D(1),M(4,69,117),D(1),M(1,57,72),
+  D(1),W(1,57,97,3),D(2),M(2,68,92),D(1),X(2),D(1),X(4),D(2),W(1,57,107,1),
+  W(4,69,97,3),D(2),W(1,57,64,3),M(2,68,97),D(2),M(4,53,64),D(2),W(1,57,117,1),W(4,69,107,1),D(1),
+  W(3,54,97,3),D(1),M(1,57,67),
   0
 };
 
 nohop static const byte bwv883f024[] = {
-  D(2),W(2,61,92,1),D(1),W(4,80,117,1),D(3),W(1,76,77,1),W(3,49,77,1),D(2),W(2,61,97,1),D(1),
-  X(4),D(2),W(4,78,64,3),D(1),W(1,76,82,1),W(2,57,64,3),W(3,49,97,3),D(1),D(1),W(1,76,97,3),
-  D(1),D(2),W(4,78,67,1),D(1),W(2,57,67,1),W(3,49,107,1),D(2),W(1,76,107,1),D(3),W(4,78,72,1),
-  D(1),W(2,57,72,1),W(3,49,117,1),D(2),W(1,76,117,1),D(3),W(4,78,77,1),D(1),W(2,57,77,1),X(3),
-  D(2),X(1),D(2),W(1,81,64,3),W(3,66,64,3),D(1),W(4,78,82,1),D(1),W(2,57,82,1),D(1),
-  W(3,66,97,3),W(4,78,97,3),D(1),D(2),W(1,81,67,1),D(2),W(2,57,87,1),D(1),W(3,66,107,1),W(4,78,107,1),
-  D(3),W(1,81,72,1),D(2),W(2,57,92,1),D(1),W(3,66,117,1),W(4,78,117,1),D(3),W(1,81,77,1),D(2),
-  W(2,57,97,1),D(1),X(3),X(4),D(3),W(1,81,82,1),W(3,62,64,3),D(2),W(2,57,107,1),D(1),
-  D(2),W(3,62,97,3),D(1),W(1,81,87,1),D(2),W(2,57,117,1),D(3),W(3,62,107,1),D(1),W(1,81,92,1),
-  D(2),X(2),D(3),W(3,62,117,1),D(1),W(1,81,97,1),D(5),X(3),D(1),W(1,81,107,1),
-  W(3,59,64,3),W(4,74,64,3),
+  M(2,68,107),M(3,56,64),D(2),M(4,53,67),D(1),W(1,57,97,3),D(1),X(1),M(4,69,117),D(1),
+  M(1,57,64),W(3,54,107,1),D(1),M(2,68,117),M(3,56,67),D(2),W(3,56,64,3),M(4,53,72),D(1),W(1,57,107,1),
+  D(1),X(4),D(1),W(1,57,97,3),W(3,54,117,1),D(1),X(2),D(2),M(3,56,67),M(4,53,77),
+  D(1),W(1,57,117,1),D(2),M(1,57,107),X(3),D(2),W(1,73,64,3),D(1),M(3,56,72),M(4,53,82),
+  D(1),X(1),D(1),M(1,73,97),D(1),W(1,57,117,1),D(3),M(3,56,77),M(4,53,87),D(2),
+  M(1,73,107),D(1),X(1),D(3),M(3,56,82),M(4,53,92),D(2),M(1,73,117),D(4),M(3,56,87),
+  M(4,53,97),D(2),X(1),D(1),W(3,56,97,3),D(1),W(4,53,97,3),D(1),W(1,69,64,3),M(3,54,64),
+  D(1),W(2,68,97,3),D(2),M(1,69,97),D(1),W(3,56,107,1),D(1),W(4,53,107,1),D(1),M(3,54,67),
+  D(1),W(2,68,107,1),D(2),W(1,69,107,1),D(1),M(3,56,117),D(1),M(4,53,117),D(1),M(3,54,72),
+  D(1),M(2,68,117),D(2),M(1,69,117),D(1),X(3),D(1),X(4),D(1),M(3,54,77),
+  D(1),X(2),D(2),X(1),D(1),W(1,66,64,3),D(2),M(3,54,82),D(1),M(1,66,97),
+  W(2,57,64,3),D(5),M(3,54,87),D(1),W(1,66,107,1),W(2,57,67,1),D(5),
   0
 };
 
 nohop static const byte bwv883f025[] = {
-  D(1),W(1,81,97,3),D(1),D(1),W(3,59,97,3),D(2),D(1),W(4,74,67,1),D(1),W(1,81,107,1),
-  D(2),W(3,59,107,1),D(3),W(4,74,72,1),D(1),W(1,81,117,1),D(2),W(3,59,117,1),D(3),W(4,74,77,1),
-  D(1),X(1),D(2),X(3),D(1),W(1,76,64,3),W(4,74,97,3),D(1),W(3,56,64,3),D(2),
-  D(1),W(2,57,97,3),D(1),D(1),W(1,76,67,1),W(4,74,107,1),D(1),W(3,56,67,1),D(3),W(2,57,107,1),
-  D(2),W(1,76,72,1),W(4,74,117,1),D(1),W(3,56,72,1),D(3),W(2,57,117,1),D(2),W(1,76,77,1),X(4),
-  D(1),W(3,56,77,1),D(3),W(2,80,64,3),W(4,64,64,3),D(2),W(1,76,82,1),D(1),W(3,56,82,1),D(1),
-  W(1,76,97,3),W(4,64,97,3),D(1),D(1),W(2,80,67,1),D(3),W(3,56,87,1),D(1),W(1,76,107,1),W(4,64,107,1),
-  D(2),W(2,80,72,1),D(3),W(3,56,92,1),D(1),W(1,76,117,1),W(4,64,117,1),D(2),W(2,80,77,1),D(3),
-  W(3,56,97,1),D(1),X(1),X(4),D(2),W(1,61,64,3),W(2,80,82,1),D(3),W(3,56,107,1),D(1),
-  D(2),W(1,61,97,3),W(2,80,97,3),D(3),W(3,56,117,1),D(3),W(1,61,107,1),W(2,80,107,1),D(3),X(3),
-  D(3),W(1,61,117,1),
+  M(3,54,92),D(1),M(1,66,117),M(2,57,72),D(5),M(3,54,97),D(1),X(1),M(2,57,77),D(3),
+  W(1,74,64,3),D(1),W(4,59,64,3),D(1),M(3,54,107),D(1),M(2,57,82),D(3),W(1,74,67,1),W(3,54,97,3),
+  D(1),W(4,59,67,1),D(2),M(2,57,87),D(3),M(1,74,72),W(3,54,107,1),D(1),M(4,59,72),D(2),
+  M(2,57,92),D(3),M(1,74,77),M(3,54,117),D(1),M(4,59,77),D(2),M(2,57,97),D(2),W(3,71,64,3),
+  D(1),M(1,74,82),W(2,62,64,3),X(3),W(4,59,97,3),D(1),M(3,71,97),D(2),W(2,57,107,1),D(3),
+  M(1,74,87),M(2,62,67),W(4,59,107,1),D(1),W(3,71,107,1),D(2),M(2,57,117),D(3),M(1,74,92),M(2,62,72),
+  M(4,59,117),D(1),M(3,71,117),D(2),X(2),D(3),M(1,74,97),M(2,62,77),X(4),D(1),
+  X(3),D(4),W(3,64,64,3),W(4,56,64,3),D(1),M(1,74,107),W(2,62,97,3),D(1),N(2,57),D(1),
+  W(1,74,97,3),D(3),W(3,64,67,1),W(4,56,67,1),D(1),W(2,62,107,1),D(1),N(2,57),D(1),W(1,74,107,1),
+  D(3),M(3,64,72),M(4,56,72),D(1),M(2,62,117),D(1),N(2,57),D(1),M(1,74,117),D(3),
+  M(3,64,77),M(4,56,77),D(1),X(2),D(2),X(1),D(1),W(1,73,64,3),D(1),W(2,52,64,3),
+  D(1),M(3,64,82),
   0
 };
 
 nohop static const byte bwv883f026[] = {
-  W(2,80,117,1),D(4),W(1,73,64,3),D(1),W(2,57,64,3),W(4,49,64,3),D(1),X(1),X(2),W(3,56,97,3),
-  D(1),D(3),W(1,73,67,1),W(4,49,97,3),D(1),W(2,57,67,1),D(1),W(3,56,107,1),D(4),W(1,73,72,1),
-  W(4,49,107,1),D(1),W(2,57,72,1),D(1),W(3,56,117,1),D(1),W(2,57,97,3),D(3),W(1,73,77,1),W(4,49,117,1),
-  D(2),X(3),D(1),W(2,57,107,1),D(2),W(1,73,97,3),W(2,71,64,3),D(1),W(3,54,64,3),X(4),
-  D(2),D(1),W(2,57,117,1),D(2),W(1,73,107,1),W(2,71,67,1),D(1),W(3,54,67,1),D(3),X(2),
-  D(2),W(1,73,117,1),W(2,71,72,1),D(1),W(3,54,72,1),D(3),D(2),X(1),W(2,71,77,1),D(1),
-  W(3,54,77,1),D(2),W(1,62,64,3),D(1),W(4,69,64,3),D(2),W(1,62,97,3),W(2,71,82,1),D(1),W(3,54,82,1),
-  D(3),W(4,69,67,1),D(2),W(1,62,107,1),W(2,71,87,1),D(1),W(1,61,64,3),W(3,54,87,1),D(3),W(4,69,72,1),
-  D(2),W(1,61,97,3),W(2,71,92,1),D(1),W(3,54,92,1),D(3),W(4,69,77,1),D(2),W(1,61,107,1),W(2,71,97,1),
-  D(1),W(1,59,64,3),W(3,54,97,1),D(1),W(2,68,64,3),D(2),W(4,69,82,1),D(1),
+  M(4,56,82),D(3),M(1,73,97),D(2),W(2,52,67,1),D(1),M(3,64,87),M(4,56,87),D(1),M(1,71,64),
+  D(2),W(1,73,107,1),D(2),W(1,71,97,3),M(2,52,72),D(1),M(3,64,92),M(4,56,92),D(3),W(1,73,117,1),
+  D(2),M(1,71,107),M(2,52,77),D(1),M(3,64,97),M(4,56,97),D(1),W(1,73,64,3),D(1),W(2,52,97,3),
+  W(3,64,97,3),D(1),X(1),M(2,57,64),W(4,56,97,3),D(2),W(1,71,117,1),D(2),M(1,73,67),D(1),
+  W(2,52,107,1),W(3,64,107,1),D(1),M(2,57,67),W(4,56,107,1),D(2),X(1),D(2),M(1,73,72),D(1),
+  M(2,52,117),M(3,64,117),D(1),M(2,57,72),M(4,56,117),D(4),M(1,73,77),D(1),X(2),X(3),
+  D(1),M(2,57,77),X(4),D(3),W(3,64,64,3),D(1),M(1,73,82),D(1),W(4,61,64,3),D(1),
+  M(2,57,82),D(3),W(3,64,67,1),D(1),M(1,73,87),W(3,64,97,3),D(1),W(4,61,67,1),D(1),M(2,57,87),
+  D(4),M(1,73,92),W(3,64,107,1),D(1),M(4,61,72),D(1),M(2,57,92),D(4),M(1,73,97),M(3,64,117),
+  D(1),W(2,57,97,3),M(4,61,77),D(3),M(2,69,64),W(3,54,64,3),D(2),M(1,73,107),X(3),D(1),
+  W(2,57,107,1),M(4,61,82),D(1),W(4,61,97,3),D(2),M(2,69,67),W(3,54,67,1),D(2),
   0
 };
 
 nohop static const byte bwv883f027[] = {
-  W(1,59,97,3),D(1),W(1,61,117,1),W(2,71,107,1),D(1),W(3,54,107,1),D(1),W(2,68,67,1),D(2),W(4,69,87,1),
-  D(1),W(1,59,107,1),D(1),X(1),W(2,71,117,1),D(1),W(3,54,117,1),D(1),W(2,68,72,1),D(2),
-  W(4,69,92,1),D(1),W(1,59,117,1),D(1),X(2),D(1),X(3),D(1),W(2,68,77,1),D(1),
-  W(2,71,97,3),D(1),W(4,69,97,1),D(1),W(1,57,64,3),D(3),W(2,68,82,1),D(1),W(2,71,107,1),D(1),
-  W(4,69,107,1),D(1),W(1,57,67,1),D(3),W(2,68,87,1),D(1),W(2,71,117,1),D(1),W(4,69,117,1),D(1),
-  W(1,57,72,1),D(1),W(1,57,97,3),D(1),D(1),W(2,68,92,1),D(1),X(2),D(1),X(4),
-  D(2),W(1,57,107,1),W(4,69,97,3),D(2),W(1,57,64,3),W(2,68,97,1),D(1),D(1),W(4,53,64,3),D(2),
-  W(1,57,117,1),W(4,69,107,1),D(1),W(3,54,97,3),D(1),W(1,57,67,1),W(2,68,107,1),W(3,56,64,3),D(2),W(4,53,67,1),
-  D(1),W(1,57,97,3),D(1),X(1),W(4,69,117,1),D(1),W(1,57,64,3),W(3,54,107,1),D(1),W(2,68,117,1),
-  W(3,56,67,1),D(2),W(3,56,64,3),W(4,53,72,1),D(1),W(1,57,107,1),D(1),X(4),D(1),W(1,57,97,3),
-  W(3,54,117,1),D(1),
+  M(1,73,117),D(1),M(2,57,117),D(1),W(4,61,107,1),D(2),M(2,69,72),M(3,54,72),D(2),X(1),
+  D(1),X(2),D(1),M(4,61,117),D(2),M(2,69,77),M(3,54,77),D(3),W(1,73,97,3),W(4,78,64,3),
+  D(1),M(1,51,64),X(4),D(2),M(2,69,82),W(3,54,97,3),D(1),M(4,78,97),D(2),W(1,73,107,1),
+  D(1),M(1,51,67),D(2),M(2,69,87),W(3,54,107,1),D(1),W(4,78,107,1),D(2),M(1,73,117),D(1),
+  M(1,51,72),D(2),M(2,69,92),M(3,54,117),D(1),M(4,78,117),D(2),X(1),D(1),M(1,51,77),
+  D(2),M(2,69,97),X(3),D(1),X(4),D(2),W(3,71,64,3),D(1),M(1,51,82),D(1),
+  W(4,56,64,3),D(1),W(2,69,97,3),D(3),W(3,71,67,1),D(1),M(1,51,87),D(1),W(1,51,97,3),W(4,56,67,1),
+  D(1),W(2,69,107,1),D(3),M(3,71,72),D(2),W(1,51,107,1),M(4,56,72),D(1),M(2,69,117),D(3),
+  M(3,71,77),D(2),M(1,51,117),M(4,56,77),D(1),X(2),D(1),W(1,68,64,3),W(2,59,64,3),D(2),
+  M(3,71,82),D(2),M(1,68,97),M(4,56,82),D(2),W(2,59,67,1),D(2),M(3,71,87),D(1),M(1,66,64),
+  D(1),W(1,68,107,1),M(4,56,87),D(2),M(2,59,72),D(1),W(1,66,97,3),D(1),M(3,71,92),D(2),
+  W(1,68,117,1),M(4,56,92),D(2),
   0
 };
 
 nohop static const byte bwv883f028[] = {
-  X(2),D(2),W(3,56,67,1),W(4,53,77,1),D(1),W(1,57,117,1),D(1),D(1),W(1,57,107,1),X(3),
-  D(2),W(1,73,64,3),D(1),W(3,56,72,1),W(4,53,82,1),D(1),X(1),D(1),W(1,73,97,3),D(1),
-  W(1,57,117,1),D(3),W(3,56,77,1),W(4,53,87,1),D(1),D(1),W(1,73,107,1),D(1),X(1),D(3),
-  W(3,56,82,1),W(4,53,92,1),D(2),W(1,73,117,1),D(1),D(3),W(3,56,87,1),W(4,53,97,1),D(2),X(1),
-  D(1),W(3,56,97,3),D(1),W(4,53,97,3),D(1),W(1,69,64,3),W(3,54,64,3),D(1),W(2,68,97,3),D(2),
-  W(1,69,97,3),D(1),W(3,56,107,1),D(1),W(4,53,107,1),D(1),W(3,54,67,1),D(1),W(2,68,107,1),D(2),
-  W(1,69,107,1),D(1),W(3,56,117,1),D(1),W(4,53,117,1),D(1),W(3,54,72,1),D(1),W(2,68,117,1),D(2),
-  W(1,69,117,1),D(1),X(3),D(1),X(4),D(1),W(3,54,77,1),D(1),X(2),D(2),
-  X(1),D(1),W(1,66,64,3),D(1),D(1),W(3,54,82,1),D(1),W(1,66,97,3),W(2,57,64,3),D(1),
-  D(1),D(3),W(3,54,87,1),D(1),W(1,66,107,1),W(2,57,67,1),D(5),W(3,54,92,1),D(1),W(1,66,117,1),
-  W(2,57,72,1),D(5),W(3,54,97,1),D(1),X(1),W(2,57,77,1),D(3),W(1,74,64,3),
+  M(2,59,77),D(1),M(1,66,107),D(1),M(3,71,97),D(1),W(1,68,64,3),W(3,53,64,3),D(1),X(1),
+  M(4,56,97),D(2),W(2,59,97,3),D(1),W(1,66,117,1),D(1),W(1,68,97,3),M(3,71,97),D(1),W(3,53,67,1),
+  W(4,56,97,3),D(3),W(2,59,107,1),D(1),X(1),D(1),W(1,68,107,1),M(3,71,107),D(1),M(3,53,72),
+  W(4,56,107,1),D(3),M(2,59,117),D(2),M(1,68,117),M(3,71,117),D(1),M(3,53,77),M(4,56,117),D(3),
+  W(1,69,64,3),X(2),D(1),W(2,65,64,3),D(1),X(1),X(3),W(4,49,64,3),D(1),M(3,53,82),
+  X(4),D(1),W(3,53,97,3),D(2),W(1,69,67,1),D(1),W(2,65,67,1),D(1),W(4,49,67,1),D(2),
+  W(2,65,97,3),M(3,68,64),D(1),W(1,69,97,3),D(3),M(4,49,72),D(2),W(2,65,107,1),W(3,68,67,1),D(1),
+  W(1,69,107,1),D(3),M(4,49,77),D(1),W(1,69,64,3),D(1),W(2,66,64,3),M(3,68,72),D(1),W(1,69,117,1),
+  W(3,68,97,3),W(4,54,64,3),D(1),M(4,49,97),D(3),M(1,69,67),D(1),W(2,66,67,1),D(1),X(1),
+  W(3,68,107,1),W(4,54,67,1),D(1),M(4,49,107),D(2),W(1,69,97,3),D(2),W(2,66,97,3),D(1),M(3,68,117),
+  M(4,54,72),D(1),M(4,49,117),D(2),
   0
 };
 
 nohop static const byte bwv883f029[] = {
-  D(1),W(4,59,64,3),D(1),W(3,54,107,1),D(1),W(2,57,82,1),D(3),W(1,74,67,1),W(3,54,97,3),D(1),
-  W(4,59,67,1),D(2),W(2,57,87,1),D(3),W(1,74,72,1),W(3,54,107,1),D(1),W(4,59,72,1),D(2),W(2,57,92,1),
-  D(3),W(1,74,77,1),W(3,54,117,1),D(1),W(4,59,77,1),D(2),W(2,57,97,1),D(2),W(3,71,64,3),D(1),
-  W(1,74,82,1),W(2,62,64,3),X(3),W(4,59,97,3),D(1),W(3,71,97,3),D(1),D(1),W(2,57,107,1),D(3),
-  W(1,74,87,1),W(2,62,67,1),W(4,59,107,1),D(1),W(3,71,107,1),D(2),W(2,57,117,1),D(3),W(1,74,92,1),W(2,62,72,1),
-  W(4,59,117,1),D(1),W(3,71,117,1),D(2),X(2),D(3),W(1,74,97,1),W(2,62,77,1),X(4),D(1),
-  X(3),D(4),W(3,64,64,3),W(4,56,64,3),D(1),W(1,74,107,1),W(2,62,97,3),D(1),W(2,57,97,3),D(1),
-  W(1,74,97,3),D(3),W(3,64,67,1),W(4,56,67,1),D(1),W(2,62,107,1),D(1),W(2,57,107,1),D(1),W(1,74,107,1),
-  D(3),W(3,64,72,1),W(4,56,72,1),D(1),W(2,62,117,1),D(1),W(2,57,117,1),D(1),W(1,74,117,1),D(3),
-  W(3,64,77,1),W(4,56,77,1),D(1),X(2),D(1),X(2),D(1),X(1),D(1),
+  W(1,69,107,1),D(2),W(2,66,107,1),D(1),X(3),M(4,54,77),D(1),X(4),D(2),W(1,66,64,3),
+  D(2),W(2,57,64,3),D(1),M(4,54,82),D(3),W(1,66,67,1),D(2),W(2,57,67,1),D(1),M(4,54,87),
+  D(3),M(1,66,72),D(1),W(1,78,82,3),D(1),M(2,57,72),D(1),M(4,54,92),D(3),W(1,66,77,1),
+  D(2),M(2,57,77),D(1),M(4,54,97),D(1),W(3,69,64,3),W(4,59,64,3),D(2),M(1,66,82),D(2),
+  W(1,68,64,3),M(2,57,82),D(1),W(4,54,107,1),D(1),W(3,69,67,1),M(4,59,67),D(1),W(3,69,64,3),D(1),
+  W(1,66,87,1),D(2),M(1,68,67),M(2,57,87),D(1),W(1,68,64,3),M(4,54,117),D(1),M(4,59,72),D(1),
+  W(3,69,67,1),D(1),W(1,66,92,1),D(2),M(2,57,92),D(1),M(1,68,67),W(3,69,97,3),X(4),D(1),
+  M(4,59,77),D(1),W(3,69,117,1),D(1),M(1,66,97),W(2,57,97,3),D(3),M(1,68,72),M(3,69,107),D(1),
+  M(4,59,82),D(1),X(3),W(4,59,97,3),D(1),W(1,66,97,3),W(2,57,107,1),N(4,54),D(1),W(2,64,64,3),
+  W(3,56,64,3),D(2),W(1,68,77,1),W(3,69,117,1),D(1),M(2,64,97),D(1),W(4,59,107,1),D(1),M(1,66,107),
+  W(2,57,117,1),N(4,54),D(1),M(3,56,67),D(2),
   0
 };
 
 nohop static const byte bwv883f030[] = {
-  W(1,73,64,3),D(1),W(2,52,64,3),D(1),W(3,64,82,1),W(4,56,82,1),D(1),D(1),D(1),W(1,73,97,3),
-  D(1),D(1),W(2,52,67,1),D(1),W(3,64,87,1),W(4,56,87,1),D(1),W(1,71,64,3),D(2),W(1,73,107,1),
-  D(2),W(1,71,97,3),W(2,52,72,1),D(1),W(3,64,92,1),W(4,56,92,1),D(3),W(1,73,117,1),D(2),W(1,71,107,1),
-  W(2,52,77,1),D(1),W(3,64,97,1),W(4,56,97,1),D(1),W(1,73,64,3),D(1),W(2,52,97,3),W(3,64,97,3),D(1),
-  X(1),W(2,57,64,3),W(4,56,97,3),D(1),D(1),W(1,71,117,1),D(2),W(1,73,67,1),D(1),W(2,52,107,1),
-  W(3,64,107,1),D(1),W(2,57,67,1),W(4,56,107,1),D(2),X(1),D(2),W(1,73,72,1),D(1),W(2,52,117,1),
-  W(3,64,117,1),D(1),W(2,57,72,1),W(4,56,117,1),D(2),D(2),W(1,73,77,1),D(1),X(2),X(3),
-  D(1),W(2,57,77,1),X(4),D(3),W(3,64,64,3),D(1),W(1,73,82,1),D(1),W(4,61,64,3),D(1),
-  W(2,57,82,1),D(3),W(3,64,67,1),D(1),W(1,73,87,1),W(3,64,97,3),D(1),W(4,61,67,1),D(1),W(2,57,87,1),
-  D(4),W(1,73,92,1),W(3,64,107,1),D(1),W(4,61,72,1),D(1),W(2,57,92,1),D(4),
+  M(1,68,82),X(3),D(1),W(2,63,64,3),D(1),M(4,59,117),D(1),M(1,66,117),X(2),N(4,54),
+  D(1),M(3,56,72),D(2),M(1,68,87),D(1),W(2,63,67,1),D(1),X(4),D(1),X(1),
+  D(1),M(3,56,77),D(2),M(1,68,92),W(2,63,97,3),D(1),M(2,64,64),D(1),W(3,56,97,3),D(1),
+  M(3,61,64),D(1),W(1,68,97,3),D(2),W(2,63,107,1),D(1),M(2,64,67),D(1),W(3,56,107,1),D(1),
+  M(3,61,67),D(1),W(1,68,107,1),D(2),M(2,63,117),D(1),M(2,64,72),D(1),M(3,56,117),D(1),
+  M(3,61,72),D(1),M(1,68,117),D(2),X(2),D(1),M(2,64,77),D(1),X(3),D(1),
+  M(3,61,77),D(1),X(1),D(3),W(1,59,64,3),M(2,64,82),D(1),W(3,61,97,3),D(5),W(1,59,67,1),
+  M(2,64,87),D(1),W(3,61,107,1),D(5),M(1,59,72),M(2,64,92),D(1),M(3,61,117),D(5),M(1,59,77),
+  M(2,64,97),D(1),X(3),D(5),M(1,59,82),M(2,64,107),W(3,66,64,3),W(4,58,64,3),D(5),W(1,59,97,3),
+  D(1),M(2,64,117),W(3,66,67,1),W(4,58,67,1),D(5),W(1,59,107,1),D(1),X(2),M(3,66,72),M(4,58,72),
+  D(5),M(1,59,117),D(1),W(2,64,97,3),M(3,66,77),M(4,58,77),D(5),W(1,62,64,3),D(1),W(2,64,107,1),
+  M(3,66,82),M(4,58,82),D(1),
   0
 };
 
 nohop static const byte bwv883f031[] = {
-  W(1,73,97,1),W(3,64,117,1),D(1),W(2,57,97,3),W(4,61,77,1),D(1),D(2),W(2,69,64,3),W(3,54,64,3),D(2),
-  W(1,73,107,1),X(3),D(1),W(2,57,107,1),W(4,61,82,1),D(1),W(4,61,97,3),D(2),W(2,69,67,1),W(3,54,67,1),
-  D(2),W(1,73,117,1),D(1),W(2,57,117,1),D(1),W(4,61,107,1),D(2),W(2,69,72,1),W(3,54,72,1),D(2),
-  X(1),D(1),X(2),D(1),W(4,61,117,1),D(2),W(2,69,77,1),W(3,54,77,1),D(3),W(1,73,97,3),
-  W(4,78,64,3),D(1),W(1,51,64,3),X(4),D(2),W(2,69,82,1),W(3,54,97,3),D(1),W(4,78,97,3),D(1),
-  D(1),W(1,73,107,1),D(1),W(1,51,67,1),D(2),W(2,69,87,1),W(3,54,107,1),D(1),W(4,78,107,1),D(2),
-  W(1,73,117,1),D(1),W(1,51,72,1),D(2),W(2,69,92,1),W(3,54,117,1),D(1),W(4,78,117,1),D(2),X(1),
-  D(1),W(1,51,77,1),D(2),W(2,69,97,1),X(3),D(1),X(4),D(2),W(3,71,64,3),D(1),
-  W(1,51,82,1),D(1),W(4,56,64,3),D(1),W(2,69,97,3),D(1),D(2),W(3,71,67,1),D(1),W(1,51,87,1),
-  D(1),W(1,51,97,3),W(4,56,67,1),D(1),W(2,69,107,1),D(3),W(3,71,72,1),D(2),W(1,51,107,1),
+  W(2,54,64,3),W(4,58,97,3),D(4),W(1,62,67,1),D(1),W(1,62,97,3),W(2,64,117,1),M(3,66,87),D(1),M(2,54,67),
+  W(4,58,107,1),D(2),M(1,61,64),D(3),W(1,62,107,1),X(2),M(3,66,92),D(1),M(2,54,72),M(4,58,117),
+  D(2),M(1,61,67),D(3),W(1,61,97,3),M(3,66,97),D(1),M(2,54,77),X(4),D(1),M(1,62,64),
+  D(1),W(4,59,64,3),D(3),W(1,61,107,1),M(3,66,107),D(1),M(2,54,82),D(1),M(1,62,67),D(1),
+  W(4,59,67,1),D(3),M(1,61,117),M(3,66,117),D(1),M(2,54,87),D(1),M(1,62,72),W(3,66,97,3),D(1),
+  M(4,59,72),D(3),X(1),D(1),M(2,54,92),D(1),M(1,62,77),W(3,66,107,1),D(1),M(4,59,77),
+  D(2),W(2,54,97,3),D(2),M(2,71,64),D(1),M(1,62,82),W(3,57,64,3),D(1),M(4,59,82),D(2),
+  W(2,54,107,1),W(4,59,97,3),D(2),M(2,71,67),D(1),M(1,62,87),W(3,57,67,1),D(3),W(1,78,82,3),M(2,54,117),
+  W(4,59,107,1),D(2),M(2,71,72),D(1),W(1,62,92,1),M(3,57,72),D(3),X(2),M(4,59,117),D(2),
+  W(1,78,82,3),M(2,71,77),D(1),W(1,62,97,1),M(3,57,77),D(3),X(4),D(1),W(4,64,64,3),D(1),
+  W(1,56,64,3),M(2,71,82),D(1),W(1,62,107,1),
   0
 };
 
 nohop static const byte bwv883f032[] = {
-  W(4,56,72,1),D(1),W(2,69,117,1),D(3),W(3,71,77,1),D(2),W(1,51,117,1),W(4,56,77,1),D(1),X(2),
-  D(1),W(1,68,64,3),W(2,59,64,3),D(2),W(3,71,82,1),D(2),W(1,68,97,3),W(4,56,82,1),D(1),D(1),
-  W(2,59,67,1),D(2),W(3,71,87,1),D(1),W(1,66,64,3),D(1),W(1,68,107,1),W(4,56,87,1),D(2),W(2,59,72,1),
-  D(1),W(1,66,97,3),D(1),W(3,71,92,1),D(2),W(1,68,117,1),W(4,56,92,1),D(2),W(2,59,77,1),D(1),
-  W(1,66,107,1),D(1),W(3,71,97,1),D(1),W(1,68,64,3),W(3,53,64,3),D(1),X(1),W(4,56,97,1),D(2),
-  W(2,59,97,3),D(1),W(1,66,117,1),D(1),W(1,68,97,3),W(3,71,97,3),D(1),W(3,53,67,1),W(4,56,97,3),D(1),
-  D(2),W(2,59,107,1),D(1),X(1),D(1),W(1,68,107,1),W(3,71,107,1),D(1),W(3,53,72,1),W(4,56,107,1),
-  D(3),W(2,59,117,1),D(1),D(1),W(1,68,117,1),W(3,71,117,1),D(1),W(3,53,77,1),W(4,56,117,1),D(3),
-  W(1,69,64,3),X(2),D(1),W(2,65,64,3),D(1),X(1),X(3),W(4,49,64,3),D(1),W(3,53,82,1),
-  X(4),D(1),W(3,53,97,3),D(1),D(1),W(1,69,67,1),D(1),W(2,65,67,1),D(1),
+  W(3,57,97,3),D(3),W(1,62,97,3),D(1),W(4,64,67,1),D(1),W(1,56,67,1),M(2,71,87),D(1),W(3,57,107,1),
+  D(3),M(1,62,107),D(1),W(4,64,97,3),D(1),M(1,56,72),M(2,71,92),D(1),M(3,57,117),D(3),
+  M(1,62,117),D(1),W(4,64,107,1),D(1),M(1,56,77),M(2,71,97),D(1),X(3),D(3),X(1),
+  D(1),W(3,68,64,3),M(4,64,117),D(1),W(1,56,97,3),W(2,71,97,3),W(4,52,64,3),D(5),W(3,68,67,1),X(4),
+  D(1),W(1,56,107,1),W(2,71,107,1),W(4,52,67,1),D(5),M(3,68,72),D(1),M(1,56,117),M(2,71,117),M(4,52,72),
+  D(5),M(3,68,77),D(1),X(1),X(2),M(4,52,77),D(3),W(1,69,64,3),D(2),W(2,61,64,3),
+  W(3,54,64,3),D(1),W(4,52,97,3),D(1),M(3,68,97),D(2),W(1,69,67,1),D(2),W(2,61,67,1),W(3,54,67,1),
+  D(1),W(4,52,107,1),D(1),M(3,68,107),D(2),M(1,69,72),D(2),M(2,61,72),M(3,54,72),D(1),
+  M(4,52,117),D(1),M(3,68,117),D(2),M(1,69,77),D(2),M(2,61,77),M(3,54,77),D(1),X(4),
+  D(1),X(3),D(2),M(1,69,82),W(4,73,64,3),D(2),W(1,57,64,3),M(2,61,82),M(3,54,82),D(4),
+  W(4,73,67,1),D(2),W(1,57,67,1),M(2,61,87),M(3,54,87),D(4),
   0
 };
 
 nohop static const byte bwv883f033[] = {
-  W(4,49,67,1),D(1),D(1),W(2,65,97,3),W(3,68,64,3),D(1),W(1,69,97,3),D(1),D(2),W(4,49,72,1),
-  D(2),W(2,65,107,1),W(3,68,67,1),D(1),W(1,69,107,1),D(3),W(4,49,77,1),D(1),W(1,69,64,3),D(1),
-  W(2,66,64,3),W(3,68,72,1),D(1),W(1,69,117,1),W(3,68,97,3),W(4,54,64,3),D(1),W(4,49,97,3),D(3),W(1,69,67,1),
-  D(1),W(2,66,67,1),D(1),X(1),W(3,68,107,1),W(4,54,67,1),D(1),W(4,49,107,1),D(2),W(1,69,97,3),
-  D(1),D(1),W(2,66,97,3),D(1),W(3,68,117,1),W(4,54,72,1),D(1),W(4,49,117,1),D(2),W(1,69,107,1),
-  D(2),W(2,66,107,1),D(1),X(3),W(4,54,77,1),D(1),X(4),D(2),W(1,66,64,3),D(2),
-  W(2,57,64,3),D(1),W(4,54,82,1),D(1),D(2),W(1,66,67,1),D(2),W(2,57,67,1),D(1),W(4,54,87,1),
-  D(3),W(1,66,72,1),D(1),W(1,78,82,3),D(1),W(2,57,72,1),D(1),W(4,54,92,1),D(3),W(1,66,77,1),
-  D(2),W(2,57,77,1),D(1),W(4,54,97,1),D(1),W(3,69,64,3),W(4,59,64,3),D(2),W(1,66,82,1),D(2),
-  W(1,68,64,3),W(2,57,82,1),D(1),W(4,54,107,1),D(1),W(3,69,67,1),W(4,59,67,1),D(1),
+  M(4,73,72),D(2),M(1,57,72),M(2,61,92),M(3,54,92),D(4),M(4,73,77),D(2),M(1,57,77),M(2,61,97),
+  M(3,54,97),D(3),W(2,66,64,3),W(4,73,97,3),D(1),W(1,50,64,3),D(1),M(4,57,64),D(1),M(3,54,107),
+  D(3),W(2,66,67,1),W(4,73,107,1),D(1),W(1,50,67,1),D(1),M(4,57,67),D(1),M(3,54,117),D(3),
+  M(2,66,72),M(4,73,117),D(1),M(1,50,72),D(1),W(4,57,97,3),D(1),X(3),D(3),M(2,66,77),
+  W(3,54,97,3),X(4),D(1),M(1,50,77),D(1),W(4,57,107,1),D(4),M(2,66,82),M(3,62,64),W(4,47,64,3),
+  D(1),M(1,50,82),D(1),W(4,57,117,1),D(1),W(1,50,97,3),D(3),M(2,66,87),W(3,62,67,1),M(4,47,67),
+  D(2),X(4),D(1),W(1,50,107,1),D(3),M(2,66,92),M(3,62,72),M(4,47,72),D(3),M(1,50,117),
+  D(3),M(2,66,97),M(3,62,77),M(4,47,77),D(3),X(1),D(2),W(1,59,64,3),W(2,68,64,3),W(3,62,97,3),
+  W(4,47,97,3),D(1),M(3,52,64),D(5),W(1,59,67,1),W(2,68,67,1),W(3,62,107,1),W(4,47,107,1),D(1),M(3,52,67),
+  D(4),W(2,68,64,3),D(1),M(1,59,72),W(2,66,117,1),M(3,62,117),M(4,47,117),D(1),M(3,52,72),D(4),
+  M(2,68,67),D(1),M(1,59,77),
   0
 };
 
 nohop static const byte bwv883f034[] = {
-  W(3,69,64,3),D(1),W(1,66,87,1),D(2),W(1,68,67,1),W(2,57,87,1),D(1),W(1,68,64,3),W(4,54,117,1),D(1),
-  W(4,59,72,1),D(1),W(3,69,67,1),D(1),W(1,66,92,1),D(2),W(2,57,92,1),D(1),W(1,68,67,1),W(3,69,97,3),
-  X(4),D(1),W(4,59,77,1),D(1),W(3,69,117,1),D(1),W(1,66,97,1),W(2,57,97,3),D(1),D(2),
-  W(1,68,72,1),W(3,69,107,1),D(1),W(4,59,82,1),D(1),X(3),W(4,59,97,3),D(1),W(1,66,97,3),W(2,57,107,1),
-  W(4,54,97,3),D(1),W(2,64,64,3),W(3,56,64,3),D(2),W(1,68,77,1),W(3,69,117,1),D(1),W(2,64,97,3),D(1),
-  W(4,59,107,1),D(1),W(1,66,107,1),W(2,57,117,1),W(4,54,107,1),D(1),W(3,56,67,1),D(2),W(1,68,82,1),X(3),
-  D(1),W(2,63,64,3),D(1),W(4,59,117,1),D(1),W(1,66,117,1),X(2),W(4,54,117,1),D(1),W(3,56,72,1),
-  D(2),W(1,68,87,1),D(1),W(2,63,67,1),D(1),X(4),D(1),X(1),X(4),D(1),
-  W(3,56,77,1),D(2),W(1,68,92,1),W(2,63,97,3),D(1),W(2,64,64,3),D(1),W(3,56,97,3),D(1),W(3,61,64,3),
-  D(1),W(1,68,97,3),D(1),D(1),W(2,63,107,1),D(1),W(2,64,67,1),D(1),
+  X(2),X(3),X(4),D(1),M(3,52,77),D(4),M(2,68,72),D(1),W(1,40,64,3),W(4,64,64,3),
+  D(1),M(3,52,82),D(1),M(1,59,97),D(3),M(2,68,77),D(1),W(1,40,67,1),W(4,64,67,1),D(1),
+  M(3,52,87),D(1),M(1,59,107),D(3),M(2,68,82),D(1),M(1,40,72),M(4,64,72),D(1),M(3,52,92),
+  D(1),M(1,59,117),D(3),M(2,68,87),D(1),M(1,40,77),M(4,64,77),D(1),M(3,52,97),D(1),
+  X(1),D(2),W(1,40,97,3),W(3,52,97,3),W(4,64,97,3),D(1),M(1,45,64),W(2,68,97,3),M(3,69,64),M(4,61,64),
+  D(5),W(1,40,107,1),W(3,52,107,1),W(4,64,107,1),D(1),M(1,45,67),W(2,68,107,1),M(3,69,67),M(4,61,67),D(5),
+  M(1,40,117),M(3,52,117),M(4,64,117),D(1),M(1,45,72),M(2,68,117),M(3,69,72),M(4,61,72),D(5),X(1),
+  X(3),X(4),D(1),M(1,45,77),X(2),M(3,69,77),M(4,61,77),D(4),W(2,57,64,3),D(2),
+  M(1,45,82),M(2,57,97),M(3,69,82),M(4,61,82),D(6),M(1,45,87),W(2,57,107,1),M(3,69,87),M(4,61,87),D(6),
+  M(1,45,92),M(2,57,117),M(3,69,92),M(4,61,92),D(3),W(1,45,97,3),D(3),X(2),M(3,69,97),M(4,61,97),
+  D(3),M(1,57,64),D(2),M(1,57,97),D(1),M(3,69,107),
   0
 };
 
 nohop static const byte bwv883f035[] = {
-  W(3,56,107,1),D(1),W(3,61,67,1),D(1),W(1,68,107,1),D(2),W(2,63,117,1),D(1),W(2,64,72,1),D(1),
-  W(3,56,117,1),D(1),W(3,61,72,1),D(1),W(1,68,117,1),D(2),X(2),D(1),W(2,64,77,1),D(1),
-  X(3),D(1),W(3,61,77,1),D(1),X(1),D(2),D(1),W(1,59,64,3),W(2,64,82,1),D(1),
-  W(3,61,97,3),D(1),D(1),D(3),W(1,59,67,1),W(2,64,87,1),D(1),W(3,61,107,1),D(5),W(1,59,72,1),
-  W(2,64,92,1),D(1),W(3,61,117,1),D(5),W(1,59,77,1),W(2,64,97,1),D(1),X(3),D(5),W(1,59,82,1),
-  W(2,64,107,1),W(3,66,64,3),W(4,58,64,3),D(1),D(4),W(1,59,97,3),D(1),W(2,64,117,1),W(3,66,67,1),W(4,58,67,1),
-  D(5),W(1,59,107,1),D(1),X(2),W(3,66,72,1),W(4,58,72,1),D(5),W(1,59,117,1),D(1),W(2,64,97,3),
-  W(3,66,77,1),W(4,58,77,1),D(1),D(4),W(1,62,64,3),D(1),W(2,64,107,1),W(3,66,82,1),W(4,58,82,1),D(1),
-  W(2,54,64,3),W(4,58,97,3),D(1),D(3),W(1,62,67,1),D(1),W(1,62,97,3),W(2,64,117,1),W(3,66,87,1),D(1),
-  W(2,54,67,1),W(4,58,107,1),D(2),W(1,61,64,3),D(3),W(1,62,107,1),X(2),
+  W(4,61,97,3),D(1),M(1,56,64),D(2),W(1,45,117,1),D(1),W(1,56,97,3),D(1),W(1,57,107,1),D(1),
+  M(3,69,117),W(4,61,107,1),D(1),W(1,57,64,3),D(2),X(1),D(1),M(1,57,97),D(1),M(1,56,64),
+  D(1),X(3),M(4,61,117),D(4),W(1,57,107,1),D(1),M(1,56,67),D(1),X(4),D(4),
+  M(1,57,117),D(1),M(1,56,72),D(5),X(1),D(1),M(1,56,77),D(4),W(1,56,97,3),D(4),
+  M(1,54,64),D(2),M(1,54,97),D(6),W(1,54,107,1),D(2),W(1,53,64,3),D(3),M(1,53,97),D(1),
+  W(1,54,117,1),D(5),M(1,53,107),D(1),X(1),D(5),M(1,53,117),D(6),W(1,49,64,3),W(2,61,64,3),
+  D(2),M(1,49,97),M(2,61,97),D(6),W(1,49,107,1),W(2,61,107,1),D(6),M(1,49,117),M(2,61,117),D(6),
+  X(1),X(2),D(3),W(1,54,64,3),W(2,61,64,3),D(4),W(4,59,64,3),D(2),W(1,54,67,1),M(2,61,97),
+  D(1),M(4,59,97),D(1),M(2,61,64),D(3),M(2,61,97),D(1),M(1,54,72),M(2,59,64),D(1),
+  W(4,59,107,1),D(4),W(2,61,107,1),D(1),M(1,54,77),M(2,59,67),D(1),M(4,59,117),D(4),M(2,61,117),
+  D(1),M(1,54,82),M(2,59,72),D(1),X(4),D(4),X(2),D(1),M(1,54,87),M(2,59,77),
+  D(6),M(1,54,92),M(2,59,82),D(1),W(2,59,97,3),
   0
 };
 
 nohop static const byte bwv883f036[] = {
-  W(3,66,92,1),D(1),W(2,54,72,1),W(4,58,117,1),D(2),W(1,61,67,1),D(3),W(1,61,97,3),W(3,66,97,1),D(1),
-  W(2,54,77,1),X(4),D(1),W(1,62,64,3),D(1),W(4,59,64,3),D(3),W(1,61,107,1),W(3,66,107,1),D(1),
-  W(2,54,82,1),D(1),W(1,62,67,1),D(1),W(4,59,67,1),D(3),W(1,61,117,1),W(3,66,117,1),D(1),W(2,54,87,1),
-  D(1),W(1,62,72,1),W(3,66,97,3),D(1),W(4,59,72,1),D(3),X(1),D(1),W(2,54,92,1),D(1),
-  W(1,62,77,1),W(3,66,107,1),D(1),W(4,59,77,1),D(2),W(2,54,97,3),D(1),D(1),W(2,71,64,3),D(1),
-  W(1,62,82,1),W(3,57,64,3),D(1),W(4,59,82,1),D(2),W(2,54,107,1),W(4,59,97,3),D(2),W(2,71,67,1),D(1),
-  W(1,62,87,1),W(3,57,67,1),D(3),W(1,78,82,3),W(2,54,117,1),W(4,59,107,1),D(2),W(2,71,72,1),D(1),W(1,62,92,1),
-  W(3,57,72,1),D(3),X(2),W(4,59,117,1),D(2),W(1,78,82,3),W(2,71,77,1),D(1),W(1,62,97,1),W(3,57,77,1),
-  D(3),X(4),D(1),W(4,64,64,3),D(1),W(1,56,64,3),W(2,71,82,1),D(1),W(1,62,107,1),W(3,57,97,3),
-  D(3),W(1,62,97,3),D(1),
+  D(1),M(2,57,64),D(3),M(2,57,97),D(1),M(1,54,97),D(1),W(2,59,107,1),D(4),W(2,56,64,3),
+  D(1),M(1,54,107),D(1),W(2,59,117,1),D(4),M(2,56,67),D(1),M(1,54,117),D(1),X(2),
+  D(4),M(2,56,72),D(1),X(1),D(5),M(2,56,77),D(3),W(4,74,64,3),D(1),W(3,69,97,3),
+  D(1),M(4,74,97),D(1),M(2,56,82),D(4),W(3,69,107,1),D(1),W(4,74,107,1),D(1),M(2,56,87),
+  D(4),M(3,69,117),D(1),M(4,74,117),D(1),M(2,56,92),D(4),X(3),D(1),X(4),
+  D(1),M(2,56,97),D(2),W(3,53,64,3),D(2),W(1,54,97,3),W(4,74,64,3),D(1),W(2,56,97,3),D(2),
+  M(1,73,64),D(1),W(3,53,67,1),D(1),M(1,73,97),D(1),W(1,54,107,1),W(4,74,67,1),D(1),W(1,74,64,3),
+  W(2,56,107,1),W(4,74,97,3),D(3),M(1,74,97),M(3,53,72),D(1),W(1,73,107,1),D(1),M(1,54,117),D(1),
+  W(1,73,64,3),M(2,56,117),W(4,74,107,1),D(3),W(1,74,107,1),M(3,53,77),D(1),M(1,73,117),D(1),X(1),
+  D(1),M(1,73,67),X(2),M(4,74,117),D(3),M(1,74,117),M(3,53,82),D(1),X(1),D(2),
+  M(1,73,72),X(4),D(2),W(2,52,64,3),W(3,53,97,3),W(4,61,64,3),D(1),X(1),D(3),M(1,73,77),
+  D(2),W(2,52,67,1),W(3,53,107,1),
   0
 };
 
 nohop static const byte bwv883f037[] = {
-  W(4,64,67,1),D(1),W(1,56,67,1),W(2,71,87,1),D(1),W(3,57,107,1),D(3),W(1,62,107,1),D(1),W(4,64,97,3),
-  D(1),W(1,56,72,1),W(2,71,92,1),D(1),W(3,57,117,1),D(3),W(1,62,117,1),D(1),W(4,64,107,1),D(1),
-  W(1,56,77,1),W(2,71,97,1),D(1),X(3),D(3),X(1),D(1),W(3,68,64,3),W(4,64,117,1),D(1),
-  W(1,56,97,3),W(2,71,97,3),W(4,52,64,3),D(1),D(3),D(1),W(3,68,67,1),X(4),D(1),W(1,56,107,1),
-  W(2,71,107,1),W(4,52,67,1),D(5),W(3,68,72,1),D(1),W(1,56,117,1),W(2,71,117,1),W(4,52,72,1),D(5),W(3,68,77,1),
-  D(1),X(1),X(2),W(4,52,77,1),D(3),W(1,69,64,3),D(2),W(2,61,64,3),W(3,54,64,3),D(1),
-  W(4,52,97,3),D(1),W(3,68,97,3),D(2),W(1,69,67,1),D(2),W(2,61,67,1),W(3,54,67,1),D(1),W(4,52,107,1),
-  D(1),W(3,68,107,1),D(2),W(1,69,72,1),D(2),W(2,61,72,1),W(3,54,72,1),D(1),W(4,52,117,1),D(1),
-  W(3,68,117,1),D(2),W(1,69,77,1),D(2),W(2,61,77,1),W(3,54,77,1),D(1),X(4),D(1),X(3),
-  D(2),W(1,69,82,1),W(4,73,64,3),D(2),W(1,57,64,3),W(2,61,82,1),
+  W(4,61,67,1),D(2),W(1,73,97,3),D(1),M(1,71,64),D(3),M(2,52,72),M(3,53,117),M(4,61,72),D(2),
+  W(1,73,107,1),D(1),M(1,71,67),D(1),W(1,71,97,3),D(2),M(1,70,64),M(2,52,77),X(3),M(4,61,77),
+  D(2),W(1,73,117,1),D(1),W(3,54,64,3),D(1),M(1,71,107),D(1),W(4,61,97,3),D(1),M(1,70,67),
+  W(2,52,97,3),D(2),X(1),D(1),W(3,54,67,1),D(1),M(1,71,117),D(1),W(4,61,107,1),D(1),
+  M(1,70,72),W(2,52,107,1),D(3),M(3,54,72),D(1),X(1),D(1),M(4,61,117),D(1),M(1,70,77),
+  M(2,52,117),D(3),W(1,70,97,3),M(3,54,77),D(1),M(1,50,64),W(2,66,64,3),D(1),X(4),D(1),
+  M(2,66,97),D(3),W(1,70,107,1),M(3,54,82),D(1),M(1,50,67),D(2),W(2,66,107,1),D(3),M(1,70,117),
+  M(3,54,87),D(1),M(1,50,72),D(2),M(2,66,117),D(3),X(1),M(3,54,92),D(1),M(1,50,77),
+  D(2),X(2),D(2),W(2,66,64,3),D(1),W(3,49,64,3),W(4,71,64,3),D(1),M(1,50,82),D(1),
+  W(1,50,97,3),D(1),M(1,64,64),M(3,54,97),D(2),M(1,64,97),W(2,66,67,1),D(1),W(2,66,97,3),W(3,49,67,1),
+  W(4,71,67,1),D(1),M(1,66,64),D(1),W(1,50,107,1),D(1),M(3,54,107),D(2),N(1,64),D(1),
   0
 };
 
 nohop static const byte bwv883f038[] = {
-  W(3,54,82,1),D(1),D(1),D(2),W(4,73,67,1),D(2),W(1,57,67,1),W(2,61,87,1),W(3,54,87,1),D(4),
-  W(4,73,72,1),D(2),W(1,57,72,1),W(2,61,92,1),W(3,54,92,1),D(4),W(4,73,77,1),D(2),W(1,57,77,1),W(2,61,97,1),
-  W(3,54,97,1),D(3),W(2,66,64,3),W(4,73,97,3),D(1),W(1,50,64,3),D(1),W(4,57,64,3),D(1),W(3,54,107,1),
-  D(3),W(2,66,67,1),W(4,73,107,1),D(1),W(1,50,67,1),D(1),W(4,57,67,1),D(1),W(3,54,117,1),D(3),
-  W(2,66,72,1),W(4,73,117,1),D(1),W(1,50,72,1),D(1),W(4,57,97,3),D(1),X(3),D(3),W(2,66,77,1),
-  W(3,54,97,3),X(4),D(1),W(1,50,77,1),D(1),W(4,57,107,1),D(4),W(2,66,82,1),W(3,62,64,3),W(4,47,64,3),
-  D(1),W(1,50,82,1),D(1),W(4,57,117,1),D(1),W(1,50,97,3),D(3),W(2,66,87,1),W(3,62,67,1),W(4,47,67,1),
-  D(2),X(4),D(1),W(1,50,107,1),D(3),W(2,66,92,1),W(3,62,72,1),W(4,47,72,1),D(2),D(1),
-  W(1,50,117,1),D(3),W(2,66,97,1),W(3,62,77,1),W(4,47,77,1),D(3),X(1),D(2),W(1,59,64,3),W(2,68,64,3),
-  W(3,62,97,3),W(4,47,97,3),D(1),
+  M(2,64,64),M(3,49,72),M(4,71,72),D(1),M(1,66,67),D(1),W(1,66,97,3),D(1),M(3,54,117),D(2),
+  W(1,64,117,1),D(1),W(2,64,67,1),M(3,49,77),M(4,71,77),D(2),M(1,66,107),D(1),X(3),D(1),
+  W(1,47,64,3),W(3,49,97,3),D(1),X(1),D(1),M(2,64,72),M(4,71,82),D(2),W(1,66,117,1),D(2),
+  M(1,47,67),W(3,49,107,1),D(2),M(2,64,77),M(4,71,87),D(2),X(1),W(2,64,97,3),D(1),M(2,62,64),
+  D(1),M(1,47,72),M(3,49,117),D(2),M(4,71,92),D(2),M(2,62,97),D(2),M(1,47,77),X(3),
+  D(2),M(4,71,97),D(1),W(1,47,97,3),D(1),W(2,62,107,1),D(1),M(1,61,64),W(2,52,64,3),D(3),
+  M(4,71,107),D(1),W(1,47,107,1),D(1),W(2,62,117,1),D(1),M(1,61,67),M(2,52,67),D(2),W(1,61,97,3),
+  D(1),M(4,71,117),D(1),W(1,47,117,1),D(1),X(2),D(1),M(2,52,72),D(2),M(1,61,107),
+  D(1),X(4),D(1),X(1),D(2),M(2,52,77),D(1),W(2,52,97,3),D(1),W(1,67,64,3),
+  D(1),M(2,49,64),D(2),M(1,67,97),D(2),W(2,52,107,1),D(1),X(1),D(1),M(2,49,67),
+  D(2),W(1,67,107,1),D(1),W(4,71,97,3),D(1),M(2,52,117),D(2),M(2,49,72),D(2),M(1,67,117),
+  D(1),W(4,71,107,1),D(1),X(2),D(2),M(2,49,77),
   0
 };
 
 nohop static const byte bwv883f039[] = {
-  W(3,52,64,3),D(3),D(2),W(1,59,67,1),W(2,68,67,1),W(3,62,107,1),W(4,47,107,1),D(1),W(3,52,67,1),D(4),
-  W(2,68,64,3),D(1),W(1,59,72,1),W(2,66,117,1),W(3,62,117,1),W(4,47,117,1),D(1),W(3,52,72,1),D(4),W(2,68,67,1),
-  D(1),W(1,59,77,1),X(2),X(3),X(4),D(1),W(3,52,77,1),D(4),W(2,68,72,1),D(1),
-  W(1,40,64,3),W(4,64,64,3),D(1),W(3,52,82,1),D(1),W(1,59,97,3),D(3),W(2,68,77,1),D(1),W(1,40,67,1),
-  W(4,64,67,1),D(1),W(3,52,87,1),D(1),W(1,59,107,1),D(3),W(2,68,82,1),D(1),W(1,40,72,1),W(4,64,72,1),
-  D(1),W(3,52,92,1),D(1),W(1,59,117,1),D(3),W(2,68,87,1),D(1),W(1,40,77,1),W(4,64,77,1),D(1),
-  W(3,52,97,1),D(1),X(1),D(2),W(1,40,97,3),W(3,52,97,3),W(4,64,97,3),D(1),W(1,45,64,3),W(2,68,97,3),
-  W(3,69,64,3),W(4,61,64,3),D(3),D(2),W(1,40,107,1),W(3,52,107,1),W(4,64,107,1),D(1),W(1,45,67,1),W(2,68,107,1),
-  W(3,69,67,1),W(4,61,67,1),D(5),W(1,40,117,1),W(3,52,117,1),W(4,64,117,1),D(1),W(1,45,72,1),W(2,68,117,1),
+  D(2),W(1,70,64,3),W(3,67,64,3),D(1),M(4,71,117),D(1),W(2,49,97,3),W(4,54,64,3),D(1),M(2,66,64),
+  D(3),W(1,70,67,1),M(2,66,97),W(3,67,67,1),D(1),W(3,67,97,3),X(4),D(1),W(2,49,107,1),W(4,54,67,1),
+  D(4),M(1,70,72),N(2,66),D(1),W(2,66,64,3),W(3,67,107,1),D(1),W(2,49,117,1),M(4,54,72),D(4),
+  M(1,70,77),N(2,66),D(1),M(2,66,67),M(3,67,117),D(1),X(2),M(4,54,77),D(4),M(1,70,82),
+  D(1),M(2,66,72),X(3),D(1),M(4,54,82),D(2),W(1,69,64,3),W(3,42,64,3),D(3),M(2,66,77),
+  D(1),W(2,66,97,3),W(4,54,97,3),D(2),W(1,69,67,1),W(3,42,67,1),D(4),M(2,64,64),W(4,54,107,1),D(2),
+  M(1,69,72),M(3,42,72),D(1),M(2,64,97),D(3),W(2,66,117,1),M(4,54,117),D(2),M(1,69,77),M(3,42,77),
+  D(1),M(2,64,107),D(3),W(2,47,64,3),W(4,63,64,3),D(1),W(3,42,97,3),D(1),M(1,69,82),D(1),
+  W(2,64,117,1),D(3),M(2,47,67),W(4,63,67,1),D(1),W(3,42,107,1),D(1),M(1,69,87),D(1),X(2),
+  D(3),W(1,69,97,3),M(2,47,72),M(4,63,72),D(1),M(3,42,117),D(1),W(4,63,97,3),D(4),W(1,69,107,1),
+  M(2,47,77),D(1),X(3),D(1),
   0
 };
 
 nohop static const byte bwv883f040[] = {
-  W(3,69,72,1),W(4,61,72,1),D(5),X(1),X(3),X(4),D(1),W(1,45,77,1),X(2),W(3,69,77,1),
-  W(4,61,77,1),D(4),W(2,57,64,3),D(1),D(1),W(1,45,82,1),W(2,57,97,3),W(3,69,82,1),W(4,61,82,1),D(1),
-  D(5),W(1,45,87,1),W(2,57,107,1),W(3,69,87,1),W(4,61,87,1),D(6),W(1,45,92,1),W(2,57,117,1),W(3,69,92,1),W(4,61,92,1),
-  D(3),W(1,45,97,3),D(3),X(2),W(3,69,97,1),W(4,61,97,1),D(3),W(1,57,64,3),D(2),W(1,57,97,3),
-  D(1),W(3,69,107,1),W(4,61,97,3),D(1),W(1,56,64,3),D(2),W(1,45,117,1),D(1),W(1,56,97,3),D(1),
-  W(1,57,107,1),D(1),W(3,69,117,1),W(4,61,107,1),D(1),W(1,57,64,3),D(2),X(1),D(1),W(1,57,97,3),
-  D(1),W(1,56,64,3),D(1),X(3),W(4,61,117,1),D(3),D(1),W(1,57,107,1),D(1),W(1,56,67,1),
-  D(1),X(4),D(4),W(1,57,117,1),D(1),W(1,56,72,1),D(1),D(4),X(1),D(1),
-  W(1,56,77,1),D(4),W(1,56,97,3),D(1),D(3),W(1,54,64,3),D(2),W(1,54,97,3),D(1),D(5),
-  W(1,54,107,1),D(2),W(1,53,64,3),D(3),W(1,53,97,3),D(1),W(1,54,117,1),D(5),W(1,53,107,1),D(1),
-  X(1),D(5),
+  W(4,63,107,1),D(2),W(1,71,64,3),D(1),W(3,59,64,3),D(1),M(1,71,97),M(2,47,82),D(1),M(3,59,97),
+  D(1),W(2,47,97,3),M(4,63,117),D(4),W(1,71,107,1),D(1),W(3,59,107,1),D(1),W(2,47,107,1),X(4),
+  D(4),M(1,71,117),D(1),M(3,59,117),D(1),M(2,47,117),D(4),W(1,71,64,3),D(1),X(3),
+  D(1),W(2,64,64,3),D(3),M(1,71,97),W(3,69,64,3),D(3),W(2,64,67,1),D(1),M(1,71,64),D(2),
+  W(1,71,107,1),M(3,69,97),D(1),M(3,69,64),D(2),M(2,64,72),D(1),W(1,71,97,3),D(2),W(1,71,117,1),
+  W(3,69,107,1),D(1),M(3,69,67),D(2),M(2,64,77),D(1),M(1,71,107),D(2),X(1),M(3,69,117),
+  D(1),M(3,69,72),D(2),W(1,49,64,3),M(2,64,82),D(1),W(1,71,117,1),D(2),X(3),D(1),
+  M(3,69,77),D(2),M(1,49,67),M(2,64,87),D(1),X(1),D(2),W(3,69,97,3),D(1),M(3,68,64),
+  D(2),M(1,49,72),M(2,64,92),D(3),W(3,69,107,1),D(1),M(3,68,67),D(2),M(1,49,77),M(2,64,97),
+  D(3),W(2,66,64,3),W(3,61,64,3),W(4,45,64,3),D(1),M(2,64,97),D(1),W(1,49,97,3),D(2),M(4,45,97),
+  D(2),W(2,66,67,1),W(3,61,67,1),D(1),M(2,64,107),D(1),W(1,49,107,1),D(2),
   0
 };
 
 nohop static const byte bwv883f041[] = {
-  W(1,53,117,1),D(1),D(5),W(1,49,64,3),W(2,61,64,3),D(2),W(1,49,97,3),W(2,61,97,3),D(1),D(3),
-  D(2),W(1,49,107,1),W(2,61,107,1),D(6),W(1,49,117,1),W(2,61,117,1),D(6),X(1),X(2),D(3),
-  W(1,54,64,3),W(2,61,64,3),D(3),D(1),W(4,59,64,3),D(2),W(1,54,67,1),W(2,61,97,3),D(1),W(4,59,97,3),
-  D(1),W(2,61,64,3),D(3),W(2,61,97,3),D(1),W(1,54,72,1),W(2,59,64,3),D(1),W(4,59,107,1),D(4),
-  W(2,61,107,1),D(1),W(1,54,77,1),W(2,59,67,1),D(1),W(4,59,117,1),D(4),W(2,61,117,1),D(1),W(1,54,82,1),
-  W(2,59,72,1),D(1),X(4),D(4),X(2),D(1),W(1,54,87,1),W(2,59,77,1),D(1),D(4),
-  D(1),W(1,54,92,1),W(2,59,82,1),D(1),W(2,59,97,3),D(1),W(2,57,64,3),D(3),W(2,57,97,3),D(1),
-  W(1,54,97,1),D(1),W(2,59,107,1),D(4),W(2,56,64,3),D(1),W(1,54,107,1),D(1),W(2,59,117,1),D(4),
-  W(2,56,67,1),D(1),W(1,54,117,1),D(1),X(2),D(4),W(2,56,72,1),D(1),X(1),D(1),
-  D(4),W(2,56,77,1),D(3),W(4,74,64,3),D(1),W(3,69,97,3),D(1),W(4,74,97,3),D(1),W(2,56,82,1),
-  D(4),W(3,69,107,1),D(1),
+  W(4,45,107,1),D(2),M(2,66,72),M(3,61,72),D(1),M(2,64,117),D(1),M(1,49,117),D(2),M(4,45,117),
+  D(2),M(2,66,77),M(3,61,77),D(1),X(2),D(1),X(1),W(3,61,97,3),D(1),W(1,61,64,3),
+  D(1),X(4),D(2),M(2,66,82),D(2),W(3,61,107,1),D(1),W(1,61,67,1),D(3),M(2,66,87),
+  D(2),M(3,61,117),D(1),W(1,61,97,3),D(3),M(2,66,92),D(2),X(3),D(1),W(1,61,107,1),
+  D(3),M(2,66,97),D(1),W(1,61,64,3),D(2),W(1,61,117,1),W(3,63,64,3),D(1),W(1,61,97,3),D(1),
+  M(1,59,64),D(1),M(2,66,107),D(3),M(1,59,97),W(3,63,67,1),D(1),W(1,61,107,1),D(1),W(1,61,64,3),
+  D(1),M(2,66,117),D(1),M(1,61,97),D(2),M(1,59,64),M(3,63,72),D(1),W(1,61,117,1),D(2),
+  X(2),D(1),M(1,61,107),D(2),M(1,59,67),M(3,63,77),D(1),X(1),D(3),M(1,61,117),
+  D(2),M(1,59,72),W(3,63,97,3),D(2),M(3,62,64),D(2),X(1),D(1),W(1,59,97,3),D(1),
+  W(3,63,107,1),D(2),M(3,62,67),D(3),M(1,57,64),D(1),M(3,63,117),D(1),M(1,57,97),D(1),
+  M(3,62,72),D(3),W(1,59,117,1),D(1),X(3),D(1),M(1,57,107),D(1),M(3,62,77),D(3),
+  X(1),D(1),W(1,64,64,3),W(4,56,64,3),D(1),W(1,57,117,1),D(1),
   0
 };
 
 nohop static const byte bwv883f042[] = {
-  W(4,74,107,1),D(1),W(2,56,87,1),D(4),W(3,69,117,1),D(1),W(4,74,117,1),D(1),W(2,56,92,1),D(4),
-  X(3),D(1),X(4),D(1),W(2,56,97,1),D(2),W(3,53,64,3),D(2),W(1,54,97,3),W(4,74,64,3),
-  D(1),W(2,56,97,3),D(1),D(1),W(1,73,64,3),D(1),W(3,53,67,1),D(1),W(1,73,97,3),D(1),
-  W(1,54,107,1),W(4,74,67,1),D(1),W(1,74,64,3),W(2,56,107,1),W(4,74,97,3),D(3),W(1,74,97,3),W(3,53,72,1),D(1),
-  W(1,73,107,1),D(1),W(1,54,117,1),D(1),W(1,73,64,3),W(2,56,117,1),W(4,74,107,1),D(3),W(1,74,107,1),W(3,53,77,1),
-  D(1),W(1,73,117,1),D(1),X(1),D(1),W(1,73,67,1),X(2),W(4,74,117,1),D(3),W(1,74,117,1),
-  W(3,53,82,1),D(1),X(1),D(1),D(1),W(1,73,72,1),X(4),D(2),W(2,52,64,3),W(3,53,97,3),
-  W(4,61,64,3),D(1),X(1),D(1),D(2),W(1,73,77,1),D(2),W(2,52,67,1),W(3,53,107,1),W(4,61,67,1),
-  D(1),D(1),W(1,73,97,3),D(1),W(1,71,64,3),D(3),W(2,52,72,1),W(3,53,117,1),W(4,61,72,1),D(2),
-  W(1,73,107,1),D(1),W(1,71,67,1),D(1),W(1,71,97,3),D(2),W(1,70,64,3),W(2,52,77,1),X(3),
+  M(3,62,82),D(1),M(4,56,97),D(3),M(1,64,67),D(1),X(1),D(1),M(3,62,87),D(1),
+  W(4,56,107,1),D(3),M(1,64,72),D(2),M(3,62,92),D(1),M(4,56,117),D(3),M(1,64,77),W(2,66,97,3),
+  D(2),W(3,62,97,3),D(1),X(4),D(2),M(2,52,64),M(3,61,64),D(1),M(1,64,82),W(2,66,107,1),
+  D(1),W(2,52,97,3),D(1),W(3,62,107,1),D(3),M(3,61,67),D(1),M(1,64,87),W(2,66,117,1),D(1),
+  M(2,52,107),W(3,61,97,3),D(1),W(3,62,117,1),D(1),W(2,59,64,3),D(3),M(1,64,92),X(2),D(1),
+  M(2,59,97),M(3,61,107),D(1),X(3),D(4),M(1,64,97),D(1),W(2,59,107,1),M(3,61,117),D(4),
+  W(2,57,64,3),W(3,61,64,3),D(1),M(1,64,107),D(1),W(2,59,117,1),X(3),D(4),M(2,57,67),W(3,61,67,1),
+  D(1),M(1,64,117),D(1),X(2),D(4),M(2,57,72),M(3,61,72),D(1),X(1),D(5),
+  M(2,57,77),M(3,61,77),D(3),W(1,64,97,3),D(1),M(1,69,64),W(4,66,64,3),D(2),M(2,57,82),M(3,61,82),
+  D(1),M(1,69,97),W(3,61,97,3),M(4,66,97),D(2),W(1,64,107,1),D(3),M(2,57,87),D(1),N(1,69),
+  W(3,61,107,1),W(4,66,107,1),D(2),M(1,64,117),D(3),M(2,57,92),D(1),N(1,69),M(3,61,117),M(4,66,117),
+  D(2),X(1),
   0
 };
 
 nohop static const byte bwv883f043[] = {
-  W(4,61,77,1),D(2),W(1,73,117,1),D(1),W(3,54,64,3),D(1),W(1,71,107,1),D(1),W(4,61,97,3),D(1),
-  W(1,70,67,1),W(2,52,97,3),D(2),X(1),D(1),W(3,54,67,1),D(1),W(1,71,117,1),D(1),W(4,61,107,1),
-  D(1),W(1,70,72,1),W(2,52,107,1),D(2),D(1),W(3,54,72,1),D(1),X(1),D(1),W(4,61,117,1),
-  D(1),W(1,70,77,1),W(2,52,117,1),D(3),W(1,70,97,3),W(3,54,77,1),D(1),W(1,50,64,3),W(2,66,64,3),D(1),
-  X(4),D(1),W(2,66,97,3),D(1),D(2),W(1,70,107,1),W(3,54,82,1),D(1),W(1,50,67,1),D(1),
-  D(1),W(2,66,107,1),D(3),W(1,70,117,1),W(3,54,87,1),D(1),W(1,50,72,1),D(2),W(2,66,117,1),D(3),
-  X(1),W(3,54,92,1),D(1),W(1,50,77,1),D(2),X(2),D(2),W(2,66,64,3),D(1),W(3,49,64,3),
-  W(4,71,64,3),D(1),W(1,50,82,1),D(1),W(1,50,97,3),D(1),W(1,64,64,3),W(3,54,97,3),D(2),W(1,64,97,3),
-  W(2,66,67,1),D(1),W(2,66,97,3),W(3,49,67,1),W(4,71,67,1),D(1),W(1,66,64,3),D(1),W(1,50,107,1),D(1),
-  W(3,54,107,1),D(2),W(1,64,107,1),D(1),W(2,64,64,3),W(3,49,72,1),W(4,71,72,1),D(1),
+  D(3),M(2,57,97),D(1),X(3),X(4),D(3),W(1,71,64,3),D(1),W(3,62,64,3),D(1),
+  M(2,57,107),D(3),M(3,62,97),D(1),W(1,71,67,1),D(2),M(2,57,117),D(3),W(3,62,107,1),D(1),
+  M(1,71,72),D(2),X(2),D(3),M(3,62,117),D(1),M(1,71,77),D(5),W(3,59,64,3),D(1),
+  M(1,71,82),D(3),M(3,59,97),D(3),M(1,71,87),D(3),W(3,59,107,1),D(3),M(1,71,92),D(3),
+  M(3,59,117),D(3),M(1,71,97),D(2),W(2,57,97,3),D(1),M(2,56,64),X(3),D(1),W(3,64,64,3),
+  D(2),M(1,71,107),M(2,56,97),D(2),W(2,57,107,1),D(2),W(3,64,67,1),D(2),M(1,71,117),N(2,56),
+  D(2),M(2,57,117),D(2),M(3,64,72),D(2),X(1),N(2,56),D(2),X(2),D(2),
+  M(3,64,77),D(6),W(1,71,97,3),W(2,68,64,3),M(3,64,82),W(4,52,64,3),D(3),M(2,68,97),M(4,52,97),D(3),
+  W(1,71,107,1),M(3,64,87),D(3),W(2,68,107,1),W(4,52,107,1),D(3),M(1,71,117),M(3,64,92),D(3),M(2,68,117),
+  M(4,52,117),D(3),X(1),M(3,64,97),D(3),X(2),X(4),D(2),W(1,73,64,3),D(1),
+  W(2,57,64,3),M(3,64,107),D(5),W(1,73,67,1),D(1),W(2,57,67,1),M(3,64,117),D(5),M(1,73,72),D(1),
+  M(2,57,72),X(3),D(5),M(1,73,77),D(1),M(2,57,77),D(4),
   0
 };
 
 nohop static const byte bwv883f044[] = {
-  W(1,66,67,1),D(1),W(1,66,97,3),D(1),W(3,54,117,1),D(2),W(1,64,117,1),D(1),W(2,64,67,1),W(3,49,77,1),
-  W(4,71,77,1),D(2),W(1,66,107,1),D(1),X(3),D(1),W(1,47,64,3),W(3,49,97,3),D(1),X(1),
-  D(1),W(2,64,72,1),W(4,71,82,1),D(2),W(1,66,117,1),D(1),D(1),W(1,47,67,1),W(3,49,107,1),D(1),
-  D(1),W(2,64,77,1),W(4,71,87,1),D(2),X(1),W(2,64,97,3),D(1),W(2,62,64,3),D(1),W(1,47,72,1),
-  W(3,49,117,1),D(2),W(4,71,92,1),D(2),W(2,62,97,3),D(2),W(1,47,77,1),X(3),D(2),W(4,71,97,1),
-  D(1),W(1,47,97,3),D(1),W(2,62,107,1),D(1),W(1,61,64,3),W(2,52,64,3),D(1),D(2),W(4,71,107,1),
-  D(1),W(1,47,107,1),D(1),W(2,62,117,1),D(1),W(1,61,67,1),W(2,52,67,1),D(2),W(1,61,97,3),D(1),
-  W(4,71,117,1),D(1),W(1,47,117,1),D(1),X(2),D(1),W(2,52,72,1),D(2),W(1,61,107,1),D(1),
-  X(4),D(1),X(1),D(1),D(1),W(2,52,77,1),D(1),W(2,52,97,3),D(1),W(1,67,64,3),
-  D(1),W(2,49,64,3),D(1),D(1),W(1,67,97,3),D(1),D(1),W(2,52,107,1),D(1),X(1),
-  D(1),W(2,49,67,1),D(2),W(1,67,107,1),D(1),
+  W(4,61,64,3),D(1),M(1,73,82),W(3,64,97,3),D(1),M(2,57,82),M(4,61,97),D(5),M(1,73,87),W(3,64,107,1),
+  D(1),M(2,57,87),W(4,61,107,1),D(5),M(1,73,92),M(3,64,117),D(1),M(2,57,92),M(4,61,117),D(5),
+  M(1,73,97),X(3),D(1),M(2,57,97),X(4),D(3),W(3,66,64,3),D(2),M(1,73,107),D(1),
+  M(2,57,107),D(3),W(3,66,67,1),D(2),M(1,73,117),D(1),M(2,57,117),D(1),W(2,57,97,3),D(2),
+  M(3,66,72),D(2),X(1),D(1),W(1,73,97,3),D(1),W(2,57,107,1),D(2),M(3,66,77),D(3),
+  W(1,73,107,1),D(1),M(2,57,117),D(1),W(1,54,64,3),W(2,69,64,3),D(1),M(3,66,82),D(3),W(1,73,117,1),
+  M(2,69,97),D(1),X(2),D(1),W(1,54,97,3),D(1),M(3,66,87),D(3),X(1),W(2,69,107,1),
+  D(2),W(1,54,107,1),D(1),M(3,66,92),D(3),M(2,69,117),D(2),M(1,54,117),D(1),M(3,66,97),
+  D(3),X(2),D(1),W(1,74,64,3),W(2,59,64,3),D(1),X(1),W(3,66,97,3),D(5),W(1,74,67,1),
+  W(2,59,67,1),D(1),W(3,66,107,1),D(5),M(1,74,72),M(2,59,72),D(1),M(3,66,117),D(5),M(1,74,77),
+  M(2,59,77),D(1),X(3),D(2),W(3,69,64,3),D(3),M(1,74,82),M(2,59,82),M(3,69,97),D(6),
+  M(1,74,87),
   0
 };
 
 nohop static const byte bwv883f045[] = {
-  W(4,71,97,3),D(1),W(2,52,117,1),D(1),D(1),W(2,49,72,1),D(2),W(1,67,117,1),D(1),W(4,71,107,1),
-  D(1),X(2),D(2),W(2,49,77,1),D(2),W(1,70,64,3),W(3,67,64,3),D(1),W(4,71,117,1),D(1),
-  W(2,49,97,3),W(4,54,64,3),D(1),W(2,66,64,3),D(3),W(1,70,67,1),W(2,66,97,3),W(3,67,67,1),D(1),W(3,67,97,3),
-  X(4),D(1),W(2,49,107,1),W(4,54,67,1),D(4),W(1,70,72,1),W(2,66,107,1),D(1),W(2,66,64,3),W(3,67,107,1),
-  D(1),W(2,49,117,1),W(4,54,72,1),D(4),W(1,70,77,1),W(2,66,117,1),D(1),W(2,66,67,1),W(3,67,117,1),D(1),
-  X(2),W(4,54,77,1),D(4),W(1,70,82,1),X(2),D(1),W(2,66,72,1),X(3),D(1),W(4,54,82,1),
-  D(2),W(1,69,64,3),W(3,42,64,3),D(2),D(1),W(2,66,77,1),D(1),W(2,66,97,3),W(4,54,97,3),D(1),
-  D(1),W(1,69,67,1),W(3,42,67,1),D(4),W(2,64,64,3),W(4,54,107,1),D(2),W(1,69,72,1),W(3,42,72,1),D(1),
-  W(2,64,97,3),D(3),W(2,66,117,1),W(4,54,117,1),D(2),W(1,69,77,1),W(3,42,77,1),D(1),W(2,64,107,1),D(3),
-  W(2,47,64,3),W(4,63,64,3),D(1),
+  M(2,59,87),W(3,69,107,1),D(6),M(1,74,92),M(2,59,92),M(3,69,117),D(6),M(1,74,97),M(2,59,97),X(3),
+  D(1),W(3,69,64,3),D(2),W(2,59,97,3),M(3,69,97),D(2),M(2,68,64),D(1),M(1,74,107),D(1),
+  M(2,68,97),D(1),M(2,69,64),D(1),W(2,59,107,1),W(3,69,107,1),D(3),M(1,74,117),W(3,68,64,3),D(1),
+  N(2,68),D(1),W(2,69,97,3),D(1),W(2,59,117,1),W(3,69,117,1),D(3),X(1),M(3,68,67),D(1),
+  N(2,68),D(1),M(2,69,107),D(1),X(2),X(3),D(3),W(2,56,64,3),M(3,68,72),D(1),
+  X(2),D(1),W(2,69,117,1),D(1),W(2,56,97,3),D(3),M(3,68,77),D(2),X(2),D(1),
+  W(2,56,107,1),D(2),W(2,66,64,3),D(1),W(3,68,97,3),D(3),W(2,56,117,1),D(2),M(2,66,67),D(1),
+  W(3,68,107,1),D(3),X(2),D(2),W(2,64,64,3),D(1),M(3,68,117),D(1),W(3,61,64,3),D(4),
+  W(2,64,67,1),D(1),X(3),D(1),W(3,61,67,1),D(4),M(2,64,72),D(2),M(3,61,72),D(4),
+  M(2,64,77),D(1),W(1,74,97,3),D(1),M(1,74,64),M(3,61,77),D(1),W(2,64,97,3),D(1),M(2,71,64),
+  D(2),M(1,74,97),D(1),W(1,74,107,1),D(1),M(3,61,82),D(1),W(2,64,107,1),D(1),M(2,71,67),
+  D(3),M(1,74,117),D(1),M(3,61,87),
   0
 };
 
 nohop static const byte bwv883f046[] = {
-  W(3,42,97,3),D(1),W(1,69,82,1),D(1),W(2,64,117,1),D(3),W(2,47,67,1),W(4,63,67,1),D(1),W(3,42,107,1),
-  D(1),W(1,69,87,1),D(1),X(2),D(3),W(1,69,97,3),W(2,47,72,1),W(4,63,72,1),D(1),W(3,42,117,1),
-  D(1),W(4,63,97,3),D(1),D(3),W(1,69,107,1),W(2,47,77,1),D(1),X(3),D(1),W(4,63,107,1),
-  D(2),W(1,71,64,3),D(1),W(3,59,64,3),D(1),W(1,71,97,3),W(2,47,82,1),D(1),W(3,59,97,3),D(1),
-  W(2,47,97,3),W(4,63,117,1),D(1),D(3),W(1,71,107,1),D(1),W(3,59,107,1),D(1),W(2,47,107,1),X(4),
-  D(4),W(1,71,117,1),D(1),W(3,59,117,1),D(1),W(2,47,117,1),D(4),W(1,71,64,3),D(1),X(3),
-  D(1),W(2,64,64,3),D(3),W(1,71,97,3),W(3,69,64,3),D(1),D(1),D(1),W(2,64,67,1),D(1),
-  W(1,71,64,3),D(2),W(1,71,107,1),W(3,69,97,3),D(1),W(3,69,64,3),D(2),W(2,64,72,1),D(1),W(1,71,97,3),
-  D(2),W(1,71,117,1),W(3,69,107,1),D(1),W(3,69,67,1),D(2),W(2,64,77,1),D(1),W(1,71,107,1),D(2),
-  X(1),W(3,69,117,1),D(1),W(3,69,72,1),D(2),W(1,49,64,3),W(2,64,82,1),D(1),W(1,71,117,1),D(2),
-  X(3),D(1),
+  D(1),M(2,64,117),D(1),M(2,71,72),D(3),X(1),D(1),M(3,61,92),D(1),X(2),
+  D(1),M(2,71,77),D(1),W(2,71,97,3),D(1),W(1,74,64,3),D(2),M(2,69,64),M(3,61,97),D(2),
+  W(4,73,64,3),D(1),W(2,71,107,1),D(1),M(1,74,97),D(2),M(2,69,67),M(3,61,107),D(1),M(4,73,97),
+  D(1),M(1,73,64),D(1),M(2,71,117),D(1),W(1,74,107,1),D(2),M(2,69,72),M(3,61,117),D(1),
+  W(4,73,107,1),D(1),M(1,73,67),D(1),X(2),D(1),M(1,74,117),D(2),M(2,69,77),X(3),
+  D(1),M(4,73,117),D(1),M(1,73,72),D(2),X(1),D(2),M(2,69,82),D(1),W(4,68,64,3),
+  D(1),M(1,73,77),D(1),W(2,69,97,3),D(3),W(1,73,97,3),D(1),W(4,68,67,1),D(2),W(2,69,107,1),
+  D(1),M(1,71,64),D(2),W(1,73,107,1),D(1),M(4,68,72),D(2),M(2,69,117),D(1),M(1,71,67),
+  D(2),M(1,73,117),D(1),M(4,68,77),D(1),W(2,69,64,3),D(1),X(2),W(4,68,97,3),D(1),
+  M(1,71,72),M(4,66,64),D(2),X(1),D(1),W(1,71,97,3),D(1),W(2,69,67,1),D(1),W(4,68,107,1),
+  D(1),M(4,66,67),D(3),W(1,71,107,1),D(1),M(2,69,72),D(1),M(4,68,117),D(1),M(4,66,72),
+  D(2),W(3,61,97,3),D(1),M(1,71,117),D(1),M(2,69,77),D(1),X(4),D(1),M(4,66,77),
   0
 };
 
 nohop static const byte bwv883f047[] = {
-  W(3,69,77,1),D(2),W(1,49,67,1),W(2,64,87,1),D(1),X(1),D(2),W(3,69,97,3),D(1),W(3,68,64,3),
-  D(2),W(1,49,72,1),W(2,64,92,1),D(1),D(2),W(3,69,107,1),D(1),W(3,68,67,1),D(2),W(1,49,77,1),
-  W(2,64,97,1),D(3),W(2,66,64,3),W(3,61,64,3),W(4,45,64,3),D(1),W(2,64,97,3),D(1),W(1,49,97,3),D(1),
-  D(1),W(4,45,97,3),D(2),W(2,66,67,1),W(3,61,67,1),D(1),W(2,64,107,1),D(1),W(1,49,107,1),D(2),
-  W(4,45,107,1),D(2),W(2,66,72,1),W(3,61,72,1),D(1),W(2,64,117,1),D(1),W(1,49,117,1),D(2),W(4,45,117,1),
-  D(2),W(2,66,77,1),W(3,61,77,1),D(1),X(2),D(1),X(1),W(3,61,97,3),D(1),W(1,61,64,3),
-  D(1),X(4),D(2),W(2,66,82,1),D(1),D(1),W(3,61,107,1),D(1),W(1,61,67,1),D(1),
-  D(2),W(2,66,87,1),D(2),W(3,61,117,1),D(1),W(1,61,97,3),D(3),W(2,66,92,1),D(2),X(3),
-  D(1),W(1,61,107,1),D(3),W(2,66,97,1),D(1),W(1,61,64,3),D(1),D(1),W(1,61,117,1),W(3,63,64,3),
-  D(1),W(1,61,97,3),D(1),W(1,59,64,3),D(1),W(2,66,107,1),D(3),W(1,59,97,3),W(3,63,67,1),D(1),
-  W(1,61,107,1),D(1),
+  D(2),W(3,61,107,1),D(1),W(1,64,64,3),W(2,69,97,3),W(3,61,64,3),D(1),W(4,66,97,3),D(1),M(3,61,97),
+  D(3),W(3,61,117,1),D(1),W(1,64,67,1),W(2,69,107,1),D(1),W(4,66,107,1),D(1),M(3,61,107),D(3),
+  X(3),D(1),M(1,64,72),M(2,69,117),D(1),M(4,66,117),D(1),M(3,61,117),D(2),W(1,64,97,3),
+  D(2),X(2),D(1),X(4),D(1),X(3),D(1),M(1,61,64),D(1),W(1,64,107,1),
+  D(1),W(2,62,64,3),W(3,78,64,3),D(3),W(1,61,97,3),W(4,59,64,3),D(2),W(1,64,117,1),D(1),W(2,62,67,1),
+  W(3,78,67,1),D(3),W(1,61,64,3),W(4,59,67,1),D(1),W(2,62,97,3),D(1),X(1),W(4,59,97,3),D(1),
+  M(2,59,64),M(3,78,72),D(3),M(1,61,97),D(1),W(2,62,107,1),D(1),W(4,59,107,1),D(1),M(2,59,67),
+  M(3,78,77),D(3),W(1,61,107,1),D(1),W(1,61,64,3),M(2,62,117),D(1),M(4,59,117),D(1),W(2,59,97,3),
+  M(3,78,82),D(3),W(1,61,117,1),D(1),M(1,61,67),X(2),D(1),X(4),D(1),W(2,59,107,1),
+  M(3,78,87),D(3),X(1),W(2,57,64,3),D(1),M(1,61,72),D(2),W(2,59,117,1),M(3,78,92),D(2),
+  W(2,57,97,3),D(2),M(1,61,77),D(2),X(2),M(3,78,97),D(2),W(2,57,107,1),
   0
 };
 
 nohop static const byte bwv883f048[] = {
-  W(1,61,64,3),D(1),W(2,66,117,1),D(1),W(1,61,97,3),D(1),D(1),W(1,59,64,3),W(3,63,72,1),D(1),
-  W(1,61,117,1),D(2),X(2),D(1),W(1,61,107,1),D(2),W(1,59,67,1),W(3,63,77,1),D(1),X(1),
-  D(3),W(1,61,117,1),D(2),W(1,59,72,1),W(3,63,97,3),D(1),D(1),W(3,62,64,3),D(2),X(1),
-  D(1),W(1,59,97,3),D(1),W(3,63,107,1),D(2),W(3,62,67,1),D(2),D(1),W(1,57,64,3),D(1),
-  W(3,63,117,1),D(1),W(1,57,97,3),D(1),W(3,62,72,1),D(3),W(1,59,117,1),D(1),X(3),D(1),
-  W(1,57,107,1),D(1),W(3,62,77,1),D(3),X(1),D(1),W(1,64,64,3),W(4,56,64,3),D(1),W(1,57,117,1),
-  D(1),W(3,62,82,1),D(1),W(4,56,97,3),D(1),D(1),D(1),W(1,64,67,1),D(1),X(1),
-  D(1),W(3,62,87,1),D(1),W(4,56,107,1),D(3),W(1,64,72,1),D(1),D(1),W(3,62,92,1),D(1),
-  W(4,56,117,1),D(3),W(1,64,77,1),W(2,66,97,3),D(2),W(3,62,97,3),D(1),X(4),D(2),W(2,52,64,3),
-  W(3,61,64,3),D(1),W(1,64,82,1),W(2,66,107,1),D(1),W(2,52,97,3),D(1),W(3,62,107,1),D(1),D(2),
-  W(3,61,67,1),D(1),W(1,64,87,1),W(2,66,117,1),D(1),W(2,52,107,1),
+  D(1),W(2,59,64,3),W(4,56,64,3),D(1),M(1,61,82),D(1),W(1,61,97,3),D(1),M(3,78,107),D(2),
+  W(2,57,117,1),D(1),M(2,59,67),W(4,56,67,1),D(2),W(1,61,107,1),D(1),M(3,78,117),D(2),X(2),
+  D(1),M(2,59,72),M(4,56,72),D(2),M(1,61,117),D(1),X(3),D(3),W(2,59,97,3),M(4,56,77),
+  D(2),X(1),D(2),W(1,76,64,3),D(2),W(2,59,107,1),M(4,56,82),D(3),M(1,76,97),D(3),
+  M(2,59,117),M(4,56,87),D(3),W(1,76,107,1),D(3),X(2),M(4,56,92),D(3),M(1,76,117),D(3),
+  M(4,56,97),D(3),X(1),D(1),W(1,76,64,3),D(1),W(2,58,64,3),W(3,66,64,3),D(1),M(4,56,107),
+  D(1),M(3,78,97),W(4,56,97,3),D(2),M(4,74,64),D(1),W(1,76,67,1),D(1),W(2,58,67,1),W(3,66,67,1),
+  D(1),W(1,76,97,3),M(4,74,97),D(1),M(1,76,64),M(3,78,107),W(4,56,107,1),D(4),M(2,58,72),M(3,66,72),
+  W(4,74,64,3),D(1),W(1,76,107,1),W(4,74,107,1),D(1),W(1,76,97,3),M(3,78,117),M(4,56,117),D(4),M(2,58,77),
+  M(3,66,77),M(4,74,67),D(1),W(1,76,117,1),M(4,74,117),D(1),M(1,76,107),X(3),X(4),D(4),
+  M(2,58,82),M(3,66,82),M(4,74,72),D(1),X(1),X(4),D(1),M(1,76,117),D(4),
   0
 };
 
 nohop static const byte bwv883f049[] = {
-  W(3,61,97,3),D(1),W(3,62,117,1),D(1),W(2,59,64,3),D(3),W(1,64,92,1),X(2),D(1),W(2,59,97,3),
-  W(3,61,107,1),D(1),X(3),D(4),W(1,64,97,1),D(1),W(2,59,107,1),W(3,61,117,1),D(1),D(3),
-  W(2,57,64,3),W(3,61,64,3),D(1),W(1,64,107,1),D(1),W(2,59,117,1),X(3),D(4),W(2,57,67,1),W(3,61,67,1),
-  D(1),W(1,64,117,1),D(1),X(2),D(4),W(2,57,72,1),W(3,61,72,1),D(1),X(1),D(1),
-  D(4),W(2,57,77,1),W(3,61,77,1),D(3),W(1,64,97,3),D(1),W(1,69,64,3),W(4,66,64,3),D(2),W(2,57,82,1),
-  W(3,61,82,1),D(1),W(1,69,97,3),W(3,61,97,3),W(4,66,97,3),D(2),W(1,64,107,1),D(3),W(2,57,87,1),D(1),
-  W(1,69,107,1),W(3,61,107,1),W(4,66,107,1),D(2),W(1,64,117,1),D(3),W(2,57,92,1),D(1),W(1,69,117,1),W(3,61,117,1),
-  W(4,66,117,1),D(2),X(1),D(3),W(2,57,97,1),D(1),X(1),X(3),X(4),D(2),
-  D(1),W(1,71,64,3),D(1),W(3,62,64,3),D(1),W(2,57,107,1),D(1),D(2),W(3,62,97,3),D(1),
-  W(1,71,67,1),D(2),W(2,57,117,1),D(3),W(3,62,107,1),D(1),W(1,71,72,1),D(2),X(2),D(3),
-  W(3,62,117,1),D(1),
+  M(2,58,87),M(3,66,87),M(4,74,77),D(2),X(1),D(4),M(2,58,92),M(3,66,92),M(4,74,82),D(4),
+  W(1,73,64,3),D(1),W(4,74,97,3),D(1),M(1,73,97),M(2,58,97),M(3,66,97),D(4),M(1,59,64),D(1),
+  W(4,74,107,1),D(1),W(1,73,107,1),M(2,58,107),M(3,66,107),W(4,74,64,3),D(1),W(2,58,97,3),D(3),M(1,59,67),
+  M(4,74,97),D(1),W(4,74,117,1),D(1),M(1,73,117),M(3,66,117),D(1),W(2,58,107,1),D(3),M(1,59,72),
+  M(4,74,107),D(1),X(4),D(1),X(1),X(3),D(1),M(2,58,117),D(3),M(1,59,77),
+  M(4,74,117),D(1),D(2),X(2),D(1),W(3,66,97,3),D(2),M(1,59,82),W(2,71,64,3),M(3,62,64),
+  X(4),D(4),M(3,62,97),D(2),M(1,59,87),W(2,71,67,1),D(4),W(3,62,107,1),D(2),M(1,59,92),
+  M(2,71,72),D(4),M(3,62,117),D(2),M(1,59,97),M(2,71,77),D(4),W(1,59,97,3),X(3),D(2),
+  M(1,62,64),M(2,71,82),D(1),W(2,71,97,3),W(3,76,64,3),W(4,55,64,3),D(3),M(1,62,97),D(1),M(1,61,64),
+  D(2),W(2,71,107,1),W(3,76,67,1),W(4,55,67,1),D(3),M(1,61,97),D(1),M(1,62,64),D(2),M(2,71,117),
+  M(3,76,72),M(4,55,72),D(2),M(1,62,97),W(2,61,64,3),D(1),
   0
 };
 
 nohop static const byte bwv883f050[] = {
-  W(1,71,77,1),D(5),W(3,59,64,3),D(1),W(1,71,82,1),D(3),W(3,59,97,3),D(1),D(1),D(1),
-  W(1,71,87,1),D(3),W(3,59,107,1),D(3),W(1,71,92,1),D(3),W(3,59,117,1),D(3),W(1,71,97,1),D(2),
-  W(2,57,97,3),D(1),W(2,56,64,3),X(3),D(1),W(3,64,64,3),D(2),W(1,71,107,1),W(2,56,97,3),D(1),
-  D(1),W(2,57,107,1),D(1),D(1),W(3,64,67,1),D(2),W(1,71,117,1),W(2,56,107,1),D(2),W(2,57,117,1),
-  D(2),W(3,64,72,1),D(2),X(1),W(2,56,117,1),D(2),X(2),D(2),W(3,64,77,1),D(2),
-  X(2),D(2),D(2),W(1,71,97,3),W(2,68,64,3),W(3,64,82,1),W(4,52,64,3),D(1),D(1),D(1),
-  W(2,68,97,3),W(4,52,97,3),D(3),W(1,71,107,1),W(3,64,87,1),D(3),W(2,68,107,1),W(4,52,107,1),D(3),W(1,71,117,1),
-  W(3,64,92,1),D(3),W(2,68,117,1),W(4,52,117,1),D(3),X(1),W(3,64,97,1),D(3),X(2),X(4),
-  D(2),W(1,73,64,3),D(1),W(2,57,64,3),W(3,64,107,1),D(3),D(2),W(1,73,67,1),D(1),W(2,57,67,1),
-  W(3,64,117,1),D(5),W(1,73,72,1),D(1),W(2,57,72,1),X(3),D(5),W(1,73,77,1),D(1),W(2,57,77,1),
-  D(4),W(4,61,64,3),D(1),
+  W(1,61,107,1),D(3),X(2),M(3,76,77),M(4,55,77),D(2),N(1,62),W(2,61,67,1),D(1),M(1,61,117),
+  D(3),M(3,76,82),M(4,55,82),D(2),N(1,62),M(2,61,72),D(1),X(1),D(3),M(3,76,87),
+  M(4,55,87),D(2),M(2,61,77),D(4),W(1,59,64,3),M(3,76,92),M(4,55,92),D(1),W(2,61,97,3),W(4,55,97,3),
+  D(2),M(1,59,97),D(3),M(3,76,97),D(1),W(2,61,107,1),W(4,55,107,1),D(2),M(1,58,64),W(2,54,64,3),
+  D(3),M(1,58,97),M(2,54,97),M(3,76,107),D(1),W(2,61,117,1),M(4,55,117),D(2),W(1,59,117,1),D(3),
+  M(1,58,107),M(2,54,107),M(3,76,117),D(1),X(2),X(4),D(2),X(1),D(3),M(1,58,117),
+  M(2,54,117),X(3),D(6),X(1),X(2),D(2),W(1,78,64,3),W(2,54,64,3),D(6),W(1,78,67,1),
+  W(2,54,67,1),D(1),W(2,54,97,3),D(5),M(1,78,72),D(1),W(2,54,107,1),D(5),M(1,78,77),D(1),
+  M(2,54,117),D(3),W(2,74,64,3),D(1),W(3,76,97,3),W(4,59,64,3),D(1),M(1,78,82),D(1),X(2),
+  D(1),W(1,78,97,3),D(2),W(2,74,67,1),D(1),W(3,76,107,1),W(4,59,67,1),D(3),W(1,78,107,1),D(2),
+  M(2,74,72),D(1),M(3,76,117),M(4,59,72),D(3),M(1,78,117),D(2),M(2,74,77),D(1),X(3),
   0
 };
 
 nohop static const byte bwv883f051[] = {
-  W(1,73,82,1),W(3,64,97,3),D(1),W(2,57,82,1),W(4,61,97,3),D(1),D(4),W(1,73,87,1),W(3,64,107,1),D(1),
-  W(2,57,87,1),W(4,61,107,1),D(5),W(1,73,92,1),W(3,64,117,1),D(1),W(2,57,92,1),W(4,61,117,1),D(5),W(1,73,97,1),
-  X(3),D(1),W(2,57,97,1),X(4),D(3),W(3,66,64,3),D(2),W(1,73,107,1),D(1),W(2,57,107,1),
-  D(3),W(3,66,67,1),D(2),W(1,73,117,1),D(1),W(2,57,117,1),D(1),W(2,57,97,3),D(1),D(1),
-  W(3,66,72,1),D(2),X(1),D(1),W(1,73,97,3),D(1),W(2,57,107,1),D(2),W(3,66,77,1),D(3),
-  W(1,73,107,1),D(1),W(2,57,117,1),D(1),W(1,54,64,3),W(2,69,64,3),D(1),W(3,66,82,1),D(3),W(1,73,117,1),
-  W(2,69,97,3),D(1),X(2),D(1),W(1,54,97,3),D(1),W(3,66,87,1),D(3),X(1),W(2,69,107,1),
-  D(1),D(1),W(1,54,107,1),D(1),W(3,66,92,1),D(3),W(2,69,117,1),D(2),W(1,54,117,1),D(1),
-  W(3,66,97,1),D(3),X(2),D(1),W(1,74,64,3),W(2,59,64,3),D(1),X(1),W(3,66,97,3),D(1),
-  D(3),D(1),W(1,74,67,1),W(2,59,67,1),D(1),W(3,66,107,1),D(5),W(1,74,72,1),W(2,59,72,1),D(1),
-  W(3,66,117,1),D(5),
+  M(4,59,77),D(2),W(2,74,97,3),D(1),X(1),D(1),W(1,55,64,3),M(2,71,64),D(2),M(4,59,82),
+  D(2),W(2,74,107,1),D(2),W(1,55,67,1),M(2,71,67),D(2),W(1,55,97,3),M(4,59,87),D(2),M(2,74,117),
+  D(2),M(2,71,72),D(2),W(1,55,107,1),M(4,59,92),D(2),X(2),D(2),M(2,71,77),D(2),
+  M(1,55,117),M(4,59,97),D(3),W(1,52,64,3),W(3,73,64,3),D(1),W(2,71,97,3),D(2),X(1),W(4,59,97,3),
+  D(3),W(1,52,67,1),W(3,73,67,1),D(1),W(2,71,107,1),D(1),W(1,52,97,3),D(1),W(4,59,107,1),D(3),
+  M(3,73,72),D(1),M(2,71,117),D(1),W(1,52,107,1),D(1),M(4,59,117),D(3),M(3,73,77),D(1),
+  X(2),D(1),M(1,52,117),D(1),X(4),D(2),W(1,49,64,3),D(1),M(3,73,82),D(2),
+  X(1),D(3),M(1,49,97),D(1),M(3,73,87),D(5),W(1,49,107,1),D(1),M(3,73,92),D(5),
+  M(1,49,117),D(1),M(3,73,97),D(3),W(1,58,64,3),D(1),W(2,54,64,3),D(1),X(1),W(3,73,97,3),
+  D(4),M(1,58,97),D(1),W(2,54,67,1),D(1),W(3,73,107,1),D(4),W(1,58,107,1),D(1),M(2,54,72),
+  D(1),M(3,73,117),D(4),M(1,58,117),D(1),M(2,54,77),D(1),X(3),D(4),W(1,66,64,3),
+  W(3,70,64,3),D(1),M(2,54,82),D(1),
   0
 };
 
 nohop static const byte bwv883f052[] = {
-  W(1,74,77,1),W(2,59,77,1),D(1),X(3),D(2),W(3,69,64,3),D(3),W(1,74,82,1),W(2,59,82,1),W(3,69,97,3),
-  D(1),D(5),W(1,74,87,1),W(2,59,87,1),W(3,69,107,1),D(6),W(1,74,92,1),W(2,59,92,1),W(3,69,117,1),D(6),
-  W(1,74,97,1),W(2,59,97,1),X(3),D(1),W(3,69,64,3),D(2),W(2,59,97,3),W(3,69,97,3),D(1),D(1),
-  W(2,68,64,3),D(1),W(1,74,107,1),D(1),W(2,68,97,3),D(1),W(2,69,64,3),D(1),W(2,59,107,1),W(3,69,107,1),
-  D(3),W(1,74,117,1),W(3,68,64,3),D(1),W(2,68,107,1),D(1),W(2,69,97,3),D(1),W(2,59,117,1),W(3,69,117,1),
-  D(3),X(1),W(3,68,67,1),D(1),W(2,68,117,1),D(1),W(2,69,107,1),D(1),X(2),X(3),
-  D(3),W(2,56,64,3),W(3,68,72,1),D(1),X(2),D(1),W(2,69,117,1),D(1),W(2,56,97,3),D(1),
-  D(2),W(3,68,77,1),D(1),D(1),X(2),D(1),W(2,56,107,1),D(2),W(2,66,64,3),D(1),
-  W(3,68,97,3),D(1),D(1),D(1),W(2,56,117,1),D(2),W(2,66,67,1),D(1),W(3,68,107,1),D(3),
-  X(2),D(2),W(2,64,64,3),D(1),W(3,68,117,1),D(1),W(3,61,64,3),D(2),D(2),W(2,64,67,1),
-  D(1),X(3),D(1),W(3,61,67,1),D(4),
+  M(1,66,97),M(3,70,97),D(5),M(2,54,87),D(1),W(1,66,107,1),W(3,70,107,1),D(5),M(2,54,92),D(1),
+  M(1,66,117),M(3,70,117),D(5),M(2,54,97),D(1),X(1),X(3),D(3),W(1,62,64,3),W(3,71,64,3),
+  D(2),M(2,54,107),D(1),M(1,62,97),D(3),W(3,71,67,1),D(2),M(2,54,117),D(1),W(1,62,107,1),
+  D(3),M(3,71,72),D(2),X(2),D(1),M(1,62,117),D(3),M(3,71,77),D(3),X(1),
+  D(1),W(1,74,64,3),W(4,59,64,3),D(2),M(3,71,82),D(1),M(1,74,97),D(3),W(4,59,67,1),D(2),
+  M(3,71,87),W(4,59,97,3),D(1),W(1,74,107,1),D(1),W(3,71,97,3),D(4),W(4,59,107,1),D(1),M(1,74,117),
+  D(1),W(3,71,107,1),D(4),M(4,59,117),D(1),X(1),D(1),W(1,67,64,3),M(3,71,117),D(1),
+  W(3,74,64,3),D(1),W(2,54,97,3),D(1),W(4,52,64,3),D(1),X(4),D(1),M(2,73,64),D(1),
+  W(1,67,67,1),X(3),D(1),W(3,74,67,1),D(1),W(2,54,107,1),D(1),W(3,74,97,3),W(4,52,67,1),D(1),
+  M(3,74,64),D(1),W(2,73,97,3),D(1),M(1,67,72),D(1),M(2,73,64),D(1),W(2,54,117,1),D(1),
+  W(3,74,107,1),M(4,52,72),D(1),M(3,74,67),D(1),M(2,73,107),D(1),M(1,67,77),D(1),M(2,73,67),
+  D(1),X(2),D(1),
   0
 };
 
 nohop static const byte bwv883f053[] = {
-  W(2,64,72,1),D(1),D(1),W(3,61,72,1),D(4),W(2,64,77,1),D(1),W(1,74,97,3),D(1),W(1,74,64,3),
-  W(3,61,77,1),D(1),W(2,64,97,3),D(1),W(2,71,64,3),D(2),W(1,74,97,3),D(1),W(1,74,107,1),D(1),
-  W(3,61,82,1),D(1),W(2,64,107,1),D(1),W(2,71,67,1),D(2),D(1),W(1,74,117,1),D(1),W(3,61,87,1),
-  D(1),W(2,64,117,1),D(1),W(2,71,72,1),D(2),D(1),X(1),D(1),W(3,61,92,1),D(1),
-  X(2),D(1),W(2,71,77,1),D(1),W(2,71,97,3),D(1),W(1,74,64,3),D(1),D(1),W(2,69,64,3),
-  W(3,61,97,1),D(1),D(1),W(4,73,64,3),D(1),W(2,71,107,1),D(1),W(1,74,97,3),D(1),D(1),
-  W(2,69,67,1),W(3,61,107,1),D(1),W(4,73,97,3),D(1),W(1,73,64,3),D(1),W(2,71,117,1),D(1),W(1,74,107,1),
-  D(2),W(2,69,72,1),W(3,61,117,1),D(1),W(4,73,107,1),D(1),W(1,73,67,1),D(1),X(2),D(1),
-  W(1,74,117,1),D(2),W(2,69,77,1),X(3),D(1),W(4,73,117,1),D(1),W(1,73,72,1),D(1),D(1),
-  X(1),D(2),W(2,69,82,1),D(1),W(4,68,64,3),D(1),W(1,73,77,1),D(1),W(2,69,97,3),D(1),
-  D(2),W(1,73,97,3),D(1),W(4,68,67,1),D(2),W(2,69,107,1),D(1),
+  M(3,74,117),M(4,52,77),D(1),M(3,74,72),D(1),M(2,73,117),D(1),M(1,67,82),D(1),M(2,73,72),
+  D(1),W(1,50,64,3),D(1),X(3),M(4,52,82),D(1),M(3,74,77),D(1),X(2),W(4,52,97,3),
+  D(1),W(1,67,87,1),D(1),M(2,73,77),D(1),M(1,50,67),D(2),M(3,74,82),D(1),W(2,73,97,3),
+  W(4,52,107,1),D(1),M(1,67,92),M(2,71,64),D(2),M(1,50,72),D(2),M(3,74,87),D(1),W(2,73,107,1),
+  M(4,52,117),D(1),M(1,67,97),M(2,71,67),D(2),M(1,50,77),D(1),W(2,71,97,3),W(3,74,97,3),D(2),
+  M(2,69,64),X(4),D(1),M(1,67,107),D(1),M(3,49,64),D(1),M(1,50,82),D(1),W(1,50,97,3),
+  W(2,71,107,1),W(3,74,107,1),D(2),M(2,69,67),D(2),M(3,49,67),D(1),W(1,67,107,1),D(1),N(1,50),
+  M(2,71,117),M(3,74,117),D(2),M(2,69,72),D(2),M(3,49,72),D(1),M(1,67,117),D(1),N(1,50),
+  X(2),X(3),D(2),M(2,69,77),D(2),M(3,49,77),D(1),X(1),D(1),W(3,49,97,3),
+  D(1),W(1,66,64,3),D(1),M(2,69,82),M(3,45,64),D(3),M(1,66,97),D(1),W(3,49,107,1),D(2),
+  M(2,69,87),M(3,45,67),D(3),M(1,64,64),D(1),M(3,49,117),D(2),M(2,69,92),M(3,45,72),D(1),
+  M(1,64,97),D(2),W(1,66,117,1),D(1),X(3),
   0
 };
 
 nohop static const byte bwv883f054[] = {
-  W(1,71,64,3),D(2),W(1,73,107,1),D(1),W(4,68,72,1),D(2),W(2,69,117,1),D(1),W(1,71,67,1),D(2),
-  W(1,73,117,1),D(1),W(4,68,77,1),D(1),W(2,69,64,3),D(1),X(2),W(4,68,97,3),D(1),W(1,71,72,1),
-  W(4,66,64,3),D(2),X(1),D(1),W(1,71,97,3),D(1),W(2,69,67,1),D(1),W(4,68,107,1),D(1),
-  W(4,66,67,1),D(2),D(1),W(1,71,107,1),D(1),W(2,69,72,1),D(1),W(4,68,117,1),D(1),W(4,66,72,1),
-  D(2),W(3,61,97,3),D(1),W(1,71,117,1),D(1),W(2,69,77,1),D(1),X(4),D(1),W(4,66,77,1),
-  D(2),W(3,61,107,1),D(1),W(1,64,64,3),W(2,69,97,3),W(3,61,64,3),D(1),W(4,66,97,3),D(1),W(3,61,97,3),
-  D(1),D(2),W(3,61,117,1),D(1),W(1,64,67,1),W(2,69,107,1),D(1),W(4,66,107,1),D(1),W(3,61,107,1),
-  D(3),X(3),D(1),W(1,64,72,1),W(2,69,117,1),D(1),W(4,66,117,1),D(1),W(3,61,117,1),D(2),
-  W(1,64,97,3),D(1),D(1),X(2),D(1),X(4),D(1),X(3),D(1),W(1,61,64,3),
-  D(1),W(1,64,107,1),D(1),W(2,62,64,3),W(3,78,64,3),D(1),D(1),D(1),W(1,61,97,3),W(4,59,64,3),
-  D(2),W(1,64,117,1),D(1),W(2,62,67,1),W(3,78,67,1),
+  D(2),M(2,69,97),M(3,45,77),D(1),M(1,64,107),D(2),W(1,66,64,3),W(3,45,97,3),D(1),M(3,50,64),
+  D(2),M(2,69,107),D(1),W(1,64,117,1),D(2),M(1,66,67),W(3,45,107,1),D(1),M(3,50,67),D(2),
+  M(2,69,117),D(1),X(1),D(2),M(1,66,72),M(3,45,117),D(1),M(3,50,72),D(2),X(2),
+  D(3),M(1,66,77),X(3),D(1),M(3,50,77),D(2),W(4,74,64,3),D(1),W(2,49,64,3),D(2),
+  M(1,66,82),D(1),M(3,50,82),M(4,74,97),D(1),M(2,69,97),D(2),W(2,49,67,1),D(2),M(1,66,87),
+  W(3,50,97,3),D(1),W(4,74,107,1),D(1),M(2,69,107),D(2),M(2,49,72),D(2),M(1,66,92),W(3,50,107,1),
+  D(1),M(4,74,117),D(1),M(2,69,117),D(2),M(2,49,77),D(2),M(1,66,97),M(3,50,117),D(1),
+  X(4),D(1),X(2),D(1),W(3,67,64,3),W(4,47,64,3),D(1),M(2,49,82),D(1),W(2,49,97,3),
+  D(1),M(1,66,107),X(3),D(3),W(3,67,67,1),W(4,47,67,1),D(2),W(2,49,107,1),D(1),M(1,66,117),
+  D(3),W(1,66,97,3),M(3,67,72),W(4,47,97,3),D(2),M(2,49,117),D(4),W(1,66,107,1),M(3,67,77),W(4,47,107,1),
+  D(2),X(2),D(2),W(1,71,64,3),W(2,50,64,3),D(2),W(1,66,117,1),M(3,67,82),M(4,47,117),D(2),
   0
 };
 
 nohop static const byte bwv883f055[] = {
-  D(3),W(1,61,64,3),W(4,59,67,1),D(1),W(2,62,97,3),D(1),X(1),W(4,59,97,3),D(1),W(2,59,64,3),
-  W(3,78,72,1),D(3),W(1,61,97,3),D(1),W(2,62,107,1),D(1),W(4,59,107,1),D(1),W(2,59,67,1),W(3,78,77,1),
-  D(3),W(1,61,107,1),D(1),W(1,61,64,3),W(2,62,117,1),D(1),W(4,59,117,1),D(1),W(2,59,97,3),W(3,78,82,1),
-  D(1),D(2),W(1,61,117,1),D(1),W(1,61,67,1),X(2),D(1),X(4),D(1),W(2,59,107,1),
-  W(3,78,87,1),D(3),X(1),W(2,57,64,3),D(1),W(1,61,72,1),D(1),D(1),W(2,59,117,1),W(3,78,92,1),
-  D(2),W(2,57,97,3),D(1),D(1),W(1,61,77,1),D(2),X(2),W(3,78,97,1),D(2),W(2,57,107,1),
-  D(1),W(2,59,64,3),W(4,56,64,3),D(1),W(1,61,82,1),D(1),W(1,61,97,3),D(1),W(3,78,107,1),D(2),
-  W(2,57,117,1),D(1),W(2,59,67,1),W(4,56,67,1),D(2),W(1,61,107,1),D(1),W(3,78,117,1),D(2),X(2),
-  D(1),W(2,59,72,1),W(4,56,72,1),D(2),W(1,61,117,1),D(1),X(3),D(2),D(1),W(2,59,97,3),
-  W(4,56,77,1),D(1),D(1),X(1),D(2),W(1,76,64,3),D(2),W(2,59,107,1),W(4,56,82,1),D(2),
-  D(1),W(1,76,97,3),D(1),D(2),
+  M(2,50,97),D(2),M(1,71,67),D(2),X(1),M(3,67,87),X(4),D(2),W(2,50,107,1),D(2),
+  M(1,71,72),D(2),M(3,67,92),D(2),M(2,50,117),D(2),M(1,71,77),D(2),M(3,67,97),D(2),
+  X(2),D(2),M(1,71,82),W(2,64,64,3),D(1),W(4,50,64,3),D(1),M(3,67,107),D(3),W(3,49,64,3),
+  D(1),M(1,71,87),W(2,64,67,1),D(1),W(4,50,67,1),D(1),W(3,67,117,1),D(1),W(4,50,97,3),D(1),
+  M(4,50,64),D(1),M(3,49,67),D(1),M(1,71,92),M(2,64,72),D(1),W(1,71,97,3),W(3,49,97,3),D(1),
+  M(1,49,64),X(3),D(1),M(4,50,97),D(3),M(2,64,77),D(1),W(1,71,107,1),W(3,49,107,1),D(1),
+  M(1,49,67),D(1),W(4,50,107,1),D(3),M(2,64,82),D(1),M(1,71,117),M(3,49,117),D(1),M(1,49,72),
+  D(1),M(4,50,117),D(1),W(3,73,64,3),D(2),M(2,64,87),D(1),X(1),M(3,73,97),D(1),
+  M(1,49,77),D(1),X(4),D(3),M(2,64,92),M(3,47,64),D(1),W(1,49,97,3),W(3,73,107,1),D(5),
+  M(2,64,97),W(3,47,97,3),D(1),W(1,49,107,1),W(3,73,117,1),D(5),W(1,46,64,3),M(2,64,107),W(3,66,64,3),D(1),
+  W(1,49,117,1),X(3),D(2),W(1,46,97,3),D(3),M(2,64,117),W(3,66,67,1),D(1),X(1),D(2),
   0
 };
 
 nohop static const byte bwv883f056[] = {
-  W(2,59,117,1),W(4,56,87,1),D(3),W(1,76,107,1),D(3),X(2),W(4,56,92,1),D(3),W(1,76,117,1),D(3),
-  W(4,56,97,1),D(3),X(1),D(1),W(1,76,64,3),D(1),W(2,58,64,3),W(3,66,64,3),D(1),W(4,56,107,1),
-  D(1),W(3,78,97,3),W(4,56,97,3),D(2),W(4,74,64,3),D(1),W(1,76,67,1),D(1),W(2,58,67,1),W(3,66,67,1),
-  D(1),W(1,76,97,3),W(4,74,97,3),D(1),W(1,76,64,3),W(3,78,107,1),W(4,56,107,1),D(4),W(2,58,72,1),W(3,66,72,1),
-  W(4,74,64,3),D(1),W(1,76,107,1),W(4,74,107,1),D(1),W(1,76,97,3),W(3,78,117,1),W(4,56,117,1),D(4),W(2,58,77,1),
-  W(3,66,77,1),W(4,74,67,1),D(1),W(1,76,117,1),W(4,74,117,1),D(1),W(1,76,107,1),X(3),X(4),D(4),
-  W(2,58,82,1),W(3,66,82,1),W(4,74,72,1),D(1),X(1),X(4),D(1),W(1,76,117,1),D(4),W(2,58,87,1),
-  W(3,66,87,1),W(4,74,77,1),D(1),D(1),X(1),D(4),W(2,58,92,1),W(3,66,92,1),W(4,74,82,1),D(2),
-  D(2),W(1,73,64,3),D(1),W(4,74,97,3),D(1),W(1,73,97,3),W(2,58,97,1),W(3,66,97,1),D(1),D(3),
-  W(1,59,64,3),D(1),W(4,74,107,1),
+  W(1,46,107,1),D(3),X(2),M(3,66,72),D(3),M(1,46,117),D(3),M(3,66,77),D(3),W(1,62,64,3),
+  W(2,64,97,3),D(1),M(2,42,64),D(2),M(3,66,82),D(2),M(1,62,97),M(2,42,97),D(1),W(2,64,107,1),
+  D(3),M(3,66,87),D(1),M(1,61,64),D(1),W(1,62,107,1),N(2,42),D(1),M(2,64,117),D(3),
+  W(1,61,97,3),M(3,66,92),D(2),W(1,62,117,1),N(2,42),D(1),X(2),D(3),M(1,61,107),M(3,66,97),
+  D(1),W(1,62,64,3),W(2,47,64,3),D(1),X(1),X(2),D(4),M(1,62,97),M(3,66,107),D(1),
+  W(2,47,67,1),D(3),W(3,67,97,3),D(2),W(1,62,107,1),W(3,66,117,1),D(1),M(2,47,72),W(3,66,97,3),D(3),
+  W(3,67,107,1),D(2),M(1,62,117),D(1),M(2,47,77),N(3,66),D(3),M(3,67,117),D(1),W(1,59,64,3),
+  D(1),X(1),D(1),M(2,47,82),N(3,66),D(2),M(1,59,97),D(1),X(3),D(3),
+  M(2,47,87),D(2),W(1,59,107,1),D(4),M(2,47,92),D(2),M(1,59,117),D(4),M(2,47,97),D(2),
+  W(1,62,64,3),D(2),M(1,62,97),D(2),M(1,61,64),M(2,47,107),D(3),M(1,61,97),D(1),M(1,62,64),
+  D(2),M(2,47,117),D(2),N(1,61),D(1),W(1,61,107,1),D(1),M(1,62,117),D(2),X(2),
+  D(2),M(1,61,67),D(1),M(1,61,117),D(1),X(1),D(4),
   0
 };
 
 nohop static const byte bwv883f057[] = {
-  D(1),W(1,73,107,1),W(2,58,107,1),W(3,66,107,1),W(4,74,64,3),D(1),W(2,58,97,3),D(3),W(1,59,67,1),W(4,74,97,3),
-  D(1),W(4,74,117,1),D(1),W(1,73,117,1),W(3,66,117,1),D(1),W(2,58,107,1),D(3),W(1,59,72,1),W(4,74,107,1),
-  D(1),X(4),D(1),X(1),X(3),D(1),W(2,58,117,1),D(3),W(1,59,77,1),W(4,74,117,1),
-  D(1),D(1),D(1),X(2),D(1),W(3,66,97,3),D(1),D(1),W(1,59,82,1),W(2,71,64,3),
-  W(3,62,64,3),X(4),D(3),D(1),W(3,62,97,3),D(1),D(1),W(1,59,87,1),W(2,71,67,1),D(4),
-  W(3,62,107,1),D(2),W(1,59,92,1),W(2,71,72,1),D(4),W(3,62,117,1),D(2),W(1,59,97,1),W(2,71,77,1),D(4),
-  W(1,59,97,3),X(3),D(2),W(1,62,64,3),W(2,71,82,1),D(1),W(2,71,97,3),W(3,76,64,3),W(4,55,64,3),D(3),
-  W(1,62,97,3),D(1),W(1,61,64,3),D(2),W(2,71,107,1),W(3,76,67,1),W(4,55,67,1),D(3),W(1,61,97,3),D(1),
-  W(1,62,64,3),D(2),W(2,71,117,1),W(3,76,72,1),W(4,55,72,1),D(2),W(1,62,97,3),W(2,61,64,3),D(1),W(1,61,107,1),
-  D(3),X(2),W(3,76,77,1),W(4,55,77,1),D(2),W(1,62,107,1),
+  M(1,61,72),D(1),X(1),D(3),W(2,47,97,3),W(3,45,64,3),D(1),W(4,65,64,3),D(1),M(1,61,77),
+  D(4),W(2,47,107,1),W(3,45,67,1),D(1),W(4,65,67,1),D(1),M(1,61,82),D(1),W(2,44,64,3),D(2),
+  W(3,45,97,3),D(1),M(2,44,97),D(1),M(4,65,72),D(1),M(1,61,87),D(3),W(3,45,107,1),D(1),
+  W(2,44,107,1),D(1),M(4,65,77),D(1),M(1,61,92),D(2),W(4,65,97,3),D(1),W(2,45,64,3),W(3,66,64,3),
+  D(1),W(2,44,117,1),D(2),M(1,61,97),D(2),W(4,65,107,1),D(1),M(2,45,67),W(3,66,67,1),D(1),
+  X(2),D(2),M(1,61,107),D(2),M(4,65,117),D(1),M(2,45,72),M(3,66,72),D(3),M(1,61,117),
+  D(2),X(4),D(1),M(2,45,77),M(3,66,77),D(3),X(1),D(3),M(2,45,82),M(3,66,82),
+  W(4,69,64,3),D(3),W(3,66,97,3),D(3),M(2,45,87),W(4,69,67,1),D(3),W(3,66,107,1),D(3),M(2,45,92),
+  M(4,69,72),D(3),M(3,66,117),D(3),M(2,45,97),M(4,69,77),D(3),X(3),D(2),W(1,63,64,3),
+  W(3,59,64,3),D(1),M(2,45,107),M(4,69,82),D(1),M(1,61,97),W(4,69,97,3),D(4),W(1,63,67,1),W(3,59,67,1),
+  D(1),M(2,45,117),D(1),M(1,61,107),W(4,69,107,1),D(1),W(1,63,97,3),D(3),
   0
 };
 
 nohop static const byte bwv883f058[] = {
-  W(2,61,67,1),D(1),W(1,61,117,1),D(3),W(3,76,82,1),W(4,55,82,1),D(2),W(1,62,117,1),W(2,61,72,1),D(1),
-  X(1),D(3),W(3,76,87,1),W(4,55,87,1),D(2),X(1),W(2,61,77,1),D(1),D(3),W(1,59,64,3),
-  W(3,76,92,1),W(4,55,92,1),D(1),W(2,61,97,3),W(4,55,97,3),D(1),D(1),W(1,59,97,3),D(1),D(2),
-  W(3,76,97,1),D(1),W(2,61,107,1),W(4,55,107,1),D(2),W(1,58,64,3),W(2,54,64,3),D(3),W(1,58,97,3),W(2,54,97,3),
-  W(3,76,107,1),D(1),W(2,61,117,1),W(4,55,117,1),D(2),W(1,59,117,1),D(3),W(1,58,107,1),W(2,54,107,1),W(3,76,117,1),
-  D(1),X(2),X(4),D(2),X(1),D(3),W(1,58,117,1),W(2,54,117,1),X(3),D(1),
-  D(2),D(3),X(1),X(2),D(2),W(1,78,64,3),W(2,54,64,3),D(4),D(2),W(1,78,67,1),
-  W(2,54,67,1),D(1),W(2,54,97,3),D(5),W(1,78,72,1),D(1),W(2,54,107,1),D(5),W(1,78,77,1),D(1),
-  W(2,54,117,1),D(3),W(2,74,64,3),D(1),W(3,76,97,3),W(4,59,64,3),D(1),W(1,78,82,1),D(1),X(2),
-  D(1),W(1,78,97,3),D(2),W(2,74,67,1),D(1),W(3,76,107,1),W(4,59,67,1),D(2),D(1),W(1,78,107,1),
-  D(2),
+  M(3,59,72),D(1),X(2),D(1),W(1,61,117,1),M(4,69,117),D(1),M(1,63,107),D(3),M(3,59,77),
+  D(2),X(1),X(4),D(1),M(1,63,117),W(2,45,97,3),D(1),W(1,44,64,3),M(2,66,64),D(2),
+  M(3,59,82),D(1),M(2,66,97),D(2),X(1),W(2,45,107,1),D(1),W(1,44,67,1),D(2),W(2,42,64,3),
+  M(3,59,87),D(1),W(1,44,97,3),W(2,66,107,1),D(2),M(2,45,117),D(1),W(2,42,97,3),D(2),M(3,59,92),
+  D(1),W(1,44,107,1),W(2,66,117,1),D(2),X(2),D(1),M(2,42,107),D(2),M(3,59,97),D(1),
+  W(1,44,64,3),W(2,71,64,3),D(3),W(2,42,117,1),D(2),M(1,44,97),M(3,59,107),D(1),X(1),M(2,71,67),
+  D(2),W(3,59,97,3),D(1),X(2),D(2),W(1,44,107,1),D(1),M(2,71,72),D(2),W(3,59,107,1),
+  D(3),M(1,44,117),D(1),M(2,71,77),D(2),M(3,59,117),D(3),W(1,68,64,3),W(3,40,64,3),D(1),
+  M(2,71,82),D(2),M(3,40,97),D(3),M(1,68,97),D(1),M(2,71,87),D(2),W(3,40,107,1),D(3),
+  W(1,68,107,1),D(1),M(2,71,92),D(2),M(3,40,117),D(3),M(1,68,117),D(1),M(2,71,97),D(2),
+  X(3),D(2),W(1,64,64,3),D(1),X(1),D(1),M(2,71,107),W(3,49,64,3),D(4),W(1,64,67,1),
+  D(1),M(3,49,97),D(1),M(2,71,117),D(4),
   0
 };
 
 nohop static const byte bwv883f059[] = {
-  W(2,74,72,1),D(1),W(3,76,117,1),W(4,59,72,1),D(3),W(1,78,117,1),D(2),W(2,74,77,1),D(1),X(3),
-  W(4,59,77,1),D(2),W(2,74,97,3),D(1),X(1),D(1),W(1,55,64,3),W(2,71,64,3),D(2),W(4,59,82,1),
-  D(2),W(2,74,107,1),D(1),D(1),W(1,55,67,1),W(2,71,67,1),D(2),W(1,55,97,3),W(4,59,87,1),D(2),
-  W(2,74,117,1),D(2),W(2,71,72,1),D(2),W(1,55,107,1),W(4,59,92,1),D(2),X(2),D(2),W(2,71,77,1),
-  D(2),W(1,55,117,1),W(4,59,97,1),D(2),D(1),W(1,52,64,3),W(3,73,64,3),D(1),W(2,71,97,3),D(1),
-  D(1),X(1),W(4,59,97,3),D(3),W(1,52,67,1),W(3,73,67,1),D(1),W(2,71,107,1),D(1),W(1,52,97,3),
-  D(1),W(4,59,107,1),D(3),W(3,73,72,1),D(1),W(2,71,117,1),D(1),W(1,52,107,1),D(1),W(4,59,117,1),
-  D(3),W(3,73,77,1),D(1),X(2),D(1),W(1,52,117,1),D(1),X(4),D(2),W(1,49,64,3),
-  D(1),W(3,73,82,1),D(1),D(1),X(1),D(1),D(2),W(1,49,97,3),D(1),W(3,73,87,1),
-  D(2),D(3),W(1,49,107,1),D(1),W(3,73,92,1),D(5),W(1,49,117,1),D(1),W(3,73,97,1),D(3),
-  W(1,58,64,3),D(1),W(2,54,64,3),D(1),X(1),
+  M(1,64,72),D(1),W(3,49,107,1),D(1),X(2),D(4),M(1,64,77),D(1),M(3,49,117),D(4),
+  W(3,37,64,3),W(4,69,64,3),D(1),M(1,64,82),D(1),X(3),D(1),M(3,37,97),D(2),M(4,69,97),
+  D(2),M(1,64,87),W(2,71,97,3),D(2),M(2,68,64),W(3,37,107,1),D(2),W(4,69,107,1),D(2),M(1,64,92),
+  M(2,68,97),D(2),M(3,37,117),D(2),M(4,69,117),D(2),M(1,64,97),W(2,68,107,1),D(1),W(2,69,64,3),
+  W(3,49,64,3),D(1),X(3),D(2),M(2,69,97),X(4),D(2),M(1,64,107),W(2,68,117,1),D(1),
+  W(3,49,67,1),D(3),M(2,69,107),D(2),M(1,64,117),X(2),D(1),M(3,49,72),D(3),M(2,69,117),
+  D(2),X(1),D(1),M(3,49,77),D(3),X(2),D(2),W(2,73,64,3),D(1),M(3,49,82),
+  D(2),M(2,73,97),D(4),M(3,49,87),D(2),W(2,73,107,1),D(4),M(3,49,92),D(2),M(2,73,117),
+  D(4),M(3,49,97),D(2),X(2),D(1),W(1,64,97,3),W(2,66,64,3),D(1),W(4,62,64,3),D(2),
+  M(3,49,107),D(3),W(1,64,107,1),W(2,66,67,1),D(1),W(4,62,67,1),D(2),M(3,49,117),D(2),W(2,66,97,3),
+  D(1),M(1,64,117),D(1),W(3,49,97,3),M(4,62,72),D(4),W(2,66,107,1),D(1),X(1),D(1),
+  W(3,49,107,1),M(4,62,77),D(3),W(1,47,64,3),
   0
 };
 
 nohop static const byte bwv883f060[] = {
-  W(3,73,97,3),D(1),D(3),W(1,58,97,3),D(1),W(2,54,67,1),D(1),W(3,73,107,1),D(4),W(1,58,107,1),
-  D(1),W(2,54,72,1),D(1),W(3,73,117,1),D(4),W(1,58,117,1),D(1),W(2,54,77,1),D(1),X(3),
-  D(4),W(1,66,64,3),W(3,70,64,3),D(1),W(2,54,82,1),D(1),W(1,66,97,3),W(3,70,97,3),D(4),D(1),
-  W(2,54,87,1),D(1),W(1,66,107,1),W(3,70,107,1),D(5),W(2,54,92,1),D(1),W(1,66,117,1),W(3,70,117,1),D(5),
-  W(2,54,97,1),D(1),X(1),X(3),D(3),W(1,62,64,3),W(3,71,64,3),D(2),W(2,54,107,1),D(1),
-  W(1,62,97,3),D(3),W(3,71,67,1),D(2),W(2,54,117,1),D(1),W(1,62,107,1),D(3),W(3,71,72,1),D(2),
-  X(2),D(1),W(1,62,117,1),D(3),W(3,71,77,1),D(3),X(1),D(1),W(1,74,64,3),W(4,59,64,3),
-  D(2),W(3,71,82,1),D(1),W(1,74,97,3),D(2),D(1),W(4,59,67,1),D(2),W(3,71,87,1),W(4,59,97,3),
-  D(1),W(1,74,107,1),D(1),W(3,71,97,3),D(4),W(4,59,107,1),D(1),W(1,74,117,1),D(1),W(3,71,107,1),
-  D(4),W(4,59,117,1),D(1),X(1),D(1),W(1,67,64,3),W(3,71,117,1),D(1),W(3,74,64,3),D(1),
-  W(2,54,97,3),D(1),
+  W(2,69,64,3),D(1),W(2,66,117,1),D(2),M(1,47,97),M(3,49,117),M(4,62,82),D(3),M(2,69,67),D(1),
+  X(2),D(2),M(1,45,64),X(3),M(4,62,87),D(3),M(2,69,72),D(2),M(1,45,97),D(1),
+  W(1,47,117,1),M(4,62,92),D(3),M(2,69,77),D(2),M(1,45,107),D(1),X(1),M(4,62,97),D(1),
+  W(1,74,64,3),W(3,47,64,3),D(1),W(2,69,97,3),D(1),M(3,47,97),D(2),W(1,45,117,1),D(1),M(4,62,107),
+  D(1),M(1,74,67),D(1),W(2,69,107,1),D(1),W(3,47,107,1),D(2),X(1),D(1),M(4,62,117),
+  D(1),M(1,74,72),D(1),M(2,69,117),D(1),M(3,47,117),D(3),X(4),D(1),M(1,74,77),
+  D(1),X(2),D(1),X(3),D(1),W(2,44,64,3),D(1),W(3,71,64,3),D(2),M(1,74,82),
+  D(1),M(2,44,97),D(3),W(3,71,67,1),D(2),M(1,74,87),D(1),W(2,44,107,1),D(3),M(3,71,72),
+  D(2),M(1,74,92),D(1),M(2,44,117),D(3),M(3,71,77),D(1),W(4,62,97,3),D(1),M(1,74,97),
+  D(1),X(2),D(1),W(2,41,64,3),W(3,71,97,3),M(4,68,64),D(3),M(4,68,97),D(1),W(1,74,97,3),
+  M(2,41,97),D(2),W(3,71,107,1),D(3),W(4,68,107,1),D(1),W(1,74,107,1),W(2,41,107,1),D(2),M(3,71,117),
+  D(3),M(4,68,117),D(1),M(1,74,117),M(2,41,117),D(2),
   0
 };
 
 nohop static const byte bwv883f061[] = {
-  W(4,52,64,3),D(1),X(4),D(1),W(2,73,64,3),D(1),W(1,67,67,1),X(3),D(1),W(3,74,67,1),
-  D(1),W(2,54,107,1),D(1),W(3,74,97,3),W(4,52,67,1),D(1),W(3,74,64,3),D(1),W(2,73,97,3),D(1),
-  W(1,67,72,1),D(1),W(2,73,64,3),D(1),W(2,54,117,1),D(1),W(3,74,107,1),W(4,52,72,1),D(1),W(3,74,67,1),
-  D(1),W(2,73,107,1),D(1),W(1,67,77,1),D(1),W(2,73,67,1),D(1),X(2),D(1),W(3,74,117,1),
-  W(4,52,77,1),D(1),W(3,74,72,1),D(1),W(2,73,117,1),D(1),W(1,67,82,1),D(1),W(2,73,72,1),D(1),
-  W(1,50,64,3),D(1),X(3),W(4,52,82,1),D(1),W(3,74,77,1),D(1),X(2),W(4,52,97,3),D(1),
-  W(1,67,87,1),D(1),W(2,73,77,1),D(1),W(1,50,67,1),D(1),D(1),W(3,74,82,1),D(1),W(2,73,97,3),
-  W(4,52,107,1),D(1),W(1,67,92,1),W(2,71,64,3),D(2),W(1,50,72,1),D(2),W(3,74,87,1),D(1),W(2,73,107,1),
-  W(4,52,117,1),D(1),W(1,67,97,1),W(2,71,67,1),D(2),W(1,50,77,1),D(1),W(2,71,97,3),W(3,74,97,3),D(2),
-  W(2,69,64,3),X(4),D(1),W(1,67,107,1),D(1),W(3,49,64,3),D(1),W(1,50,82,1),D(1),
+  X(3),D(3),X(4),D(1),X(1),X(2),D(1),W(1,74,64,3),W(2,56,64,3),W(3,65,64,3),
+  D(3),M(1,74,97),M(3,65,97),D(3),W(2,56,67,1),D(3),W(1,74,107,1),W(3,65,107,1),D(3),M(2,56,72),
+  D(3),M(1,74,117),M(3,65,117),D(3),M(2,56,77),D(2),W(1,74,64,3),D(1),X(1),X(3),
+  D(1),W(3,53,64,3),D(1),W(2,56,97,3),D(1),M(2,73,64),D(2),M(1,74,97),M(2,73,97),D(2),
+  M(1,74,64),W(3,53,67,1),D(1),W(2,56,107,1),D(3),M(1,74,97),W(2,73,64,3),D(2),M(3,53,72),D(1),
+  W(2,56,117,1),D(3),W(1,74,107,1),M(2,73,67),D(2),M(3,53,77),D(1),X(2),D(3),M(1,74,117),
+  M(2,73,72),W(3,53,97,3),D(2),W(1,68,64,3),D(2),M(3,49,64),D(2),X(1),M(2,73,77),W(3,53,107,1),
+  D(2),W(1,68,67,1),D(2),M(3,49,67),D(2),W(2,73,97,3),M(3,53,117),D(1),M(2,71,64),D(1),
+  M(1,68,72),D(2),M(3,49,72),D(2),W(2,73,107,1),X(3),D(1),M(2,71,67),D(1),M(1,68,77),
+  D(2),W(2,71,97,3),M(3,49,77),D(2),M(2,69,64),D(1),W(4,54,64,3),D(1),M(1,68,82),D(2),
+  W(2,71,107,1),W(3,49,97,3),D(2),M(2,69,67),D(1),W(4,54,67,1),D(1),M(1,68,87),D(2),M(2,71,117),
   0
 };
 
 nohop static const byte bwv883f062[] = {
-  W(1,50,97,3),W(2,71,107,1),W(3,74,107,1),D(2),W(2,69,67,1),D(2),W(3,49,67,1),D(1),W(1,67,107,1),D(1),
-  W(1,50,107,1),W(2,71,117,1),W(3,74,117,1),D(2),W(2,69,72,1),D(2),W(3,49,72,1),D(1),W(1,67,117,1),D(1),
-  W(1,50,117,1),X(2),X(3),D(2),W(2,69,77,1),D(2),W(3,49,77,1),D(1),X(1),D(1),
-  X(1),W(3,49,97,3),D(1),W(1,66,64,3),D(1),W(2,69,82,1),W(3,45,64,3),D(3),W(1,66,97,3),D(1),
-  W(3,49,107,1),D(2),W(2,69,87,1),W(3,45,67,1),D(3),W(1,64,64,3),D(1),W(3,49,117,1),D(2),W(2,69,92,1),
-  W(3,45,72,1),D(1),W(1,64,97,3),D(1),D(1),W(1,66,117,1),D(1),X(3),D(2),W(2,69,97,1),
-  W(3,45,77,1),D(1),W(1,64,107,1),D(2),W(1,66,64,3),W(3,45,97,3),D(1),W(3,50,64,3),D(2),W(2,69,107,1),
-  D(1),W(1,64,117,1),D(2),W(1,66,67,1),W(3,45,107,1),D(1),W(3,50,67,1),D(2),W(2,69,117,1),D(1),
-  X(1),D(2),W(1,66,72,1),W(3,45,117,1),D(1),W(3,50,72,1),D(2),X(2),D(1),D(2),
-  W(1,66,77,1),X(3),D(1),W(3,50,77,1),D(2),W(4,74,64,3),D(1),W(2,49,64,3),D(2),W(1,66,82,1),
-  D(1),
+  W(3,49,107,1),D(2),M(2,69,72),D(1),M(4,54,72),D(1),M(1,68,92),D(2),X(2),M(3,49,117),
+  D(2),M(2,69,77),D(1),M(4,54,77),D(1),M(1,68,97),W(3,66,64,3),D(2),W(1,56,64,3),X(3),
+  D(2),M(2,69,82),D(1),M(3,66,97),W(4,54,97,3),D(1),W(1,68,107,1),D(2),M(1,56,67),D(2),
+  M(2,69,87),M(3,65,64),D(1),W(3,66,107,1),W(4,54,107,1),D(1),M(1,68,117),D(1),W(1,68,97,3),W(3,65,97,3),
+  D(1),W(1,56,72,1),D(2),M(2,69,92),D(1),W(3,66,117,1),M(4,54,117),D(2),M(1,68,107),M(3,65,107),
+  D(1),M(1,56,77),D(1),W(1,66,64,3),D(1),M(2,69,97),W(3,57,64,3),D(1),X(3),X(4),
+  D(1),M(1,66,97),D(1),W(1,68,117,1),W(3,65,117,1),D(2),M(1,56,107),D(1),M(2,69,107),M(3,57,67),
+  D(2),N(1,66),D(1),X(1),X(3),D(2),M(1,56,117),D(1),M(2,69,117),M(3,57,72),
+  D(2),N(1,66),D(3),X(1),D(1),X(2),M(3,57,77),D(3),W(3,57,97,3),D(1),
+  W(1,63,64,3),W(4,54,64,3),D(4),M(1,63,97),D(1),W(3,57,107,1),D(1),W(4,54,67,1),D(4),W(1,63,107,1),
+  D(1),M(3,57,117),D(1),M(4,54,72),D(4),M(1,63,117),D(1),X(3),D(1),M(4,54,77),
+  D(4),X(1),D(1),W(1,60,64,3),D(1),
   0
 };
 
 nohop static const byte bwv883f063[] = {
-  W(3,50,82,1),W(4,74,97,3),D(1),W(2,69,97,3),D(2),W(2,49,67,1),D(2),W(1,66,87,1),W(3,50,97,3),D(1),
-  W(4,74,107,1),D(1),W(2,69,107,1),D(2),W(2,49,72,1),D(2),W(1,66,92,1),W(3,50,107,1),D(1),W(4,74,117,1),
-  D(1),W(2,69,117,1),D(2),W(2,49,77,1),D(2),W(1,66,97,1),W(3,50,117,1),D(1),X(4),D(1),
-  X(2),D(1),W(3,67,64,3),W(4,47,64,3),D(1),W(2,49,82,1),D(1),W(2,49,97,3),D(1),W(1,66,107,1),
-  X(3),D(1),D(1),D(1),W(3,67,67,1),W(4,47,67,1),D(2),W(2,49,107,1),D(1),W(1,66,117,1),
-  D(3),W(1,66,97,3),W(3,67,72,1),W(4,47,97,3),D(1),D(1),W(2,49,117,1),D(4),W(1,66,107,1),W(3,67,77,1),
-  W(4,47,107,1),D(2),X(2),D(2),W(1,71,64,3),W(2,50,64,3),D(2),W(1,66,117,1),W(3,67,82,1),W(4,47,117,1),
-  D(2),W(2,50,97,3),D(1),D(1),W(1,71,67,1),D(2),X(1),W(3,67,87,1),X(4),D(2),
-  W(2,50,107,1),D(2),W(1,71,72,1),D(2),W(3,67,92,1),D(2),W(2,50,117,1),D(2),W(1,71,77,1),D(2),
-  W(3,67,97,1),D(2),X(2),D(2),W(1,71,82,1),W(2,64,64,3),D(1),W(4,50,64,3),D(1),
+  W(3,56,64,3),W(4,54,97,3),D(5),W(1,60,67,1),D(1),W(3,56,67,1),W(4,54,107,1),D(5),M(1,60,72),D(1),
+  M(3,56,72),M(4,54,117),D(5),M(1,60,77),W(3,56,97,3),D(1),X(4),D(4),M(3,68,64),D(1),
+  M(1,60,82),W(3,56,107,1),D(1),W(4,44,64,3),D(2),W(2,69,97,3),D(2),M(3,68,67),D(1),M(1,60,87),
+  M(3,56,117),D(1),W(4,44,67,1),D(1),W(3,68,97,3),D(1),M(2,66,64),D(3),M(1,60,92),M(2,66,97),
+  X(3),D(1),M(4,44,72),D(1),W(3,68,107,1),D(1),W(2,69,117,1),D(3),M(1,60,97),M(2,66,107),
+  D(1),M(4,44,77),D(1),W(2,68,64,3),M(3,68,117),D(1),X(2),D(3),M(1,60,107),W(2,66,117,1),
+  D(1),W(2,68,97,3),M(4,44,82),D(1),X(3),D(4),M(1,60,117),X(2),D(1),W(2,68,107,1),
+  M(4,44,87),D(5),X(1),D(1),M(2,68,117),M(4,44,92),D(4),W(1,60,97,3),D(1),M(1,60,64),
+  W(2,56,64,3),D(1),X(2),W(3,63,64,3),M(4,44,97),D(2),M(2,56,97),D(1),M(3,63,97),D(1),
+  W(1,60,107,1),D(1),M(1,60,67),D(1),M(4,44,107),D(2),W(2,56,107,1),D(1),W(3,63,107,1),D(1),
+  M(1,60,117),D(1),M(1,60,72),D(1),M(4,44,117),D(2),M(2,56,117),D(1),M(3,63,117),D(1),
+  X(1),D(1),
   0
 };
 
 nohop static const byte bwv883f064[] = {
-  W(3,67,107,1),D(2),D(1),W(3,49,64,3),D(1),W(1,71,87,1),W(2,64,67,1),D(1),W(4,50,67,1),D(1),
-  W(3,67,117,1),D(1),W(4,50,97,3),D(1),W(4,50,64,3),D(1),W(3,49,67,1),D(1),W(1,71,92,1),W(2,64,72,1),
-  D(1),W(1,71,97,3),W(3,49,97,3),D(1),W(1,49,64,3),X(3),D(1),W(4,50,97,3),D(3),W(2,64,77,1),
-  D(1),W(1,71,107,1),W(3,49,107,1),D(1),W(1,49,67,1),D(1),W(4,50,107,1),D(3),W(2,64,82,1),D(1),
-  W(1,71,117,1),W(3,49,117,1),D(1),W(1,49,72,1),D(1),W(4,50,117,1),D(1),W(3,73,64,3),D(2),W(2,64,87,1),
-  D(1),X(1),W(3,73,97,3),D(1),W(1,49,77,1),D(1),X(4),D(3),W(2,64,92,1),W(3,47,64,3),
-  D(1),W(1,49,97,3),W(3,73,107,1),D(2),D(3),W(2,64,97,1),W(3,47,97,3),D(1),W(1,49,107,1),W(3,73,117,1),
-  D(5),W(1,46,64,3),W(2,64,107,1),W(3,66,64,3),D(1),W(1,49,117,1),X(3),D(2),W(1,46,97,3),D(3),
-  W(2,64,117,1),W(3,66,67,1),D(1),X(1),D(2),W(1,46,107,1),D(3),X(2),W(3,66,72,1),D(1),
-  D(2),W(1,46,117,1),D(3),W(3,66,77,1),D(3),W(1,62,64,3),W(2,64,97,3),D(1),
+  M(1,60,77),D(1),X(4),D(2),X(2),D(1),X(3),D(1),W(1,60,97,3),W(2,52,64,3),
+  D(1),M(1,64,64),W(3,61,64,3),D(1),M(2,52,97),D(1),M(1,64,97),M(3,61,97),D(3),W(1,60,107,1),
+  D(2),W(2,52,107,1),D(1),N(1,64),W(3,61,107,1),D(3),M(1,60,117),D(2),M(2,52,117),D(1),
+  N(1,64),M(3,61,117),D(3),X(1),D(2),X(2),D(1),X(3),D(1),W(1,49,64,3),
+  W(2,76,64,3),D(3),M(1,49,97),M(2,76,97),D(6),W(1,49,107,1),W(2,76,107,1),D(2),W(4,44,97,3),D(4),
+  M(1,49,117),M(2,76,117),D(2),W(4,44,107,1),D(4),X(1),X(2),D(2),M(4,44,117),D(1),
+  W(1,76,64,3),W(2,57,64,3),D(4),M(1,76,97),W(3,75,64,3),D(1),X(4),D(1),W(2,57,67,1),D(4),
+  W(1,76,107,1),M(3,75,97),D(1),W(1,75,64,3),D(1),M(2,57,72),D(4),W(1,76,117,1),W(3,75,107,1),D(1),
+  M(1,75,67),D(1),M(2,57,77),D(4),X(1),M(3,75,117),D(1),M(1,75,72),D(1),M(2,57,82),
+  D(4),X(3),D(1),M(1,75,77),D(1),M(2,57,87),D(5),M(1,75,82),D(1),M(2,57,92),
+  D(2),W(3,73,64,3),D(3),M(1,75,87),M(3,73,97),D(1),M(2,57,97),D(1),W(1,75,97,3),D(4),
+  M(1,72,64),W(3,73,107,1),D(1),M(2,57,107),D(1),
   0
 };
 
 nohop static const byte bwv883f065[] = {
-  W(2,42,64,3),D(2),W(3,66,82,1),D(2),W(1,62,97,3),W(2,42,97,3),D(1),W(2,64,107,1),D(3),W(3,66,87,1),
-  D(1),W(1,61,64,3),D(1),W(1,62,107,1),W(2,42,107,1),D(1),W(2,64,117,1),D(3),W(1,61,97,3),W(3,66,92,1),
-  D(1),D(1),W(1,62,117,1),W(2,42,117,1),D(1),X(2),D(3),W(1,61,107,1),W(3,66,97,1),D(1),
-  W(1,62,64,3),W(2,47,64,3),D(1),X(1),X(2),D(1),D(3),W(1,62,97,3),W(3,66,107,1),D(1),
-  W(2,47,67,1),D(1),D(2),W(3,67,97,3),D(2),W(1,62,107,1),W(3,66,117,1),D(1),W(2,47,72,1),W(3,66,97,3),
-  D(3),W(3,67,107,1),D(2),W(1,62,117,1),D(1),W(2,47,77,1),W(3,66,107,1),D(3),W(3,67,117,1),D(1),
-  W(1,59,64,3),D(1),X(1),D(1),W(2,47,82,1),W(3,66,117,1),D(2),W(1,59,97,3),D(1),X(3),
-  D(2),D(1),W(2,47,87,1),X(3),D(2),W(1,59,107,1),D(1),D(3),W(2,47,92,1),D(2),
-  W(1,59,117,1),D(4),W(2,47,97,1),D(2),W(1,62,64,3),D(2),W(1,62,97,3),D(1),D(1),W(1,61,64,3),
-  W(2,47,107,1),D(2),D(1),W(1,61,97,3),D(1),W(1,62,64,3),D(2),W(2,47,117,1),D(2),W(1,61,64,3),
-  D(1),W(1,61,107,1),
+  W(1,75,107,1),D(4),M(1,72,67),M(3,73,117),D(1),M(2,57,117),D(1),M(1,75,117),D(4),M(1,72,72),
+  X(3),D(1),W(2,57,97,3),D(1),X(1),D(2),W(1,72,97,3),D(3),W(2,57,107,1),D(1),
+  M(1,56,64),D(1),W(2,78,64,3),W(3,75,64,3),D(1),W(1,72,107,1),D(1),W(1,56,97,3),M(3,75,97),D(2),
+  W(2,57,117,1),D(2),M(2,78,67),D(1),W(1,72,117,1),D(1),W(1,54,64,3),W(3,75,107,1),D(2),X(2),
+  D(1),M(1,54,97),D(1),M(2,78,72),D(1),X(1),D(1),W(1,56,117,1),M(3,75,117),D(3),
+  M(1,54,107),D(1),M(2,78,77),D(2),W(1,75,64,3),W(2,78,97,3),X(3),D(1),M(2,56,64),D(2),
+  W(1,54,117,1),D(1),W(3,73,64,3),D(2),M(1,75,67),W(2,78,107,1),M(3,73,97),D(1),W(1,75,97,3),M(2,56,67),
+  D(1),M(1,75,64),D(1),X(1),D(3),M(2,78,117),M(3,73,64),D(1),M(1,75,97),M(2,56,72),
+  D(5),X(2),W(3,73,67,1),D(1),W(1,75,107,1),M(2,56,77),D(5),M(3,73,72),D(1),M(1,75,117),
+  M(2,56,82),D(1),W(1,75,64,3),D(2),W(3,73,97,3),D(3),X(1),M(2,56,87),D(1),W(1,75,67,1),
+  D(2),W(3,73,107,1),D(3),M(2,56,92),W(3,72,64,3),D(1),W(1,75,97,3),D(2),M(3,72,97),D(3),
   0
 };
 
 nohop static const byte bwv883f066[] = {
-  D(1),W(1,62,117,1),D(2),X(2),D(2),W(1,61,67,1),D(1),W(1,61,117,1),D(1),X(1),
-  D(4),W(1,61,72,1),D(1),X(1),D(1),D(2),W(2,47,97,3),W(3,45,64,3),D(1),W(4,65,64,3),
-  D(1),W(1,61,77,1),D(1),D(3),W(2,47,107,1),W(3,45,67,1),D(1),W(4,65,67,1),D(1),W(1,61,82,1),
-  D(1),W(2,44,64,3),D(2),W(3,45,97,3),D(1),W(2,44,97,3),D(1),W(4,65,72,1),D(1),W(1,61,87,1),
-  D(3),W(3,45,107,1),D(1),W(2,44,107,1),D(1),W(4,65,77,1),D(1),W(1,61,92,1),D(2),W(4,65,97,3),
-  D(1),W(2,45,64,3),W(3,66,64,3),D(1),W(2,44,117,1),D(2),W(1,61,97,1),D(2),W(4,65,107,1),D(1),
-  W(2,45,67,1),W(3,66,67,1),D(1),X(2),D(2),W(1,61,107,1),D(2),W(4,65,117,1),D(1),W(2,45,72,1),
-  W(3,66,72,1),D(1),D(2),W(1,61,117,1),D(2),X(4),D(1),W(2,45,77,1),W(3,66,77,1),D(3),
-  X(1),D(2),D(1),W(2,45,82,1),W(3,66,82,1),W(4,69,64,3),D(3),W(3,66,97,3),D(3),W(2,45,87,1),
-  W(4,69,67,1),D(3),W(3,66,107,1),D(3),W(2,45,92,1),W(4,69,72,1),D(3),W(3,66,117,1),D(3),W(2,45,97,1),
-  W(4,69,77,1),D(3),X(3),D(2),
+  M(2,56,97),D(1),W(1,75,107,1),D(2),W(3,72,107,1),D(1),W(1,76,64,3),W(2,56,97,3),D(1),M(2,73,64),
+  D(2),W(1,75,117,1),D(2),M(3,72,117),D(1),M(1,76,67),W(2,56,107,1),D(1),M(2,73,67),D(2),
+  X(1),D(2),X(3),D(1),M(1,76,72),M(2,56,117),D(1),M(2,73,72),D(5),M(1,76,77),
+  X(2),D(1),M(2,73,77),D(3),W(3,61,64,3),W(4,71,64,3),D(2),M(1,76,82),M(3,61,97),D(1),
+  W(2,73,97,3),D(3),W(4,71,67,1),D(2),M(1,76,87),W(3,61,107,1),D(1),W(2,73,107,1),D(3),M(4,71,72),
+  D(2),M(1,76,92),M(3,61,117),D(1),M(2,73,117),D(3),M(4,71,77),D(2),M(1,76,97),X(3),
+  D(1),X(2),D(2),W(2,69,64,3),D(1),W(3,54,64,3),M(4,71,82),D(2),M(1,76,107),W(4,71,97,3),
+  D(3),W(2,69,67,1),D(1),W(3,54,67,1),D(2),M(1,76,117),W(4,71,107,1),D(3),M(2,69,72),D(1),
+  M(3,54,72),D(2),X(1),M(4,71,117),D(3),M(2,69,77),D(1),M(3,54,77),D(2),W(2,69,97,3),
+  X(4),D(1),M(2,75,64),W(4,66,64,3),D(3),M(3,54,82),D(2),W(2,69,107,1),D(1),M(2,75,67),
+  W(4,66,67,1),D(1),W(1,76,97,3),D(2),M(3,54,87),D(1),M(1,73,64),D(1),M(2,69,117),W(4,66,97,3),
+  D(1),
   0
 };
 
 nohop static const byte bwv883f067[] = {
-  W(1,63,64,3),W(3,59,64,3),D(1),W(2,45,107,1),W(4,69,82,1),D(1),W(1,61,97,3),W(4,69,97,3),D(1),D(1),
-  D(2),W(1,63,67,1),W(3,59,67,1),D(1),W(2,45,117,1),D(1),W(1,61,107,1),W(4,69,107,1),D(1),W(1,63,97,3),
-  D(1),D(2),W(3,59,72,1),D(1),X(2),D(1),W(1,61,117,1),W(4,69,117,1),D(1),W(1,63,107,1),
-  D(3),W(3,59,77,1),D(2),X(1),X(4),D(1),W(1,63,117,1),W(2,45,97,3),D(1),W(1,44,64,3),
-  W(2,66,64,3),D(2),W(3,59,82,1),D(1),W(2,66,97,3),D(1),D(1),X(1),W(2,45,107,1),D(1),
-  W(1,44,67,1),D(2),W(2,42,64,3),W(3,59,87,1),D(1),W(1,44,97,3),W(2,66,107,1),D(1),D(1),W(2,45,117,1),
-  D(1),W(2,42,97,3),D(1),D(1),W(3,59,92,1),D(1),W(1,44,107,1),W(2,66,117,1),D(2),X(2),
-  D(1),W(2,42,107,1),D(2),W(3,59,97,1),D(1),W(1,44,64,3),W(2,71,64,3),D(2),D(1),W(2,42,117,1),
-  D(2),W(1,44,97,3),W(3,59,107,1),D(1),X(1),W(2,71,67,1),D(2),W(3,59,97,3),D(1),X(2),
-  D(2),W(1,44,107,1),D(1),W(2,71,72,1),D(2),W(3,59,107,1),D(1),D(2),W(1,44,117,1),D(1),
-  W(2,71,77,1),D(2),
+  M(2,75,72),D(1),W(1,76,107,1),W(2,75,97,3),D(1),W(1,73,97,3),D(1),M(3,54,92),D(2),X(2),
+  W(4,66,107,1),D(2),W(1,76,117,1),W(2,75,107,1),D(1),M(1,73,107),D(1),M(3,54,97),D(1),W(1,60,64,3),
+  W(2,80,64,3),D(1),M(4,66,117),D(2),X(1),W(2,75,117,1),D(1),W(1,73,117,1),D(1),M(3,54,107),
+  D(1),M(1,60,67),M(2,80,67),D(1),W(1,60,97,3),X(4),D(1),W(2,80,97,3),D(1),X(2),
+  D(1),X(1),D(1),M(3,54,117),D(2),W(1,60,107,1),D(1),W(2,80,107,1),D(3),X(3),
+  D(2),M(1,60,117),D(1),M(2,80,117),D(1),W(1,63,64,3),W(2,72,64,3),W(4,52,64,3),D(3),M(2,72,97),
+  M(4,52,97),D(1),X(1),W(3,54,97,3),D(1),X(2),D(1),W(1,63,67,1),D(3),W(2,72,107,1),
+  W(4,52,107,1),D(1),W(2,51,64,3),W(3,54,107,1),D(2),M(1,63,72),D(3),W(2,72,117,1),M(4,52,117),D(1),
+  M(2,51,67),M(3,54,117),D(1),W(1,63,97,3),W(2,51,97,3),D(4),M(1,73,64),M(2,56,64),X(4),D(1),
+  W(3,64,64,3),W(4,52,64,3),D(1),W(1,63,107,1),W(2,51,107,1),D(3),W(2,56,97,3),M(4,52,97),D(1),M(1,73,67),
+  D(1),W(3,64,67,1),D(1),M(1,63,117),W(2,51,117,1),D(3),
   0
 };
 
 nohop static const byte bwv883f068[] = {
-  W(3,59,117,1),D(3),W(1,68,64,3),W(3,40,64,3),D(1),W(2,71,82,1),D(2),W(3,40,97,3),D(3),W(1,68,97,3),
-  D(1),W(2,71,87,1),D(2),W(3,40,107,1),D(3),W(1,68,107,1),D(1),W(2,71,92,1),D(2),W(3,40,117,1),
-  D(3),W(1,68,117,1),D(1),W(2,71,97,1),D(2),X(3),D(2),W(1,64,64,3),D(1),X(1),
-  D(1),W(2,71,107,1),W(3,49,64,3),D(2),D(2),W(1,64,67,1),D(1),W(3,49,97,3),D(1),W(2,71,117,1),
-  D(4),W(1,64,72,1),D(1),W(3,49,107,1),D(1),X(2),D(4),W(1,64,77,1),D(1),W(3,49,117,1),
-  D(4),W(3,37,64,3),W(4,69,64,3),D(1),W(1,64,82,1),D(1),X(3),D(1),W(3,37,97,3),D(2),
-  W(4,69,97,3),D(2),W(1,64,87,1),W(2,71,97,3),D(1),D(1),W(2,68,64,3),W(3,37,107,1),D(2),W(4,69,107,1),
-  D(2),W(1,64,92,1),W(2,68,97,3),D(2),W(3,37,117,1),D(2),W(4,69,117,1),D(2),W(1,64,97,1),W(2,68,107,1),
-  D(1),W(2,69,64,3),W(3,49,64,3),D(1),X(3),D(2),W(2,69,97,3),X(4),D(1),D(1),
-  W(1,64,107,1),W(2,68,117,1),D(1),W(3,49,67,1),D(1),D(2),W(2,69,107,1),D(2),W(1,64,117,1),X(2),
-  D(1),W(3,49,72,1),D(3),
+  M(2,56,107),W(4,52,107,1),D(1),M(1,73,72),D(1),W(3,64,97,3),D(1),X(1),X(2),D(3),
+  M(2,56,117),M(4,52,117),D(1),M(1,73,77),D(1),W(3,64,107,1),D(3),W(2,68,64,3),D(1),X(2),
+  W(3,49,64,3),X(4),D(1),M(1,73,82),D(1),M(2,68,97),W(3,64,117,1),D(4),W(3,49,97,3),D(1),
+  M(1,73,87),D(1),W(2,68,107,1),X(3),D(4),W(3,49,107,1),D(1),M(1,73,92),D(1),M(2,68,117),
+  D(4),M(3,49,117),D(1),M(1,73,97),D(1),X(2),D(1),W(2,66,64,3),D(1),W(3,51,64,3),
+  D(2),X(3),D(1),M(1,73,107),D(2),W(2,66,67,1),D(1),W(3,51,67,1),D(3),M(1,73,117),
+  W(4,68,64,3),D(2),M(2,66,72),D(1),W(2,66,97,3),M(3,51,72),D(3),X(1),W(4,68,67,1),D(3),
+  W(2,66,107,1),M(3,51,77),D(2),W(2,66,64,3),D(1),M(4,68,72),D(1),W(4,68,97,3),D(2),W(2,66,117,1),
+  M(3,51,82),D(2),M(2,66,67),D(2),W(4,68,107,1),D(2),X(2),M(3,51,87),D(1),W(4,64,64,3),
+  D(1),M(2,66,72),D(1),W(2,66,97,3),D(1),W(4,68,117,1),D(2),M(3,51,92),D(1),M(4,64,67),
+  D(2),W(2,66,107,1),D(1),X(4),D(2),W(1,66,64,3),W(2,72,64,3),M(3,51,97),D(1),W(3,56,64,3),
+  W(4,64,97,3),D(1),
   0
 };
 
 nohop static const byte bwv883f069[] = {
-  W(2,69,117,1),D(2),X(1),D(1),W(3,49,77,1),D(3),X(2),D(2),W(2,73,64,3),D(1),
-  W(3,49,82,1),D(2),W(2,73,97,3),D(1),D(3),W(3,49,87,1),D(2),W(2,73,107,1),D(4),W(3,49,92,1),
-  D(2),W(2,73,117,1),D(4),W(3,49,97,1),D(2),X(2),D(1),W(1,64,97,3),W(2,66,64,3),D(1),
-  W(4,62,64,3),D(2),W(3,49,107,1),D(2),D(1),W(1,64,107,1),W(2,66,67,1),D(1),W(4,62,67,1),D(2),
-  W(3,49,117,1),D(2),W(2,66,97,3),D(1),W(1,64,117,1),D(1),W(3,49,97,3),W(4,62,72,1),D(1),D(3),
-  W(2,66,107,1),D(1),X(1),D(1),W(3,49,107,1),W(4,62,77,1),D(3),W(1,47,64,3),W(2,69,64,3),D(1),
-  W(2,66,117,1),D(1),D(1),W(1,47,97,3),W(3,49,117,1),W(4,62,82,1),D(1),D(2),W(2,69,67,1),D(1),
-  X(2),D(2),W(1,45,64,3),X(3),W(4,62,87,1),D(3),W(2,69,72,1),D(1),D(1),W(1,45,97,3),
-  D(1),W(1,47,117,1),W(4,62,92,1),D(3),W(2,69,77,1),D(2),W(1,45,107,1),D(1),X(1),W(4,62,97,1),
-  D(1),W(1,74,64,3),W(3,47,64,3),D(1),W(2,69,97,3),D(1),W(3,47,97,3),D(1),D(1),W(1,45,117,1),
-  D(1),W(4,62,107,1),D(1),W(1,74,67,1),D(1),
-  0
-};
-
-nohop static const byte bwv883f070[] = {
-  W(2,69,107,1),D(1),W(3,47,107,1),D(2),X(1),D(1),W(4,62,117,1),D(1),W(1,74,72,1),D(1),
-  W(2,69,117,1),D(1),W(3,47,117,1),D(2),D(1),X(4),D(1),W(1,74,77,1),D(1),X(2),
-  D(1),X(3),D(1),W(2,44,64,3),D(1),W(3,71,64,3),D(2),W(1,74,82,1),D(1),W(2,44,97,3),
-  D(1),D(2),W(3,71,67,1),D(2),W(1,74,87,1),D(1),W(2,44,107,1),D(3),W(3,71,72,1),D(2),
-  W(1,74,92,1),D(1),W(2,44,117,1),D(3),W(3,71,77,1),D(1),W(4,62,97,3),D(1),W(1,74,97,1),D(1),
-  X(2),D(1),W(2,41,64,3),W(3,71,97,3),W(4,68,64,3),D(3),W(4,68,97,3),D(1),W(1,74,97,3),W(2,41,97,3),
-  D(1),D(1),W(3,71,107,1),D(3),W(4,68,107,1),D(1),W(1,74,107,1),W(2,41,107,1),D(2),W(3,71,117,1),
-  D(3),W(4,68,117,1),D(1),W(1,74,117,1),W(2,41,117,1),D(2),X(3),D(3),X(4),D(1),
-  X(1),X(2),D(1),W(1,74,64,3),W(2,56,64,3),W(3,65,64,3),D(1),D(2),W(1,74,97,3),W(3,65,97,3),
-  D(1),D(1),D(1),W(2,56,67,1),D(3),W(1,74,107,1),W(3,65,107,1),D(3),W(2,56,72,1),D(3),
-  W(1,74,117,1),W(3,65,117,1),D(3),W(2,56,77,1),D(2),W(1,74,64,3),D(1),X(1),
-  0
-};
-
-nohop static const byte bwv883f071[] = {
-  X(3),D(1),W(3,53,64,3),D(1),W(2,56,97,3),D(1),W(2,73,64,3),D(2),W(1,74,97,3),W(2,73,97,3),
-  D(1),D(1),W(1,74,64,3),W(3,53,67,1),D(1),W(2,56,107,1),D(3),W(1,74,97,3),W(2,73,64,3),D(2),
-  W(3,53,72,1),D(1),W(2,56,117,1),D(3),W(1,74,107,1),W(2,73,67,1),D(2),W(3,53,77,1),D(1),X(2),
-  D(3),W(1,74,117,1),W(2,73,72,1),W(3,53,97,3),D(1),D(1),W(1,68,64,3),D(1),D(1),W(3,49,64,3),
-  D(2),X(1),W(2,73,77,1),W(3,53,107,1),D(2),W(1,68,67,1),D(2),W(3,49,67,1),D(2),W(2,73,97,3),
-  W(3,53,117,1),D(1),W(2,71,64,3),D(1),W(1,68,72,1),D(2),W(3,49,72,1),D(2),W(2,73,107,1),X(3),
-  D(1),W(2,71,67,1),D(1),W(1,68,77,1),D(2),W(2,71,97,3),W(3,49,77,1),D(2),W(2,69,64,3),D(1),
-  W(4,54,64,3),D(1),W(1,68,82,1),D(2),W(2,71,107,1),W(3,49,97,3),D(1),D(1),W(2,69,67,1),D(1),
-  W(4,54,67,1),D(1),W(1,68,87,1),D(2),W(2,71,117,1),W(3,49,107,1),D(2),W(2,69,72,1),D(1),W(4,54,72,1),
-  D(1),W(1,68,92,1),D(2),X(2),W(3,49,117,1),D(2),W(2,69,77,1),D(1),W(4,54,77,1),
-  0
-};
-
-nohop static const byte bwv883f072[] = {
-  D(1),W(1,68,97,1),W(3,66,64,3),D(2),W(1,56,64,3),X(3),D(2),W(2,69,82,1),D(1),W(3,66,97,3),
-  W(4,54,97,3),D(1),W(1,68,107,1),D(2),W(1,56,67,1),D(2),W(2,69,87,1),W(3,65,64,3),D(1),W(3,66,107,1),
-  W(4,54,107,1),D(1),W(1,68,117,1),D(1),W(1,68,97,3),W(3,65,97,3),D(1),W(1,56,72,1),D(2),W(2,69,92,1),
-  D(1),W(3,66,117,1),W(4,54,117,1),D(2),W(1,68,107,1),W(3,65,107,1),D(1),W(1,56,77,1),D(1),W(1,66,64,3),
-  D(1),W(2,69,97,1),W(3,57,64,3),D(1),X(3),X(4),D(1),W(1,66,97,3),D(1),W(1,68,117,1),
-  W(3,65,117,1),D(2),W(1,56,107,1),D(1),W(2,69,107,1),W(3,57,67,1),D(1),D(1),W(1,66,107,1),D(1),
-  X(1),X(3),D(2),W(1,56,117,1),D(1),W(2,69,117,1),W(3,57,72,1),D(2),W(1,66,117,1),D(1),
-  D(2),X(1),D(1),X(2),W(3,57,77,1),D(2),X(1),D(1),W(3,57,97,3),D(1),
-  W(1,63,64,3),W(4,54,64,3),D(1),D(3),W(1,63,97,3),D(1),W(3,57,107,1),D(1),W(4,54,67,1),D(4),
-  W(1,63,107,1),D(1),W(3,57,117,1),D(1),W(4,54,72,1),D(4),W(1,63,117,1),D(1),X(3),D(1),
-  W(4,54,77,1),D(4),X(1),D(1),
-  0
-};
-
-nohop static const byte bwv883f073[] = {
-  W(1,60,64,3),D(1),W(3,56,64,3),W(4,54,97,3),D(4),D(1),W(1,60,67,1),D(1),W(3,56,67,1),W(4,54,107,1),
-  D(5),W(1,60,72,1),D(1),W(3,56,72,1),W(4,54,117,1),D(5),W(1,60,77,1),W(3,56,97,3),D(1),X(4),
-  D(4),W(3,68,64,3),D(1),W(1,60,82,1),W(3,56,107,1),D(1),W(4,44,64,3),D(2),W(2,69,97,3),D(2),
-  W(3,68,67,1),D(1),W(1,60,87,1),W(3,56,117,1),D(1),W(4,44,67,1),D(1),W(3,68,97,3),D(1),W(2,66,64,3),
-  D(3),W(1,60,92,1),W(2,66,97,3),X(3),D(1),W(4,44,72,1),D(1),W(3,68,107,1),D(1),W(2,69,117,1),
-  D(3),W(1,60,97,1),W(2,66,107,1),D(1),W(4,44,77,1),D(1),W(2,68,64,3),W(3,68,117,1),D(1),X(2),
-  D(3),W(1,60,107,1),W(2,66,117,1),D(1),W(2,68,97,3),W(4,44,82,1),D(1),X(3),D(1),D(3),
-  W(1,60,117,1),X(2),D(1),W(2,68,107,1),W(4,44,87,1),D(1),D(4),X(1),D(1),W(2,68,117,1),
-  W(4,44,92,1),D(4),W(1,60,97,3),D(1),W(1,60,64,3),W(2,56,64,3),D(1),X(2),W(3,63,64,3),W(4,44,97,1),
-  D(2),W(2,56,97,3),D(1),W(3,63,97,3),D(1),W(1,60,107,1),D(1),W(1,60,67,1),D(1),
-  0
-};
-
-nohop static const byte bwv883f074[] = {
-  W(4,44,107,1),D(2),W(2,56,107,1),D(1),W(3,63,107,1),D(1),W(1,60,117,1),D(1),W(1,60,72,1),D(1),
-  W(4,44,117,1),D(2),W(2,56,117,1),D(1),W(3,63,117,1),D(1),X(1),D(1),W(1,60,77,1),D(1),
-  X(4),D(2),X(2),D(1),X(3),D(1),W(1,60,97,3),W(2,52,64,3),D(1),W(1,64,64,3),
-  W(3,61,64,3),D(1),W(2,52,97,3),D(1),W(1,64,97,3),W(3,61,97,3),D(1),D(1),D(1),W(1,60,107,1),
-  D(2),W(2,52,107,1),D(1),W(1,64,107,1),W(3,61,107,1),D(3),W(1,60,117,1),D(2),W(2,52,117,1),D(1),
-  W(1,64,117,1),W(3,61,117,1),D(3),X(1),D(2),X(2),D(1),X(1),X(3),D(1),
-  W(1,49,64,3),W(2,76,64,3),D(2),D(1),W(1,49,97,3),W(2,76,97,3),D(1),D(1),D(4),W(1,49,107,1),
-  W(2,76,107,1),D(2),W(4,44,97,3),D(1),D(3),W(1,49,117,1),W(2,76,117,1),D(2),W(4,44,107,1),D(4),
-  X(1),X(2),D(2),W(4,44,117,1),D(1),W(1,76,64,3),W(2,57,64,3),D(3),D(1),W(1,76,97,3),
-  W(3,75,64,3),D(1),X(4),D(1),W(2,57,67,1),D(4),W(1,76,107,1),W(3,75,97,3),D(1),W(1,75,64,3),
-  D(1),W(2,57,72,1),D(4),W(1,76,117,1),W(3,75,107,1),D(1),W(1,75,67,1),D(1),
-  0
-};
-
-nohop static const byte bwv883f075[] = {
-  W(2,57,77,1),D(4),X(1),W(3,75,117,1),D(1),W(1,75,72,1),D(1),W(2,57,82,1),D(4),X(3),
-  D(1),W(1,75,77,1),D(1),W(2,57,87,1),D(4),D(1),W(1,75,82,1),D(1),W(2,57,92,1),D(2),
-  W(3,73,64,3),D(3),W(1,75,87,1),W(3,73,97,3),D(1),W(2,57,97,1),D(1),W(1,75,97,3),D(1),D(3),
-  W(1,72,64,3),W(3,73,107,1),D(1),W(2,57,107,1),D(1),W(1,75,107,1),D(4),W(1,72,67,1),W(3,73,117,1),D(1),
-  W(2,57,117,1),D(1),W(1,75,117,1),D(4),W(1,72,72,1),X(3),D(1),W(2,57,97,3),D(1),X(1),
-  D(2),W(1,72,97,3),D(1),D(1),D(1),W(2,57,107,1),D(1),W(1,56,64,3),D(1),W(2,78,64,3),
-  W(3,75,64,3),D(1),W(1,72,107,1),D(1),W(1,56,97,3),W(3,75,97,3),D(1),D(1),W(2,57,117,1),D(2),
-  W(2,78,67,1),D(1),W(1,72,117,1),D(1),W(1,54,64,3),W(3,75,107,1),D(2),X(2),D(1),W(1,54,97,3),
-  D(1),W(2,78,72,1),D(1),X(1),D(1),W(1,56,117,1),W(3,75,117,1),D(2),D(1),W(1,54,107,1),
-  D(1),W(2,78,77,1),D(1),D(1),W(1,75,64,3),W(2,78,97,3),X(3),D(1),W(2,56,64,3),D(2),
-  W(1,54,117,1),D(1),W(3,73,64,3),D(2),W(1,75,67,1),
-  0
-};
-
-nohop static const byte bwv883f076[] = {
-  W(2,78,107,1),W(3,73,97,3),D(1),W(1,75,97,3),W(2,56,67,1),D(1),W(1,75,64,3),D(1),X(1),D(3),
-  W(2,78,117,1),W(3,73,64,3),D(1),W(1,75,97,3),W(2,56,72,1),D(1),D(1),D(3),X(2),W(3,73,67,1),
-  D(1),W(1,75,107,1),W(2,56,77,1),D(5),W(3,73,72,1),D(1),W(1,75,117,1),W(2,56,82,1),D(1),W(1,75,64,3),
-  D(2),W(3,73,97,3),D(1),D(1),D(1),X(1),W(2,56,87,1),D(1),W(1,75,67,1),D(2),
-  W(3,73,107,1),D(3),W(2,56,92,1),W(3,72,64,3),D(1),W(1,75,97,3),D(1),D(1),W(3,72,97,3),D(3),
-  W(2,56,97,1),D(1),W(1,75,107,1),D(2),W(3,72,107,1),D(1),W(1,76,64,3),W(2,56,97,3),D(1),W(2,73,64,3),
-  D(2),W(1,75,117,1),D(2),W(3,72,117,1),D(1),W(1,76,67,1),W(2,56,107,1),D(1),W(2,73,67,1),D(2),
-  X(1),D(2),X(3),D(1),W(1,76,72,1),W(2,56,117,1),D(1),W(2,73,72,1),D(2),D(2),
-  D(1),W(1,76,77,1),X(2),D(1),W(2,73,77,1),D(3),W(3,61,64,3),W(4,71,64,3),D(2),W(1,76,82,1),
-  W(3,61,97,3),D(1),W(2,73,97,3),D(3),W(4,71,67,1),D(2),W(1,76,87,1),W(3,61,107,1),D(1),W(2,73,107,1),
-  D(3),
-  0
-};
-
-nohop static const byte bwv883f077[] = {
-  W(4,71,72,1),D(2),W(1,76,92,1),W(3,61,117,1),D(1),W(2,73,117,1),D(3),W(4,71,77,1),D(2),W(1,76,97,1),
-  X(3),D(1),X(2),D(2),W(2,69,64,3),D(1),W(3,54,64,3),W(4,71,82,1),D(2),W(1,76,107,1),
-  W(4,71,97,3),D(1),D(2),W(2,69,67,1),D(1),W(3,54,67,1),D(2),W(1,76,117,1),W(4,71,107,1),D(3),
-  W(2,69,72,1),D(1),W(3,54,72,1),D(2),X(1),W(4,71,117,1),D(3),W(2,69,77,1),D(1),W(3,54,77,1),
-  D(2),W(2,69,97,3),X(4),D(1),W(2,75,64,3),W(4,66,64,3),D(3),W(3,54,82,1),D(2),W(2,69,107,1),
-  D(1),W(2,75,67,1),W(4,66,67,1),D(1),W(1,76,97,3),D(1),D(1),W(3,54,87,1),D(1),W(1,73,64,3),
-  D(1),W(2,69,117,1),W(4,66,97,3),D(1),W(2,75,72,1),D(1),W(1,76,107,1),W(2,75,97,3),D(1),W(1,73,97,3),
-  D(1),W(3,54,92,1),D(2),X(2),W(4,66,107,1),D(2),W(1,76,117,1),W(2,75,107,1),D(1),W(1,73,107,1),
-  D(1),W(3,54,97,1),D(1),W(1,60,64,3),W(2,80,64,3),D(1),W(4,66,117,1),D(2),X(1),W(2,75,117,1),
-  D(1),W(1,73,117,1),D(1),W(3,54,107,1),D(1),W(1,60,67,1),W(2,80,67,1),D(1),
-  0
-};
-
-nohop static const byte bwv883f078[] = {
-  W(1,60,97,3),X(4),D(1),W(2,80,97,3),D(1),X(2),D(1),X(1),D(1),W(3,54,117,1),
-  D(2),W(1,60,107,1),D(1),W(2,80,107,1),D(1),D(1),D(1),X(3),D(2),W(1,60,117,1),
-  D(1),W(2,80,117,1),D(1),W(1,63,64,3),W(2,72,64,3),W(4,52,64,3),D(3),W(2,72,97,3),W(4,52,97,3),D(1),
-  X(1),W(3,54,97,3),D(1),X(2),D(1),W(1,63,67,1),D(3),W(2,72,107,1),W(4,52,107,1),D(1),
-  W(2,51,64,3),W(3,54,107,1),D(1),D(1),W(1,63,72,1),D(3),W(2,72,117,1),W(4,52,117,1),D(1),W(2,51,67,1),
-  W(3,54,117,1),D(1),W(1,63,97,3),W(2,51,97,3),D(4),W(1,73,64,3),W(2,56,64,3),X(4),D(1),W(3,64,64,3),
-  W(4,52,64,3),D(1),W(1,63,107,1),W(2,51,107,1),D(3),W(2,56,97,3),W(4,52,97,3),D(1),W(1,73,67,1),D(1),
-  W(3,64,67,1),D(1),W(1,63,117,1),W(2,51,117,1),D(3),W(2,56,107,1),W(4,52,107,1),D(1),W(1,73,72,1),D(1),
-  W(3,64,97,3),D(1),X(1),X(2),D(3),W(2,56,117,1),W(4,52,117,1),D(1),W(1,73,77,1),D(1),
-  W(3,64,107,1),D(1),D(2),W(2,68,64,3),D(1),X(2),W(3,49,64,3),X(4),D(1),W(1,73,82,1),
-  D(1),W(2,68,97,3),
-  0
-};
-
-nohop static const byte bwv883f079[] = {
-  W(3,64,117,1),D(4),W(3,49,97,3),D(1),W(1,73,87,1),D(1),W(2,68,107,1),X(3),D(4),W(3,49,107,1),
-  D(1),W(1,73,92,1),D(1),W(2,68,117,1),D(4),W(3,49,117,1),D(1),W(1,73,97,1),D(1),X(2),
-  D(1),W(2,66,64,3),D(1),W(3,51,64,3),D(2),X(3),D(1),W(1,73,107,1),D(1),D(1),
-  W(2,66,67,1),D(1),W(3,51,67,1),D(2),D(1),W(1,73,117,1),W(4,68,64,3),D(2),W(2,66,72,1),D(1),
-  W(2,66,97,3),W(3,51,72,1),D(3),X(1),W(4,68,67,1),D(3),W(2,66,107,1),W(3,51,77,1),D(2),W(2,66,64,3),
-  D(1),W(4,68,72,1),D(1),W(4,68,97,3),D(2),W(2,66,117,1),W(3,51,82,1),D(2),W(2,66,67,1),D(2),
-  W(4,68,107,1),D(2),X(2),W(3,51,87,1),D(1),W(4,64,64,3),D(1),W(2,66,72,1),D(1),W(2,66,97,3),
-  D(1),W(4,68,117,1),D(2),W(3,51,92,1),D(1),W(4,64,67,1),D(2),W(2,66,107,1),D(1),X(4),
-  D(2),W(1,66,64,3),W(2,72,64,3),W(3,51,97,1),D(1),W(3,56,64,3),W(4,64,97,3),D(1),W(1,73,97,3),D(1),
-  W(2,66,117,1),D(1),D(2),W(1,66,67,1),W(2,72,67,1),W(3,51,97,3),D(1),W(3,56,67,1),W(4,64,107,1),D(1),
-  0
-};
-
-nohop static const byte bwv883f080[] = {
-  W(1,73,107,1),D(1),X(2),D(2),W(4,64,64,3),D(1),W(1,66,72,1),W(2,72,72,1),W(3,51,107,1),D(1),
-  W(3,56,72,1),W(4,64,117,1),D(1),W(1,66,97,3),D(1),D(2),W(4,64,67,1),D(1),W(2,72,77,1),W(3,51,117,1),
-  D(1),W(3,56,77,1),X(4),D(1),W(1,66,107,1),D(2),W(1,63,64,3),W(4,64,97,3),D(2),W(2,72,82,1),
-  X(3),D(1),W(3,56,82,1),D(1),W(1,66,117,1),D(2),W(1,63,67,1),W(4,64,107,1),D(2),W(2,72,87,1),
-  D(1),W(3,56,87,1),D(1),X(1),W(4,66,64,3),D(2),W(1,63,72,1),W(4,64,117,1),D(2),W(1,63,97,3),
-  W(2,72,92,1),D(1),W(3,56,92,1),D(1),W(4,66,67,1),D(2),X(4),D(2),W(1,63,107,1),W(2,72,97,1),
-  D(1),W(3,56,97,1),D(1),W(4,66,97,3),D(1),W(1,73,64,3),W(2,72,97,3),W(3,56,97,3),D(1),W(2,64,64,3),
-  D(1),W(3,49,64,3),D(1),W(1,63,117,1),D(2),W(4,66,107,1),D(1),W(1,73,67,1),W(2,72,107,1),W(3,56,107,1),
-  D(1),W(2,64,67,1),D(1),W(3,49,67,1),D(1),X(1),D(2),W(2,64,97,3),W(4,66,64,3),D(1),
-  W(1,73,72,1),W(2,72,117,1),W(3,56,117,1),D(2),W(3,49,72,1),D(1),
+  M(1,73,97),D(1),W(2,66,117,1),D(3),W(1,66,67,1),M(2,72,67),M(3,51,97),D(1),W(3,56,67,1),W(4,64,107,1),
+  D(1),M(1,73,107),D(1),X(2),D(2),W(4,64,64,3),D(1),M(1,66,72),M(2,72,72),M(3,51,107),
+  D(1),M(3,56,72),W(4,64,117,1),D(1),W(1,66,97,3),D(3),M(4,64,67),D(1),M(2,72,77),M(3,51,117),
+  D(1),M(3,56,77),X(4),D(1),W(1,66,107,1),D(2),W(1,63,64,3),W(4,64,97,3),D(2),M(2,72,82),
+  X(3),D(1),M(3,56,82),D(1),W(1,66,117,1),D(2),M(1,63,67),W(4,64,107,1),D(2),M(2,72,87),
+  D(1),M(3,56,87),D(1),X(1),W(4,66,64,3),D(2),M(1,63,72),W(4,64,117,1),D(2),W(1,63,97,3),
+  M(2,72,92),D(1),M(3,56,92),D(1),M(4,66,67),D(2),X(4),D(2),W(1,63,107,1),M(2,72,97),
+  D(1),M(3,56,97),D(1),W(4,66,97,3),D(1),W(1,73,64,3),W(2,72,97,3),W(3,56,97,3),D(1),M(2,64,64),
+  D(1),M(3,49,64),D(1),W(1,63,117,1),D(2),W(4,66,107,1),D(1),M(1,73,67),W(2,72,107,1),W(3,56,107,1),
+  D(1),M(2,64,67),D(1),M(3,49,67),D(1),X(1),D(2),W(2,64,97,3),W(4,66,64,3),D(1),
+  M(1,73,72),W(2,72,117,1),M(3,56,117),D(2),M(3,49,72),D(1),
+  0
+};
+
+nohop static const byte bwv883f_keys000[] = { 0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,255 };
+
+nohop static const byte bwv883f_keys001[] = { 88,2,3,5,57,117,1,61,64,3,59,97,3,0,0,1,255 };
+
+nohop static const byte bwv883f_keys002[] = { 176,4,7,138,64,72,1,62,107,1,0,117,1,0,0,1,255 };
+
+nohop static const byte bwv883f_keys003[] = { 8,7,13,8,44,117,1,45,64,3,0,117,1,0,117,1,255 };
+
+nohop static const byte bwv883f_keys004[] = { 96,9,20,30,60,64,3,56,107,1,75,87,1,61,107,1,255 };
+
+nohop static const byte bwv883f_keys005[] = { 184,11,27,120,51,77,1,69,97,1,71,64,3,0,117,1,255 };
+
+nohop static const byte bwv883f_keys006[] = { 16,14,35,100,53,64,3,0,117,1,0,117,1,0,117,1,255 };
+
+nohop static const byte bwv883f_keys007[] = { 105,16,42,164,64,117,1,0,67,1,61,67,1,0,117,1,255 };
+
+nohop static const byte bwv883f_keys008[] = { 192,18,49,118,59,77,1,58,117,1,0,117,1,74,117,1,255 };
+
+nohop static const byte bwv883f_keys009[] = { 24,21,56,162,0,64,3,47,77,1,67,117,1,0,117,1,255 };
+
+nohop static const byte bwv883f_keys010[] = { 112,23,63,108,60,92,1,66,97,3,68,107,1,44,72,1,255 };
+
+nohop static const byte *bwv883f_keys[] = {
+  bwv883f_keys000,
+  bwv883f_keys001,
+  bwv883f_keys002,
+  bwv883f_keys003,
+  bwv883f_keys004,
+  bwv883f_keys005,
+  bwv883f_keys006,
+  bwv883f_keys007,
+  bwv883f_keys008,
+  bwv883f_keys009,
+  bwv883f_keys010,
   0
 };
 
@@ -1272,16 +1224,6 @@ nohop const byte *bwv883f[] = {
   bwv883f067,
   bwv883f068,
   bwv883f069,
-  bwv883f070,
-  bwv883f071,
-  bwv883f072,
-  bwv883f073,
-  bwv883f074,
-  bwv883f075,
-  bwv883f076,
-  bwv883f077,
-  bwv883f078,
-  bwv883f079,
-  bwv883f080,
-  0
+  0,
+  (const byte*)bwv883f_keys
 };
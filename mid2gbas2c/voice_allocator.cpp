@@ -0,0 +1,215 @@
+#include "voice_allocator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace {
+
+// 残量网络中的一条边，rev 是反向边在 to 的边表中的下标
+struct FlowEdge {
+    int to;
+    int rev;
+    int cap;
+    int64_t cost;
+};
+
+class FlowGraph {
+public:
+    explicit FlowGraph(int nodes) : _edges(nodes) {}
+
+    // 返回新边在 from 的边表中的下标
+    size_t add_edge(int from, int to, int cap, int64_t cost) {
+        _edges[from].push_back({to, static_cast<int>(_edges[to].size()), cap, cost});
+        _edges[to].push_back({from, static_cast<int>(_edges[from].size()) - 1, 0, -cost});
+        return _edges[from].size() - 1;
+    }
+
+    const FlowEdge& edge(int from, size_t index) const { return _edges[from][index]; }
+
+    // 从 0 号节点向最后一个节点送 amount 单位的流，费用最小。
+    // 所有边都从编号小的节点指向编号大的节点，初始势能按拓扑序求出，之后每次增广用 Dijkstra
+    void min_cost_flow(int amount) {
+        const int nodes = static_cast<int>(_edges.size());
+        const int64_t inf = std::numeric_limits<int64_t>::max();
+        std::vector<int64_t> potential(nodes, inf);
+        potential[0] = 0;
+        for (int u = 0; u < nodes; ++u) {
+            if (potential[u] == inf) {
+                continue;
+            }
+            for (const FlowEdge& e : _edges[u]) {
+                if (e.cap > 0 && potential[u] + e.cost < potential[e.to]) {
+                    potential[e.to] = potential[u] + e.cost;
+                }
+            }
+        }
+
+        const int sink = nodes - 1;
+        std::vector<int64_t> dist(nodes);
+        std::vector<int> prev_node(nodes);
+        std::vector<int> prev_edge(nodes);
+        int flow = 0;
+        while (flow < amount) {
+            std::fill(dist.begin(), dist.end(), inf);
+            dist[0] = 0;
+            std::priority_queue<std::pair<int64_t, int>, std::vector<std::pair<int64_t, int>>, std::greater<std::pair<int64_t, int>>> queue;
+            queue.push({0, 0});
+            while (!queue.empty()) {
+                auto [d, u] = queue.top();
+                queue.pop();
+                if (d > dist[u]) {
+                    continue;
+                }
+                for (size_t i = 0; i < _edges[u].size(); ++i) {
+                    const FlowEdge& e = _edges[u][i];
+                    if (e.cap <= 0) {
+                        continue;
+                    }
+                    int64_t next = d + e.cost + potential[u] - potential[e.to];
+                    if (next < dist[e.to]) {
+                        dist[e.to] = next;
+                        prev_node[e.to] = u;
+                        prev_edge[e.to] = static_cast<int>(i);
+                        queue.push({next, e.to});
+                    }
+                }
+            }
+            if (dist[sink] == inf) {
+                break;
+            }
+            for (int u = 0; u < nodes; ++u) {
+                if (dist[u] != inf) {
+                    potential[u] += dist[u];
+                }
+            }
+
+            int push = amount - flow;
+            for (int v = sink; v != 0; v = prev_node[v]) {
+                push = std::min(push, _edges[prev_node[v]][prev_edge[v]].cap);
+            }
+            for (int v = sink; v != 0; v = prev_node[v]) {
+                FlowEdge& e = _edges[prev_node[v]][prev_edge[v]];
+                e.cap -= push;
+                _edges[v][e.rev].cap += push;
+            }
+            flow += push;
+        }
+    }
+
+private:
+    std::vector<std::vector<FlowEdge>> _edges;
+};
+
+// 按开始时间把 order 中的音符放到空闲声部上：优先用上一个音符来自同一 MIDI 通道的声部，
+// 其次用空出来最久的声部。没有空闲声部的音符得到 0
+void place_notes(const std::vector<VoiceNote>& notes, const std::vector<size_t>& order, int voices, std::vector<int>& result) {
+    std::vector<long> busy_until(voices, std::numeric_limits<long>::min());
+    std::vector<int> last_channel(voices, -1);
+    for (size_t index : order) {
+        const VoiceNote& note = notes[index];
+        int best = -1;
+        for (int v = 0; v < voices; ++v) {
+            if (busy_until[v] > note.start) {
+                continue;
+            }
+            if (best == -1) {
+                best = v;
+                continue;
+            }
+            bool same = last_channel[v] == note.midi_channel;
+            bool best_same = last_channel[best] == note.midi_channel;
+            if (same != best_same ? same : busy_until[v] < busy_until[best]) {
+                best = v;
+            }
+        }
+        if (best == -1) {
+            result[index] = 0;
+            continue;
+        }
+        busy_until[best] = std::max(note.end, note.start + 1);
+        last_channel[best] = note.midi_channel;
+        result[index] = best + 1;
+    }
+}
+
+} // namespace
+
+std::vector<int> assign_voices(const std::vector<VoiceNote>& notes, int voices, size_t greedy_limit) {
+    std::vector<int> result(notes.size(), 0);
+    if (notes.empty() || voices <= 0) {
+        return result;
+    }
+
+    std::vector<size_t> order;
+    order.reserve(notes.size());
+
+    if (notes.size() > greedy_limit) {
+        // 贪心：同时开始的音符中重要的先分配
+        for (size_t i = 0; i < notes.size(); ++i) {
+            order.push_back(i);
+        }
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            if (notes[a].start != notes[b].start) {
+                return notes[a].start < notes[b].start;
+            }
+            if (notes[a].weight != notes[b].weight) {
+                return notes[a].weight > notes[b].weight;
+            }
+            return a < b;
+        });
+        place_notes(notes, order, voices, result);
+        return result;
+    }
+
+    // 时间轴上的每个端点是一个节点，相邻端点之间连容量 voices、费用 0 的边，
+    // 每个音符从开始连到结束一条容量 1、费用为负重要性的边。送 voices 单位流的最小费用方案
+    // 中被用到的音符边就是重要性之和最大、任何时刻重叠不超过 voices 个的音符集合
+    std::vector<long> points;
+    points.reserve(notes.size() * 2);
+    double max_weight = 0;
+    for (const VoiceNote& note : notes) {
+        points.push_back(note.start);
+        points.push_back(std::max(note.end, note.start + 1));
+        max_weight = std::max(max_weight, note.weight);
+    }
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    auto node_of = [&](long tick) {
+        return static_cast<int>(std::lower_bound(points.begin(), points.end(), tick) - points.begin());
+    };
+
+    FlowGraph graph(static_cast<int>(points.size()));
+    for (int i = 0; i + 1 < static_cast<int>(points.size()); ++i) {
+        graph.add_edge(i, i + 1, voices, 0);
+    }
+    // 重要性换算成整数费用，避免浮点误差破坏 Dijkstra 的势能
+    const double scale = max_weight > 0 ? 1e9 / max_weight : 0;
+    std::vector<size_t> note_edge(notes.size(), static_cast<size_t>(-1));
+    for (size_t i = 0; i < notes.size(); ++i) {
+        int64_t weight = static_cast<int64_t>(std::llround(notes[i].weight * scale));
+        if (weight <= 0) {
+            continue;
+        }
+        note_edge[i] = graph.add_edge(node_of(notes[i].start), node_of(std::max(notes[i].end, notes[i].start + 1)), 1, -weight);
+    }
+    graph.min_cost_flow(voices);
+
+    for (size_t i = 0; i < notes.size(); ++i) {
+        if (note_edge[i] != static_cast<size_t>(-1) && graph.edge(node_of(notes[i].start), note_edge[i]).cap == 0) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        if (notes[a].start != notes[b].start) {
+            return notes[a].start < notes[b].start;
+        }
+        return a < b;
+    });
+    // 选出的音符任何时刻最多重叠 voices 个，按开始时间放置总能找到空闲声部
+    place_notes(notes, order, voices, result);
+    return result;
+}
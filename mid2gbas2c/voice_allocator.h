@@ -0,0 +1,24 @@
+#ifndef VOICE_ALLOCATOR_H
+#define VOICE_ALLOCATOR_H
+
+#include <vector>
+#include <cstddef>
+
+// 一个待分配的音符：占用声部的时间区间 [start, end)，单位 MIDI tick
+struct VoiceNote {
+    long start;          // 音符开始的 tick
+    long end;            // 声部空出来的 tick，包括释放尾音
+    double weight;       // 音符的重要性，保留的音符重要性之和越大越好
+    int midi_channel;    // 原始 MIDI 通道，分配时尽量让同一 MIDI 通道留在同一个声部上
+};
+
+// 超过这么多音符时 assign_voices 改用贪心分配
+const size_t kOptimalVoiceLimit = 500000;
+
+// 把音符分配到 voices 个声部上，同一声部上的音符区间互不重叠。
+// 选出的音符集合是重要性之和最大的可行集合（最小费用流，voices 次增广，O(n log n)），
+// 音符数超过 greedy_limit 时按开始时间贪心分配，没有空闲声部的音符被丢弃。
+// 返回每个音符的声部编号 1..voices，0 表示丢弃
+std::vector<int> assign_voices(const std::vector<VoiceNote>& notes, int voices, size_t greedy_limit = kOptimalVoiceLimit);
+
+#endif // VOICE_ALLOCATOR_H
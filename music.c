@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <string.h>
 #include <conio.h>
 #include <gigatron/sys.h>
 #include <gigatron/libc.h>
@@ -39,6 +40,18 @@ struct {
 
 #define NMIDIS (sizeof(midis)/sizeof(midis[0]))
 
+/* Songs converted together with gbas_to_c.py -d music_dict call
+   shared phrases in music_dict.gbas.c, which the decoder needs
+   before any of them plays. */
+extern void midi_dictionary(const byte **dict);
+/* Songs converted from gbas files made with midi_converter -drumkit
+   play DRUM patterns from the kit gbas_to_c.py writes next to them. */
+extern void midi_drums(const byte **kit);
+/* Songs converted with custom instrument waveforms upload them into
+   soundTable from the wave table gbas_to_c.py writes next to them. */
+extern void midi_waves(const byte **waves);
+//extern const byte* music_dict[];
+
 int mindex = 0;
 unsigned int startclk;
 
@@ -101,14 +114,136 @@ void sample_display(void)
   p = sb1; sb1 = sb2; sb2 = p;
 }
 
+/* EFFECTS */
+
+/* Effect stream in sound.s: plays over the music on the channels
+   given by mask (bit 0 = channel 1), which get their music state
+   back when the effect ends. */
+extern void sfx_play(const byte **sfx, byte mask);
+extern int sfx_playing(void);
+
+#define D(x) x
+#define X(c) 127+(c)
+#define W(c,n,v,w) 175+(c),(n),(v),(w)
+#define nohop __attribute__((nohop))
+
+nohop static const byte blip0[] = {
+  W(4,84,64,2),D(3),W(4,79,80,2),D(3),W(4,72,96,2),D(4),X(4),
+  0
+};
+
+nohop const byte *blip[] = { blip0, 0 };
+
+/* CHANNEL WINDOW */
+
+/* Channel state in sound.s: the vIRQ keeps (note,wavA) of each
+   music channel in the nohop array given to midi_visual(), with
+   note 0 when the channel is off. wavA is 127-volume, from 64
+   (loudest) to 127 (silent). */
+extern void midi_visual(byte *state);
+
+nohop byte chstate[8];
+byte chdrawn[8];
+byte chcolor[4] = { 0x0f, 0x3c, 0x33, 0x2f };
+byte visual;
+
+/* Each channel owns 16 lines of the sample window, one column per
+   midi note, and the column of its note shows the volume 127-wavA.
+   Only the columns of channels whose state changed are redrawn. */
+void channel_column(register int c, register byte color)
+{
+  register byte *s;
+  register int h;
+  if (chdrawn[c]) {
+    s = &screenMemory[SAMPLEY-48][16+chdrawn[c]] + (c << 11);
+    /* a raw W opcode or an sfx can set wavA below 64 */
+    h = (127 - chdrawn[c+1]) >> 2;
+    if (h > 15)
+      h = 15;
+    for (; h >= 0; h--) {
+      *s = color;
+      s -= 256;
+    }
+  }
+}
+
+void channel_display(void)
+{
+  register int c;
+  for (c = 0; c != 8; c += 2) {
+    if (chstate[c] != chdrawn[c] || chstate[c+1] != chdrawn[c+1]) {
+      channel_column(c, 0);
+      chdrawn[c] = chstate[c];
+      chdrawn[c+1] = chstate[c+1];
+      channel_column(c, chcolor[c >> 1]);
+    }
+  }
+}
+
+void toggle_display(void)
+{
+  visual = !visual;
+  memset(chdrawn, 0, sizeof(chdrawn));
+  clear_sample_display();
+}
+
+/* TEMPO */
+
+/* Delay scale in sound.s, frames per song frame in 8.8 fixed point:
+   256 plays at the converted speed, 512 at half speed. */
+extern void midi_set_tempo(unsigned int scale);
+
+unsigned int tempo = 256;
+
+void set_tempo(unsigned int scale)
+{
+  if (scale >= 64 && scale <= 1024) {
+    tempo = scale;
+    midi_set_tempo(tempo);
+    gotoxy(14,3);
+    cprintf("Tempo: %3d%%", (unsigned int)(25600L / tempo));
+  }
+}
+
+/* SEEK */
+
+/* Keyframe seek in sound.s: songs converted with gbas_to_c.py -k
+   resume at the last keyframe before the given second, whose time
+   in frames is returned, or -1 without keyframes. */
+extern int midi_seek(const byte **midi, int seconds);
+
+void seek_by(int delta)
+{
+  /* song seconds, taking the tempo scale into account */
+  register int pos = (int)(((long)(_clock()-startclk) << 8) / tempo / 60) + delta;
+  if (pos < 0)
+    pos = 0;
+  pos = midi_seek(midis[mindex].midi, pos);
+  if (pos >= 0)
+    startclk = _clock() - (unsigned int)(((long)pos * tempo) >> 8);
+}
+
 /* KEYS */
 
 void handle_keys()
 {
+  static byte lastchr;
   int nindex = mindex;
   byte chr = serialRaw;
   byte btn = buttonState;
-  if (chr >= '1' && chr < '1' + NMIDIS) {
+  if (chr == ' ') {
+    if (! sfx_playing())
+      sfx_play(blip, 8);
+  } else if (chr == '<' || chr == '>') {
+    if (chr != lastchr)
+      seek_by((chr == '<') ? -10 : 10);
+  } else if (chr == 'v') {
+    if (chr != lastchr)
+      toggle_display();
+  } else if (chr == '+' || chr == '-') {
+    if (chr != lastchr)
+      set_tempo((chr == '+') ? tempo - (tempo >> 3) : tempo + (tempo >> 3));
+  } else if (chr >= '1' && chr < '1' + NMIDIS) {
     nindex = chr - '1';
   } else if ((btn & (buttonUp|buttonLeft)) != (buttonUp|buttonLeft)) {
     buttonState |= buttonLeft | buttonUp;
@@ -117,6 +252,7 @@ void handle_keys()
     buttonState |= buttonDown | buttonRight;
     nindex += 1;
   }
+  lastchr = chr;
   if (nindex < 0)
     nindex = NMIDIS-1;
   else if (nindex >= NMIDIS)
@@ -127,10 +263,27 @@ void handle_keys()
   }
 }
 
+/* QUEUE */
+
+/* Play queue in sound.s: the vIRQ switches to the next queued song
+   without a gap and counts completed songs in midi_done(). */
+extern int midi_queue(const byte **midi);
+extern byte midi_done(void);
+
+void queue_next(void)
+{
+  register int qindex = mindex + 1;
+  if (qindex >= NMIDIS)
+    qindex = 0;
+  midi_queue(midis[qindex].midi);
+}
+
 /* MAIN */
 
 void main()
 {
+  byte done;
+
   //sound_sine_waveform(2);
   //sound_sine_waveform(1);
   //sound_sine_waveform(3);
@@ -142,13 +295,37 @@ void main()
   clear_sample_display();
   gotoxy(1,14);
   cprintf("Use digits or arrows");
+  gotoxy(1,15);
+  cprintf("Space plays an effect");
+  gotoxy(1,16);
+  cprintf("< and > seek 10s");
+  gotoxy(1,17);
+  cprintf("+ and - change tempo");
+  gotoxy(1,18);
+  cprintf("V shows the channels");
+  set_tempo(256);
+  midi_visual(chstate);
+  //midi_dictionary(music_dict);
 
   for(;;) {
     header_name();
     midi_play(midis[mindex].midi);
+    done = midi_done();
+    queue_next();
     while(midi_playing()) {
+      if (done != midi_done()) {
+        done += 1;
+        mindex = mindex + 1;
+        if (mindex >= NMIDIS)
+          mindex = 0;
+        header_name();
+        queue_next();
+      }
       header_time();
-      sample_display();
+      if (visual)
+        channel_display();
+      else
+        sample_display();
       handle_keys();
     }
     mindex = mindex + 1;
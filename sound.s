@@ -143,15 +143,36 @@ def scope():
         def code_midi_play():
             warning('midi_play() cannot work without vIRQ (needs rom>=v5a)', dedup=True)
             nohop()
+            label('midi_seek')
+            LDWI(-1);RET()
+            label('midi_set_tempo')
+            label('midi_dictionary')
+            label('midi_drums')
+            label('midi_waves')
+            label('midi_visual')
             label('midi_playing')
             label('midi_play')
             label('midi_chain')
+            label('midi_queue')
+            label('midi_done')
+            label('sfx_play')
+            label('sfx_playing')
             LDI(0);RET()
 
         module(name='midi_play.s',
                code=[('EXPORT','midi_play'),
                      ('EXPORT','midi_playing'),
                      ('EXPORT','midi_chain'),
+                     ('EXPORT','midi_queue'),
+                     ('EXPORT','midi_done'),
+                     ('EXPORT','sfx_play'),
+                     ('EXPORT','sfx_playing'),
+                     ('EXPORT','midi_seek'),
+                     ('EXPORT','midi_set_tempo'),
+                     ('EXPORT','midi_dictionary'),
+                     ('EXPORT','midi_drums'),
+                     ('EXPORT','midi_waves'),
+                     ('EXPORT','midi_visual'),
                      ('CODE','midi_play',code_midi_play)] )
     else:
 
@@ -174,30 +195,117 @@ def scope():
             space(2)
             label('_midi.cmd')
             space(2)
+            label('_midi.qh')   # play queue head index
+            space(1)
+            label('_midi.qn')   # play queue length
+            space(1)
+            label('_midi.done') # songs completed (wraps)
+            space(1)
+            label('_midi.chn')  # register block of the current channel
+            space(2)
+            label('_midi.r')    # return position of the phrase being played
+            space(2)
+            label('_midi.dict') # phrase dictionary set by midi_dictionary()
+            space(2)
+            label('_midi.waves') # wave table set by midi_waves()
+            space(2)
+            label('_midi.vc')   # (note,wavA) entry of the current channel
+            space(2)
+
+        def code_midi_map():
+            label('_midi.map')  # channel map used by the decoder
+            words('_midi.chp')
+
+        def code_midi_vis():
+            label('_midi.vis')  # channel state set by midi_visual()
+            words('_midi.vnull')
+
+        def code_midi_vnull():
+            # channel state written while no program reads it,
+            # and by the effect stream
+            label('_midi.vnull')
+            space(8)
+
+        def code_midi_tempo():
+            label('_midi.tempo') # frames per song frame, 8.8 fixed point
+            words(256)
+            label('_midi.frac')  # fraction carried between delays
+            bytes(0)
+
+        def code_midi_chp():
+            # Register block (wavA,wavX,keyL,keyH) of each channel.
+            # The music stream goes through '_midi.chp', whose entries
+            # point into '_midi.shadow' while an effect owns the channel.
+            label('_midi.chp')
+            words(0x1fa, 0x2fa, 0x3fa, 0x4fa)
+            label('_sfx.chp')
+            words(0x1fa, 0x2fa, 0x3fa, 0x4fa)
+
+        def code_midi_shadow():
+            label('_midi.shadow')
+            space(16)
+
+        def code_midi_svars():
+            label('_sfx.p')
+            space(2)
+            label('_sfx.q')
+            space(2)
+            label('_sfx.t')
+            space(2)
+            label('_sfx.n')     # pending effect for the vIRQ
+            space(2)
+            label('_sfx.mask')  # channels owned by the effect
+            space(1)
+            label('_sfx.nmask') # pending channels, bit 7 = request
+            space(1)
+
+        def code_fx_vars():
+            label('_fx.t')      # frame of the next effect step
+            space(2)
+            label('_fx.on')     # nonzero while a channel has an effect
+            space(1)
+            label('_fx.kit')    # drum kit set by midi_drums()
+            space(2)
+
+        def code_fx_data():
+            # Effect record of each music channel, 8 bytes at 8*c:
+            # type (0 none, 1 arpeggio, 2 drum), rate, count, then
+            # index and notes[4] for an arpeggio, or the position
+            # of the next (note,wavA) step for a drum. Ramps (3 fade,
+            # 7 glide) hold target, frames left, -, value, step.
+            label('_fx.data')
+            space(32)
+
+        def code_midi_qvars():
+            # ring of four song descriptors (pointer tables)
+            # consumed by the vIRQ when a song reaches its end
+            label('_midi.queue')
+            space(8)
 
         def code_midi_note():
             nohop()
             label('.midi_note')
             #------note----start---------------------------------------
             
-            # set note
-            ADDI(0x10);STW(vLR)
+            # set note; vLR is <0 for N, 0-3 for M, 16-19 for W
+            ADDI(0x14);STW(vLR)
             LDW('_midi.p');PEEK();INC('_midi.p');STW('_midi.cmd')
+            POKE('_midi.vc')
 
             # set volume
             LDW(vLR);_BLT('.freq')
-            LDI(0xfa);ST('_midi.tmp')
-            LDW('_midi.p');PEEK();INC('_midi.p');POKE('_midi.tmp')
+            LDW('_midi.p');PEEK();INC('_midi.p');POKE('_midi.chn')
+            INC('_midi.vc');POKE('_midi.vc')
             
             # set wave 
-            LDW(vLR);_BLT('.freq')
-            LDI(0xfb);ST('_midi.tmp') 
+            LDW(vLR);SUBI(0x10);_BLT('.freq')
+            LDW('_midi.chn');ADDI(1);STW('_midi.tmp')
             LDW('_midi.p');PEEK();INC('_midi.p');POKE('_midi.tmp')
 
             # Read 'w' and write to 0xfb
             #-------note---end-------------------------------------------
             label('.freq')
-            LDI(0xfc);ST('_midi.tmp')
+            LDW('_midi.chn');ADDI(2);STW('_midi.tmp')
             LDWI(v('notesTable')-22);ADDW('_midi.cmd');ADDW('_midi.cmd');STW('_midi.cmd')
             LUP(0);ST(vLR);LDW('_midi.cmd');LUP(1);ST(vLR+1)
             LDW(vLR);DOKE('_midi.tmp');_CALLJ('.getcmd')
@@ -209,66 +317,474 @@ def scope():
             # obtain command
             label('.getcmd')
             LDW('_midi.p');PEEK();_BNE('.docmd')
-            LDW('_midi.q');DEEK();_BEQ('.fin')
-            STW('_midi.p');INC('_midi.q');INC('_midi.q');_BRA('.getcmd')
+            LDW('_midi.q');DEEK();_BEQ('.next')
+            STW('_midi.p');INC('_midi.q');INC('_midi.q')
+            SUBI(1);_BNE('.getcmd')
+            # loop-back entry: marker 1, new stream pointer, new table pointer
+            LDW('_midi.q');DEEK();STW('_midi.p')
+            INC('_midi.q');INC('_midi.q')
+            LDW('_midi.q');DEEK();STW('_midi.q');_BRA('.getcmd')
+            # end of song: count it and dequeue the next one
+            label('.next')
+            LDWI('_midi.chp');XORW('_midi.map');_BNE('.fin')
+            INC('_midi.done')
+            LD('_midi.qn');_BEQ('.fin')
+            CALLI('.fx_clear')
+            LD('_midi.qn')
+            SUBI(1);ST('_midi.qn')
+            LD('_midi.qh');LSLW();STW('_midi.tmp')
+            LDWI('_midi.queue');ADDW('_midi.tmp');DEEK();STW('_midi.q')
+            LD('_midi.qh');ADDI(1);ANDI(3);ST('_midi.qh')
+            _BRA('.getcmd')
             # process command
             label('.docmd')
             INC('_midi.p');STW('_midi.cmd')
-            ANDI(3);INC(vACL);ST(v('_midi.tmp')+1)
             # delay
-            LDW('_midi.cmd');SUBI(0x80);_BGE('.xcmd')
+            SUBI(0x80);_BGE('.xcmd')
+            LDWI(256);XORW('_midi.tempo');_BNE('.tempo')
+            label('.delay')
             if args.cpu >= 7:
                 LD('_midi.cmd');ADDV('_midi.t')
             else:
                 LD('_midi.cmd');ADDW('_midi.t');STW('_midi.t')
             POP();RET();
-            # note off
+            # locate channel registers
             label('.xcmd')
-            SUBI(0x10);_BGE('.ncmd')
-            LDI(0xfc);ST('_midi.tmp')
-            LDI(0);DOKE('_midi.tmp');_BRA('.getcmd')
+            LDW('_midi.cmd');ANDI(3);LSLW();STW('_midi.vc')
+            ADDW('_midi.map');DEEK();STW('_midi.chn')
+            # channel state of the music stream for midi_visual()
+            LDWI('_midi.chp');XORW('_midi.map');_BEQ('.xvis')
+            LDWI('_midi.vnull');_BRA('.xvc')
+            label('.xvis')
+            LD('_fx.on');_BEQ('.xvf')
+            CALLI('.fx_cancel')
+            label('.xvf')
+            LDW('_midi.vc');ADDW('_midi.vis')
+            label('.xvc')
+            STW('_midi.vc')
+            # note off
+            LDW('_midi.cmd');SUBI(0x90);_BGE('.ncmd')
+            LDW('_midi.chn');ADDI(2);STW('_midi.tmp')
+            LDI(0);DOKE('_midi.tmp');POKE('_midi.vc');_BRA('.getcmd')
             # note on
             label('.ncmd')
             SUBI(0x24) # Adjusted to include W(c,n,v,w) 
             if args.cpu >= 6:
                 JLT('.midi_note')
             else:
-                _BGE('.fin');CALLI('.midi_note')
+                _BGE('.pcmd');CALLI('.midi_note')
+                label('.pcmd')
+            # phrase call and return
+            SUBI(2);_BLT('.midi_phrase')
+            # waveform upload, 0xb7 ends the song
+            SUBI(1);_BLT('.midi_wave')
+            SUBI(1);_BLT('.fin')
+            # channel effects and ramps
+            SUBI(8);_BLT('.midi_fx')
+            SUBI(8);_BLT('.midi_ramp')
             # end
             label('.fin')
-            POP();POP() # pop one more level
-            LDI(0);ST('soundTimer');STW('_midi.q')
-            label('.ret')
-            RET()
+            LDI(0);STW('_midi.q')
+            POP();RET()
+
+        def code_midi_phrase():
+            nohop()
+            # P(i): play entry i of the dictionary, whose R() returns
+            # to the command after P(i). Phrases do not nest.
+            label('.midi_phrase')
+            ADDI(1);_BEQ('.pret')
+            LDW('_midi.p');ADDI(1);STW('_midi.r')
+            LDW('_midi.p');PEEK();LSLW();ADDW('_midi.dict');DEEK();STW('_midi.p')
+            _CALLJ('.getcmd')
+            label('.pret')
+            LDW('_midi.r');STW('_midi.p')
+            _CALLJ('.getcmd')
+
+        def code_midi_wave():
+            nohop()
+            # WAVE(w,i): copy the 64 samples of entry i of the wave
+            # table into waveform w of soundTable, every 4th byte
+            label('.midi_wave')
+            LDW('_midi.p');PEEK();ANDI(3);ST('_midi.tmp')
+            LDI(v('soundTable')>>8);ST(v('_midi.tmp')+1)
+            INC('_midi.p');LDW('_midi.p');PEEK();INC('_midi.p')
+            LSLW();ADDW('_midi.waves');DEEK();STW('_midi.cmd')
+            label('.wv1')
+            LDW('_midi.cmd');PEEK();POKE('_midi.tmp');INC('_midi.cmd')
+            LD('_midi.tmp');ADDI(4);ST('_midi.tmp');ANDI(0xfc);_BNE('.wv1')
+            _CALLJ('.getcmd')
+
+        def code_midi_scale():
+            nohop()
+            # scaled delay for the music stream: t += (cmd*tempo+frac)>>8
+            label('.tempo')
+            LDWI('_midi.chp');XORW('_midi.map');_BNE('.delay')
+            LDI(0);STW('_midi.chn');STW('_midi.tmp')
+            LD('_midi.cmd');LSLW();ORI(1);ST('_midi.cmd')
+            # cmd*tempoL in chn, cmd*tempoH in tmp, msb first
+            label('.tp1')
+            LDW('_midi.chn');LSLW();STW('_midi.chn')
+            LDW('_midi.tmp');LSLW();STW('_midi.tmp')
+            LD('_midi.cmd');ANDI(0x80);_BEQ('.tp2')
+            LD('_midi.tempo');ADDW('_midi.chn');STW('_midi.chn')
+            LD(v('_midi.tempo')+1);ADDW('_midi.tmp');STW('_midi.tmp')
+            label('.tp2')
+            LD('_midi.cmd');LSLW();ST('_midi.cmd')
+            LD('_midi.cmd');XORI(0x80);_BNE('.tp1')
+            LD('_midi.frac');ADDW('_midi.chn');STW('_midi.chn')
+            ST('_midi.frac')
+            LD(v('_midi.chn')+1);ADDW('_midi.tmp')
+            ADDW('_midi.t');STW('_midi.t')
+            POP();RET()
 
         def code_midi_irq():
             nohop()
             label('_vIrqAltHandler')
-            LDW('_midi.q');_BEQ('.rti0')
+            LD('_sfx.nmask');ORW('_sfx.q');ORW('_midi.q');_BEQ('.rti0')
             PUSH()
             LDI(255);ST('soundTimer')
-            _BRA('.irq1')
+            LD('_sfx.nmask');_BEQ('.irq1')
+            CALLI('.sfx_start')
+            label('.irq1')
+            LDW('_midi.q');_BEQ('.irq3')
+            # channel effects, stepped before the commands of the frame
+            LD('_fx.on');_BEQ('.irqm')
+            LD('frameCount');ADDW('_vIrqTicks');SUBW('_fx.t');_BLT('.irqm')
+            CALLI('.fx_tick')
+            _BRA('.irqm')
+            # music stream
             label('.irq0')
             CALLI('.midi_tick')
             CALLI('_vBlnAvoid')
-            label('.irq1')
+            LDW('_midi.q');_BEQ('.irq3')
+            label('.irqm')
             LD('frameCount');ADDW('_vIrqTicks');SUBW('_midi.t');_BGE('.irq0')
+            _BRA('.irq3')
+            # effect stream
+            label('.irq2')
+            CALLI('.sfx_tick')
+            CALLI('_vBlnAvoid')
+            label('.irq3')
+            LDW('_sfx.q');_BEQ('.irq5')
+            LD('frameCount');ADDW('_vIrqTicks');SUBW('_sfx.t');_BGE('.irq2')
+            # wake up for the earliest stream
+            LDW('_midi.q');_BEQ('.irq4')
+            LDW('_sfx.t');SUBW('_midi.t');_BGE('.irq6')
+            label('.irq4')
+            LDW('_sfx.t');_BRA('.irq7')
+            label('.irq5')
+            LDW('_midi.q');_BEQ('.stop')
+            label('.irq6')
+            LDW('_midi.t')
+            label('.irq7')
+            STW('_midi.tmp')
+            # channel effects wake up every frame
+            LD('_fx.on');_BEQ('.rti')
+            LDW('_midi.q');_BEQ('.rti')
+            LDW('_fx.t');SUBW('_midi.tmp');_BGE('.rti')
+            LDW('_fx.t');STW('_midi.tmp')
             label('.rti')
+            LD('frameCount');ADDW('_vIrqTicks');SUBW('_midi.tmp')
             POP()
             ST('frameCount')
-            LDW('_midi.t');ST('_vIrqTicks')
+            LDW('_midi.tmp');ST('_vIrqTicks')
             XORW('_vIrqTicks');_BNE('.rti0') # return to carry in virqticks
             POP();LDWI(0x400);LUP(0)         # no carry
+            label('.stop')
+            LDI(0);ST('soundTimer')
+            POP()
             label('.rti0')
             RET()
 
+        def code_midi_sfx():
+            nohop()
+            # Run one effect tick with the effect stream swapped
+            # into the decoder state and the identity channel map.
+            label('.sfx_tick')
+            PUSH()
+            CALLI('.sfx_swap')
+            LDWI('_sfx.chp');STW('_midi.map')
+            CALLI('.midi_tick')
+            LDWI('_midi.chp');STW('_midi.map')
+            CALLI('.sfx_swap')
+            LDW('_sfx.q');_BNE('.sft1')
+            CALLI('.sfx_restore')
+            label('.sft1')
+            POP();RET()
+            label('.sfx_swap')
+            LDW('_midi.p');STW('_midi.tmp');LDW('_sfx.p');STW('_midi.p');LDW('_midi.tmp');STW('_sfx.p')
+            LDW('_midi.q');STW('_midi.tmp');LDW('_sfx.q');STW('_midi.q');LDW('_midi.tmp');STW('_sfx.q')
+            LDW('_midi.t');STW('_midi.tmp');LDW('_sfx.t');STW('_midi.t');LDW('_midi.tmp');STW('_sfx.t')
+            RET()
+            # Accept the effect requested by sfx_play()
+            label('.sfx_start')
+            PUSH()
+            CALLI('.sfx_restore')
+            LD('_sfx.nmask');ANDI(15);ST('_sfx.mask')
+            LDI(0);ST('_sfx.nmask');STW('_sfx.p')
+            LDW('_sfx.n');STW('_sfx.q');_BEQ('.sfs1')
+            CALLI('.sfx_claim')
+            LD('frameCount');ADDW('_vIrqTicks');STW('_sfx.t')
+            label('.sfs1')
+            POP();RET()
+
+        def code_midi_sfxch():
+            nohop()
+            # Give the effect channels back to the music stream,
+            # restoring the registers it wrote in the shadow area.
+            label('.sfx_restore')
+            PUSH()
+            LDWI(0x1fa);STW('_midi.cmd')
+            LDWI('_midi.shadow');STW('_midi.tmp')
+            LDWI('_midi.chp');STW('_midi.chn')
+            LDI(1);STW(vLR)
+            label('.sfr1')
+            LD('_sfx.mask');ANDW(vLR);_BEQ('.sfr2')
+            LDW('_midi.cmd');DOKE('_midi.chn')
+            LDW('_midi.tmp');DEEK();DOKE('_midi.cmd')
+            INC('_midi.tmp');INC('_midi.tmp');INC('_midi.cmd');INC('_midi.cmd')
+            LDW('_midi.tmp');DEEK();DOKE('_midi.cmd')
+            LD('_midi.tmp');SUBI(2);ST('_midi.tmp')
+            LD('_midi.cmd');SUBI(2);ST('_midi.cmd')
+            label('.sfr2')
+            INC('_midi.chn');INC('_midi.chn');INC(v('_midi.cmd')+1)
+            LD('_midi.tmp');ADDI(4);ST('_midi.tmp')
+            LDW(vLR);LSLW();STW(vLR);XORI(16);_BNE('.sfr1')
+            LDI(0);ST('_sfx.mask')
+            POP();RET()
+            # Take the effect channels from the music stream,
+            # saving their current registers in the shadow area.
+            label('.sfx_claim')
+            PUSH()
+            LDWI(0x1fa);STW('_midi.cmd')
+            LDWI('_midi.shadow');STW('_midi.tmp')
+            LDWI('_midi.chp');STW('_midi.chn')
+            LDI(1);STW(vLR)
+            label('.sfc1')
+            LD('_sfx.mask');ANDW(vLR);_BEQ('.sfc2')
+            LDW('_midi.tmp');DOKE('_midi.chn')
+            LDW('_midi.cmd');DEEK();DOKE('_midi.tmp')
+            INC('_midi.tmp');INC('_midi.tmp');INC('_midi.cmd');INC('_midi.cmd')
+            LDW('_midi.cmd');DEEK();DOKE('_midi.tmp')
+            LD('_midi.tmp');SUBI(2);ST('_midi.tmp')
+            LD('_midi.cmd');SUBI(2);ST('_midi.cmd')
+            label('.sfc2')
+            INC('_midi.chn');INC('_midi.chn');INC(v('_midi.cmd')+1)
+            LD('_midi.tmp');ADDI(4);ST('_midi.tmp')
+            LDW(vLR);LSLW();STW(vLR);XORI(16);_BNE('.sfc1')
+            POP();RET()
+
+        def code_midi_fx():
+            nohop()
+            # A(c,r,n0,n1,n2,n3): play n0 on channel c, then the next
+            # note every r frames, wrapping after n3 or at a 0 note.
+            # DRUM(c,i): play pattern i of the drum kit on channel c,
+            # (rate,wavX) then a (note,wavA) step every rate frames
+            # until a 0 note. Music stream only, the effect stream
+            # skips them.
+            label('.midi_fx')
+            LDWI('_midi.chp');XORW('_midi.map');_BNE('.fxs')
+            LD('_midi.cmd');ANDI(3);LSLW();LSLW();LSLW();STW('_midi.tmp')
+            LDWI('_fx.data');ADDW('_midi.tmp');STW('_midi.tmp')
+            LD('_midi.cmd');ANDI(4);_BNE('.drum')
+            # type 1, rate r, count r, index 0, then the notes
+            LDI(1);POKE('_midi.tmp');INC('_midi.tmp')
+            LDW('_midi.p');PEEK();INC('_midi.p');POKE('_midi.tmp');INC('_midi.tmp')
+            DOKE('_midi.tmp');INC('_midi.tmp');INC('_midi.tmp')
+            LDW('_midi.p');PEEK();STW('_midi.cmd');POKE('_midi.vc')
+            LDW('_midi.p');DEEK();DOKE('_midi.tmp')
+            INC('_midi.p');INC('_midi.p');INC('_midi.tmp');INC('_midi.tmp')
+            LDW('_midi.p');DEEK();DOKE('_midi.tmp')
+            INC('_midi.p');INC('_midi.p')
+            _BRA('.fxon')
+            # type 2, rate, count rate, the step after the first
+            label('.drum')
+            LDW('_midi.p');PEEK();INC('_midi.p');LSLW();ADDW('_fx.kit');DEEK();STW(vLR)
+            LDI(2);POKE('_midi.tmp');INC('_midi.tmp')
+            LDW(vLR);PEEK();POKE('_midi.tmp');INC('_midi.tmp');POKE('_midi.tmp')
+            INC('_midi.tmp');INC('_midi.tmp')
+            LDW(vLR);ADDI(4);DOKE('_midi.tmp')
+            LDW('_midi.chn');ADDI(1);STW('_midi.tmp')
+            LDW(vLR);ADDI(1);PEEK();POKE('_midi.tmp')
+            LDW(vLR);ADDI(2);PEEK();STW('_midi.cmd');POKE('_midi.vc');INC('_midi.vc')
+            LDW(vLR);ADDI(3);PEEK();POKE('_midi.chn');POKE('_midi.vc')
+            label('.fxon')
+            LD('_fx.on');_BNE('.fxo1')
+            LDI(1);ST('_fx.on')
+            LD('frameCount');ADDW('_vIrqTicks');ADDI(1);STW('_fx.t')
+            label('.fxo1')
+            _CALLJ('.freq')
+            # effect stream: skip 5 operands for A, 1 for DRUM
+            label('.fxs')
+            LD('_midi.cmd');ANDI(4);_BNE('.fxs1')
+            LDW('_midi.p');ADDI(4);STW('_midi.p')
+            label('.fxs1')
+            INC('_midi.p');_CALLJ('.getcmd')
+
+        def code_midi_fxtick():
+            nohop()
+            # Step the effect of each music channel, called every
+            # frame while '_fx.on' is set, which it recomputes.
+            label('.fx_tick')
+            PUSH()
+            LDI(0);ST('_fx.on')
+            LDWI('_fx.data');STW('_midi.cmd')
+            LDWI('_midi.chp');STW('_midi.chn')
+            label('.fxt1')
+            LDW('_midi.cmd');PEEK();_BEQ('.fxt9')
+            ST('_fx.on')
+            SUBI(3);_BGE('.fxr')
+            # count down from the rate, then take the next step
+            LDW('_midi.cmd');ADDI(2);STW('_midi.tmp')
+            PEEK();SUBI(1);POKE('_midi.tmp');_BNE('.fxt9')
+            LDW('_midi.cmd');ADDI(1);PEEK();POKE('_midi.tmp');INC('_midi.tmp')
+            LD('_fx.on');XORI(1);_BNE('.fxd')
+            # arpeggio: next note, back to n0 after n3 or at a 0 note
+            LDW('_midi.tmp');PEEK();ADDI(1);ANDI(3);STW(vLR)
+            LDW('_midi.cmd');ADDI(4);ADDW(vLR);PEEK();_BNE('.fxt2')
+            STW(vLR)
+            LDW('_midi.cmd');ADDI(4);PEEK()
+            label('.fxt2')
+            STW('_midi.vc')
+            LD(vLR);POKE('_midi.tmp')
+            label('.fxt3')
+            LDWI(v('notesTable')-22);ADDW('_midi.vc');ADDW('_midi.vc');STW('_midi.vc')
+            LUP(0);ST(vLR);LDW('_midi.vc');LUP(1);ST(vLR+1)
+            LDW('_midi.chn');DEEK();ADDI(2);STW('_midi.tmp')
+            LDW(vLR);DOKE('_midi.tmp')
+            label('.fxt9')
+            INC('_midi.chn');INC('_midi.chn')
+            LD('_midi.cmd');ADDI(8);ST('_midi.cmd');ANDI(31);_BNE('.fxt1')
+            LD('frameCount');ADDW('_vIrqTicks');ADDI(1);STW('_fx.t')
+            POP();RET()
+            # drum: set wavA and the note of the next step, a 0 note
+            # ends the pattern and leaves the channel as it is
+            label('.fxd')
+            INC('_midi.tmp');LDW('_midi.tmp');DEEK();STW(vLR)
+            PEEK();_BEQ('.fxd1')
+            LDW(vLR);ADDI(2);DOKE('_midi.tmp')
+            LDW('_midi.chn');DEEK();STW('_midi.tmp')
+            LDW(vLR);ADDI(1);PEEK();POKE('_midi.tmp')
+            LDW(vLR);PEEK();STW('_midi.vc');_BRA('.fxt3')
+            label('.fxd1')
+            POKE('_midi.cmd');_BRA('.fxt9')
+
+        def code_midi_ramp():
+            nohop()
+            # FADE(c,v,f,s): take wavA of channel c to v in f frames,
+            # adding the 8.8 step s every frame. GLIDE(c,n,f,s): the
+            # same for the 7.7 frequency key, ending on note n. Music
+            # stream only, the effect stream skips them.
+            label('.midi_ramp')
+            LDWI('_midi.chp');XORW('_midi.map');_BNE('.rps')
+            LD('_midi.cmd');ANDI(3);LSLW();LSLW();LSLW();STW('_midi.tmp')
+            LDWI('_fx.data');ADDW('_midi.tmp');STW('_midi.tmp')
+            # type 3 or 7, target, frames, then the step at +6
+            LD('_midi.cmd');ANDI(4);ORI(3);POKE('_midi.tmp');INC('_midi.tmp')
+            LDW('_midi.p');DEEK();DOKE('_midi.tmp');ST(vLR)
+            LD('_midi.tmp');ADDI(5);ST('_midi.tmp')
+            INC('_midi.p');INC('_midi.p')
+            LDW('_midi.p');DEEK();DOKE('_midi.tmp')
+            INC('_midi.p');INC('_midi.p')
+            LD('_midi.tmp');SUBI(2);ST('_midi.tmp')
+            LD('_midi.cmd');ANDI(4);_BNE('.rpg')
+            # fade: the value is wavA.128, midi_visual() sees the target
+            INC('_midi.vc');LD(vLR);POKE('_midi.vc')
+            LDW('_midi.chn');PEEK();ST(vLR+1);LDI(0x80);ST(vLR)
+            LDW(vLR);_BRA('.rpon')
+            # glide: the value is the key as keyH*128+keyL
+            label('.rpg')
+            LD(vLR);POKE('_midi.vc')
+            LDW('_midi.chn');ADDI(3);PEEK()
+            LSLW();LSLW();LSLW();LSLW();LSLW();LSLW();LSLW();STW(vLR)
+            LDW('_midi.chn');ADDI(2);PEEK();ADDW(vLR)
+            label('.rpon')
+            DOKE('_midi.tmp')
+            LD('_fx.on');_BNE('.rpo1')
+            LDI(1);ST('_fx.on')
+            LD('frameCount');ADDW('_vIrqTicks');ADDI(1);STW('_fx.t')
+            label('.rpo1')
+            _CALLJ('.getcmd')
+            # effect stream: skip the 4 operands
+            label('.rps')
+            LDW('_midi.p');ADDI(4);STW('_midi.p')
+            _CALLJ('.getcmd')
+
+        def code_midi_fxramp():
+            nohop()
+            # Ramp step of .fx_tick: add the step to the value until
+            # the last frame, which sets the target and ends the ramp
+            label('.fxr')
+            LDW('_midi.cmd');ADDI(2);STW('_midi.tmp')
+            PEEK();SUBI(1);POKE('_midi.tmp');_BEQ('.fxr2')
+            LDW('_midi.cmd');ADDI(6);DEEK();STW(vLR)
+            LD('_midi.tmp');ADDI(2);ST('_midi.tmp')
+            LDW('_midi.tmp');DEEK();ADDW(vLR);DOKE('_midi.tmp');STW(vLR)
+            LDW('_midi.chn');DEEK();STW('_midi.tmp')
+            LD('_fx.on');ANDI(4);_BNE('.fxrg')
+            # fade: wavA is the high byte
+            LD(vLR+1);POKE('_midi.tmp');_BRA('.fxt9')
+            # glide: keyL is the low 7 bits, keyH the rest
+            label('.fxrg')
+            INC('_midi.tmp');INC('_midi.tmp')
+            LD(vLR);ANDI(127);POKE('_midi.tmp');INC('_midi.tmp')
+            LDW(vLR);LSLW();STW(vLR);LD(vLR+1);POKE('_midi.tmp')
+            _BRA('.fxt9')
+            label('.fxr2')
+            POKE('_midi.cmd')
+            LDW('_midi.cmd');ADDI(1);PEEK();STW('_midi.vc')
+            LD('_fx.on');ANDI(4);_BNE('.fxt3')
+            LDW('_midi.chn');DEEK();STW('_midi.tmp')
+            LD('_midi.vc');POKE('_midi.tmp');_BRA('.fxt9')
+
+        def code_midi_fxend():
+            nohop()
+            # A channel command of the music stream ends the effect
+            # of its channel, P(i), R() and effect commands do not
+            label('.fx_cancel')
+            LDW('_midi.cmd');SUBI(0xb4);_BGE('.fxx1')
+            LDW('_midi.vc');LSLW();LSLW();STW('_midi.tmp')
+            LDWI('_fx.data');ADDW('_midi.tmp');STW('_midi.tmp')
+            LDI(0);POKE('_midi.tmp')
+            label('.fxx1')
+            RET()
+            # End all effects, from the vIRQ
+            label('.fx_clear')
+            LDWI('_fx.data');STW('_midi.tmp')
+            label('.fxc1')
+            LDI(0);POKE('_midi.tmp')
+            LD('_midi.tmp');ADDI(8);ST('_midi.tmp');ANDI(31);_BNE('.fxc1')
+            ST('_fx.on');RET()
+            # End all effects, with the music stopped
+            label('_fx.reset')
+            LDWI('_fx.data');STW(T3)
+            label('.fxr1')
+            LDI(0);POKE(T3)
+            LD(T3);ADDI(8);ST(T3);ANDI(31);_BNE('.fxr1')
+            ST('_fx.on');RET()
+
         def code_midi_play():
             nohop()
             label('midi_play')
             PUSH()
-            LDI(0);STW('_midi.q');STW('_midi.p')
+            LDI(0);STW('_midi.q');STW('_midi.p');ST('_midi.qn')
             CALLI('sound_all_off')
+            CALLI('_fx.reset')
+            LDW('_midi.vis');STW(T3)
+            LDI(0);DOKE(T3);INC(T3);INC(T3);DOKE(T3);INC(T3);INC(T3)
+            DOKE(T3);INC(T3);INC(T3);DOKE(T3)
             LDW(R8);BEQ('.play3')
+            CALLI('_midi.start')
+            # wait for first play
+            label('.play2')
+            LDW('_midi.p');_BEQ('.play2')
+            # done
+            label('.play3')
+            POP();RET()
+            # start the table in vAC at the next frame,
+            # resuming at '_midi.p' when it is nonzero
+            label('_midi.start')
+            PUSH();STW(T3)
             # arrange speedy start
             CALLI('_vBlnAvoid')
             LD('frameCount');INC(vACL);_BEQ('.play1')
@@ -277,17 +793,17 @@ def scope():
             LDW(LAC+2);STW(v('_vIrqTicks')+2)
             # set interrupt
             label('.play1')
-            LDW(R8);STW('_midi.q')
+            LDI(0);ST('_midi.frac')
+            LDW('_vIrqTicks');STW('_midi.t')
+            LDW(T3);STW('_midi.q')
             LDI(0xff);ST('frameCount')
-            # wait for first play
-            label('.play2')
-            LDW('_midi.p');_BEQ('.play2')
-            # done
-            label('.play3')
             POP();RET()
 
         module(name='midi_play.s',
                code=[('EXPORT','midi_play'),
+                     ('EXPORT','_midi.start'),
+                     ('EXPORT','_midi.tempo'),
+                     ('EXPORT','_midi.chp'),
                      ('EXPORT','_vIrqAltHandler'),
                      ('IMPORT','_midi.p'),
                      ('IMPORT','_midi.q'),
@@ -295,14 +811,62 @@ def scope():
                      ('IMPORT','_vIrqTicks'),
                      ('IMPORT','_vBlnAvoid'),
                      ('IMPORT','_clock.sub'),
-                     ('BSS',   'midi_tvars', code_midi_tvars, 6, 1),
+                     ('EXPORT','_midi.qh'),
+                     ('EXPORT','_midi.qn'),
+                     ('EXPORT','_midi.done'),
+                     ('EXPORT','_midi.queue'),
+                     ('EXPORT','_sfx.q'),
+                     ('EXPORT','_sfx.n'),
+                     ('EXPORT','_sfx.nmask'),
+                     ('EXPORT','_midi.dict'),
+                     ('EXPORT','_midi.vis'),
+                     ('EXPORT','_midi.vnull'),
+                     ('EXPORT','_fx.reset'),
+                     ('EXPORT','_fx.kit'),
+                     ('EXPORT','_midi.waves'),
+                     ('BSS',   'midi_tvars', code_midi_tvars, 19, 1),
                      ('PLACE', 'midi_tvars', 0x0000, 0x00ff),
+                     ('DATA',  'midi_map', code_midi_map, 2, 1),
+                     ('PLACE', 'midi_map', 0x0000, 0x00ff),
+                     ('DATA',  'midi_vis', code_midi_vis, 2, 1),
+                     ('PLACE', 'midi_vis', 0x0000, 0x00ff),
+                     ('BSS',   'midi_vnull', code_midi_vnull, 8, 8),
+                     ('DATA',  'midi_tempo', code_midi_tempo, 3, 1),
+                     ('PLACE', 'midi_tempo', 0x0000, 0x00ff),
+                     ('BSS',   'midi_svars', code_midi_svars, 10, 1),
+                     ('PLACE', 'midi_svars', 0x0000, 0x00ff),
+                     ('BSS',   'fx_vars', code_fx_vars, 5, 1),
+                     ('PLACE', 'fx_vars', 0x0000, 0x00ff),
+                     ('BSS',   'fx_data', code_fx_data, 32, 32),
+                     ('BSS',   'midi_queue', code_midi_qvars, 8, 2),
+                     ('DATA',  'midi_chp', code_midi_chp, 16, 16),
+                     ('BSS',   'midi_shadow', code_midi_shadow, 16, 16),
                      ('CODE',  'midi_note', code_midi_note),
                      ('PLACE', 'midi_note', 0x0100, 0x7fff),
                      ('CODE',  'midi_tick', code_midi_tick),
                      ('PLACE', 'midi_tick', 0x0100, 0x7fff),
+                     ('CODE',  'midi_phrase', code_midi_phrase),
+                     ('PLACE', 'midi_phrase', 0x0100, 0x7fff),
+                     ('CODE',  'midi_wave', code_midi_wave),
+                     ('PLACE', 'midi_wave', 0x0100, 0x7fff),
+                     ('CODE',  'midi_scale', code_midi_scale),
+                     ('PLACE', 'midi_scale', 0x0100, 0x7fff),
                      ('CODE',  '_vIrqAltHandler', code_midi_irq),
                      ('PLACE', '_vIrqAltHandler', 0x0100, 0x7fff),
+                     ('CODE',  'midi_sfx', code_midi_sfx),
+                     ('PLACE', 'midi_sfx', 0x0100, 0x7fff),
+                     ('CODE',  'midi_sfxch', code_midi_sfxch),
+                     ('PLACE', 'midi_sfxch', 0x0100, 0x7fff),
+                     ('CODE',  'midi_fx', code_midi_fx),
+                     ('PLACE', 'midi_fx', 0x0100, 0x7fff),
+                     ('CODE',  'midi_fxtick', code_midi_fxtick),
+                     ('PLACE', 'midi_fxtick', 0x0100, 0x7fff),
+                     ('CODE',  'midi_ramp', code_midi_ramp),
+                     ('PLACE', 'midi_ramp', 0x0100, 0x7fff),
+                     ('CODE',  'midi_fxramp', code_midi_fxramp),
+                     ('PLACE', 'midi_fxramp', 0x0100, 0x7fff),
+                     ('CODE',  'midi_fxend', code_midi_fxend),
+                     ('PLACE', 'midi_fxend', 0x0100, 0x7fff),
                      ('CODE',  'midi.play', code_midi_play) ] )
 
         def code_midi_playing():
@@ -332,6 +896,215 @@ def scope():
                      ('IMPORT','_vIrqAvoid'),
                      ('CODE', 'midi_chain', code_midi_chain)] )
 
+        def code_midi_queue():
+            nohop()
+            label('midi_queue')
+            PUSH();CALLI('_vIrqAvoid');POP()
+            LDW('_midi.q');_BEQ('.ret0')
+            LD('_midi.qn');XORI(4);_BEQ('.ret0')
+            LD('_midi.qn');STW(T3)
+            LD('_midi.qh');ADDW(T3);ANDI(3);LSLW();STW(T3)
+            LDWI('_midi.queue');ADDW(T3);STW(T3)
+            LDW(R8);DOKE(T3)
+            INC('_midi.qn')
+            LDI(1);RET()
+            label('.ret0')
+            LDI(0);RET()
+
+        module(name='midi_queue.s',
+               code=[('EXPORT','midi_queue'),
+                     ('IMPORT','_midi.q'),
+                     ('IMPORT','_midi.qh'),
+                     ('IMPORT','_midi.qn'),
+                     ('IMPORT','_midi.queue'),
+                     ('IMPORT','_vIrqAvoid'),
+                     ('CODE', 'midi_queue', code_midi_queue)] )
+
+        def code_midi_done():
+            nohop()
+            label('midi_done')
+            LD('_midi.done');RET()
+
+        module(name='midi_done.s',
+               code=[('EXPORT','midi_done'),
+                     ('IMPORT','_midi.done'),
+                     ('CODE', 'midi_done', code_midi_done)] )
+
+        def code_midi_set_tempo():
+            nohop()
+            label('midi_set_tempo')
+            LDW(R8);SUBI(16);_BGE('.st1')
+            LDI(16);STW(R8)
+            label('.st1')
+            LDW(R8);STW('_midi.tempo');RET()
+
+        module(name='midi_set_tempo.s',
+               code=[('EXPORT','midi_set_tempo'),
+                     ('IMPORT','_midi.tempo'),
+                     ('CODE', 'midi_set_tempo', code_midi_set_tempo)] )
+
+        def code_midi_dictionary():
+            nohop()
+            label('midi_dictionary')
+            LDW(R8);STW('_midi.dict');RET()
+
+        module(name='midi_dictionary.s',
+               code=[('EXPORT','midi_dictionary'),
+                     ('IMPORT','_midi.dict'),
+                     ('CODE', 'midi_dictionary', code_midi_dictionary)] )
+
+        def code_midi_drums():
+            nohop()
+            # DRUM(c,i) plays pattern i of the pointer table given here
+            label('midi_drums')
+            LDW(R8);STW('_fx.kit');RET()
+
+        module(name='midi_drums.s',
+               code=[('EXPORT','midi_drums'),
+                     ('IMPORT','_fx.kit'),
+                     ('CODE', 'midi_drums', code_midi_drums)] )
+
+        def code_midi_waves():
+            nohop()
+            # WAVE(w,i) loads entry i of the pointer table given here
+            label('midi_waves')
+            LDW(R8);STW('_midi.waves');RET()
+
+        module(name='midi_waves.s',
+               code=[('EXPORT','midi_waves'),
+                     ('IMPORT','_midi.waves'),
+                     ('CODE', 'midi_waves', code_midi_waves)] )
+
+        def code_midi_visual():
+            nohop()
+            # The vIRQ keeps (note,wavA) of each music channel in the
+            # nohop array given here, note 0 when the channel is off.
+            label('midi_visual')
+            LDW(R8);_BNE('.mv1')
+            LDWI('_midi.vnull')
+            label('.mv1')
+            STW('_midi.vis');RET()
+
+        module(name='midi_visual.s',
+               code=[('EXPORT','midi_visual'),
+                     ('IMPORT','_midi.vis'),
+                     ('IMPORT','_midi.vnull'),
+                     ('CODE', 'midi_visual', code_midi_visual)] )
+
+        def code_midi_seek():
+            # Keyframes follow the 0 terminator of the song table as a
+            # pointer list of records (timeL,timeH,seg,off) followed by
+            # (note,wavA,wavX) for each channel, with note 0 for off,
+            # then (slot,index) for each WAVE upload in effect and 255.
+            label('midi_seek')
+            PUSH()
+            LDW(R8);STW(R10)
+            label('.sk1')
+            LDW(R10);DEEK();_BEQ('.sk2')
+            INC(R10);INC(R10);_BRA('.sk1')
+            label('.sk2')
+            LDW(R10);ADDI(2);DEEK();_BEQ('.skfail')
+            STW(R10);DEEK();STW(R11)
+            # target frame = seconds * 60
+            LDW(R9);LSLW();LSLW();STW(T3)
+            LSLW();LSLW();LSLW();LSLW();SUBW(T3);STW(R9)
+            # find the last keyframe not after the target
+            label('.sk3')
+            INC(R10);INC(R10)
+            LDW(R10);DEEK();_BEQ('.sk4')
+            STW(T3);DEEK();SUBW(R9);_BGT('.sk4')
+            LDW(T3);STW(R11);_BRA('.sk3')
+            # stop the music and restore the channels through the map
+            label('.sk4')
+            LDI(0);STW('_midi.q');STW('_midi.p')
+            CALLI('_fx.reset')
+            LDWI('_midi.chp');STW(R12)
+            LDW(R11);ADDI(4);STW(R13)
+            label('.sk5')
+            LD(R12);ANDI(7);ADDW('_midi.vis');STW(T3)
+            LDW(R13);DEEK();DOKE(T3)
+            LDW(R12);DEEK();STW(R14)
+            LDW(R13);ADDI(1);PEEK();POKE(R14);INC(R14)
+            LDW(R13);ADDI(2);PEEK();POKE(R14);INC(R14)
+            LDI(0);STW(R15)
+            LDW(R13);PEEK();_BEQ('.sk6')
+            LSLW();STW(T3);LDWI(v('notesTable')-22);ADDW(T3);STW(T3)
+            LUP(0);ST(R15);LDW(T3);LUP(1);ST(R15+1)
+            label('.sk6')
+            LDW(R15);DOKE(R14)
+            LDW(R13);ADDI(3);STW(R13)
+            INC(R12);INC(R12);LD(R12);ANDI(7);_BNE('.sk5')
+            # upload the waveforms in effect at the keyframe, like WAVE(w,i)
+            label('.sk7')
+            LDW(R13);PEEK();XORI(255);_BEQ('.sk9')
+            XORI(255);ST(T3);LDI(v('soundTable')>>8);ST(T3+1)
+            LDW(R13);ADDI(1);PEEK();LSLW();ADDW('_midi.waves');DEEK();STW(R14)
+            label('.sk8')
+            LDW(R14);PEEK();POKE(T3);INC(R14)
+            LD(T3);ADDI(4);ST(T3);ANDI(0xfc);_BNE('.sk8')
+            LDW(R13);ADDI(2);STW(R13);_BRA('.sk7')
+            label('.sk9')
+            # resume decoding at the keyframe
+            LDW(R11);ADDI(2);PEEK();LSLW();ADDW(R8);STW(R12)
+            DEEK();STW(R13)
+            LDW(R11);ADDI(3);PEEK();ADDW(R13);STW('_midi.p')
+            LDW(R12);ADDI(2);CALLI('_midi.start')
+            LDW(R11);DEEK()
+            POP();RET()
+            label('.skfail')
+            LDWI(-1)
+            POP();RET()
+
+        module(name='midi_seek.s',
+               code=[('EXPORT','midi_seek'),
+                     ('IMPORT','_midi.p'),
+                     ('IMPORT','_midi.q'),
+                     ('IMPORT','_midi.chp'),
+                     ('IMPORT','_midi.vis'),
+                     ('IMPORT','_midi.waves'),
+                     ('IMPORT','_midi.start'),
+                     ('IMPORT','_fx.reset'),
+                     ('CODE', 'midi_seek', code_midi_seek)] )
+
+        def code_sfx_play():
+            nohop()
+            label('sfx_play')
+            PUSH()
+            # post the request, the vIRQ takes the channels
+            CALLI('_vIrqAvoid')
+            LDW(R8);STW('_sfx.n')
+            LD(R9);ORI(128);ST('_sfx.nmask')
+            # arrange speedy start
+            CALLI('_vBlnAvoid')
+            LD('frameCount');INC(vACL);_BEQ('.sfx1')
+            CALLI('_clock.sub')
+            STW('_vIrqTicks')
+            LDW(LAC+2);STW(v('_vIrqTicks')+2)
+            LDI(0xff);ST('frameCount')
+            label('.sfx1')
+            POP();RET()
+
+        module(name='sfx_play.s',
+               code=[('EXPORT','sfx_play'),
+                     ('IMPORT','_sfx.n'),
+                     ('IMPORT','_sfx.nmask'),
+                     ('IMPORT','_vIrqTicks'),
+                     ('IMPORT','_vIrqAvoid'),
+                     ('IMPORT','_vBlnAvoid'),
+                     ('IMPORT','_clock.sub'),
+                     ('CODE', 'sfx_play', code_sfx_play)] )
+
+        def code_sfx_playing():
+            nohop()
+            label('sfx_playing')
+            LD('_sfx.nmask');ORW('_sfx.q');RET()
+
+        module(name='sfx_playing.s',
+               code=[('EXPORT','sfx_playing'),
+                     ('IMPORT','_sfx.q'),
+                     ('IMPORT','_sfx.nmask'),
+                     ('CODE', 'sfx_playing', code_sfx_playing)] )
+
 
 scope()
 